@@ -108,17 +108,13 @@ FourVector Action::get_interaction_point() const {
 std::pair<FourVector, FourVector> Action::get_potential_at_interaction_point()
     const {
   const ThreeVector r = get_interaction_point().threevec();
-  FourVector UB = FourVector();
-  FourVector UI3 = FourVector();
   /* Check:
    * Lattice is turned on. */
-  if (UB_lat_pointer != nullptr) {
-    UB_lat_pointer->value_at(r, UB);
+  PotentialsOnLattice potentials;
+  if (potentials_lat_pointer != nullptr) {
+    potentials_lat_pointer->at(r, potentials);
   }
-  if (UI3_lat_pointer != nullptr) {
-    UI3_lat_pointer->value_at(r, UI3);
-  }
-  return std::make_pair(UB, UI3);
+  return std::make_pair(potentials.UB, potentials.UI3);
 }
 
 void Action::perform(Particles *particles, uint32_t id_process) {
@@ -144,7 +140,9 @@ void Action::perform(Particles *particles, uint32_t id_process) {
   /* Check the conservation laws if the modifications of the total kinetic
    * energy of the outgoing particles by the mean field potentials are not
    * taken into account. */
-  if (UB_lat_pointer == nullptr && UI3_lat_pointer == nullptr) {
+  if (potentials_lat_pointer == nullptr || pot_pointer == nullptr ||
+      !(pot_pointer->use_skyrme() || pot_pointer->use_symmetry() ||
+        pot_pointer->use_vdf())) {
     check_conservation(id_process);
   }
 }
@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/asciiformat.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace smash {
+
+namespace {
+/// Powers of ten, which are exactly representable as double
+constexpr double exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// Largest exponent in exact_powers_of_ten
+constexpr int max_exact_power = 22;
+
+/**
+ * Write a number with std::snprintf.
+ *
+ * \param[out] out Space for at least max_general_length characters
+ * \param[in] x Number to write
+ * \param[in] precision Number of significant digits
+ * \return Pointer behind the last written character
+ */
+char *format_with_printf(char *out, double x, int precision) {
+  char buffer[max_general_length + 1];
+  const int n = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, x);
+  assert(n > 0 && static_cast<std::size_t>(n) <= max_general_length);
+  std::memcpy(out, buffer, n);
+  return out + n;
+}
+
+/**
+ * Multiply by a power of ten with a single rounding.
+ *
+ * \param[in] a Number to scale
+ * \param[in] k Exponent, at most max_exact_power in magnitude
+ * \return \f$a \cdot 10^k\f$
+ */
+double scale(double a, int k) {
+  return k >= 0 ? a * exact_powers_of_ten[k] : a / exact_powers_of_ten[-k];
+}
+
+/**
+ * Write a given number of decimal digits, including leading zeros.
+ *
+ * \param[out] out Space for the digits
+ * \param[in] n Number to write
+ * \param[in] count Number of digits
+ */
+void write_digits(char *out, std::uint32_t n, int count) {
+  for (int i = count - 1; i >= 0; i--) {
+    out[i] = static_cast<char>('0' + n % 10);
+    n /= 10;
+  }
+}
+}  // unnamed namespace
+
+char *format_general(char *out, double x, int precision) {
+  assert(precision >= 1 && precision <= 9);
+  if (x == 0.) {
+    if (std::signbit(x)) {
+      *out++ = '-';
+    }
+    *out++ = '0';
+    return out;
+  }
+  if (!std::isfinite(x)) {
+    return format_with_printf(out, x, precision);
+  }
+  const double a = std::abs(x);
+  /* Estimate the decimal exponent from the binary one. The estimate is at
+   * most one too small, which is corrected below. */
+  int binary_exponent;
+  std::frexp(a, &binary_exponent);
+  int exponent = static_cast<int>(
+      std::floor((binary_exponent - 1) * 0.30102999566398120));
+  int k = precision - 1 - exponent;
+  if (std::abs(k) >= max_exact_power) {
+    return format_with_printf(out, x, precision);
+  }
+  // The scaled number has the significant digits in front of the point.
+  double m = scale(a, k);
+  const double lower = exact_powers_of_ten[precision - 1];
+  const double upper = exact_powers_of_ten[precision];
+  if (m >= upper) {
+    exponent++;
+    k--;
+    m = scale(a, k);
+  }
+  if (m < lower || m >= upper) {
+    return format_with_printf(out, x, precision);
+  }
+  /* m is off by at most half an ulp, i.e. less than 1e-7 for m < 1e9. If it is
+   * closer to a halfway case, the rounding cannot be decided from m. */
+  const double integral = std::floor(m);
+  const double fraction = m - integral;
+  if (std::abs(fraction - 0.5) < 1e-6) {
+    return format_with_printf(out, x, precision);
+  }
+  std::uint32_t digits = static_cast<std::uint32_t>(integral);
+  if (fraction > 0.5) {
+    digits++;
+  }
+  if (digits == static_cast<std::uint32_t>(upper)) {
+    digits /= 10;
+    exponent++;
+  }
+
+  char d[9];
+  write_digits(d, digits, precision);
+  int n = precision;
+  while (n > 1 && d[n - 1] == '0') {
+    n--;
+  }
+  if (x < 0.) {
+    *out++ = '-';
+  }
+  if (exponent >= -4 && exponent < precision) {
+    if (exponent >= 0) {
+      std::memcpy(out, d, exponent + 1);
+      out += exponent + 1;
+      if (n > exponent + 1) {
+        *out++ = '.';
+        std::memcpy(out, d + exponent + 1, n - exponent - 1);
+        out += n - exponent - 1;
+      }
+    } else {
+      *out++ = '0';
+      *out++ = '.';
+      for (int i = -1; i > exponent; i--) {
+        *out++ = '0';
+      }
+      std::memcpy(out, d, n);
+      out += n;
+    }
+  } else {
+    *out++ = d[0];
+    if (n > 1) {
+      *out++ = '.';
+      std::memcpy(out, d + 1, n - 1);
+      out += n - 1;
+    }
+    *out++ = 'e';
+    *out++ = exponent < 0 ? '-' : '+';
+    const int abs_exponent = std::abs(exponent);
+    const int exponent_digits = abs_exponent >= 100 ? 3 : 2;
+    write_digits(out, abs_exponent, exponent_digits);
+    out += exponent_digits;
+  }
+  return out;
+}
+
+char *format_int(char *out, int x) {
+  std::uint32_t magnitude = static_cast<std::uint32_t>(x);
+  if (x < 0) {
+    *out++ = '-';
+    magnitude = 0u - magnitude;
+  }
+  char digits[10];
+  int n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude > 0);
+  while (n > 0) {
+    *out++ = digits[--n];
+  }
+  return out;
+}
+
+constexpr std::size_t AsciiLine::capacity_;
+
+char *AsciiLine::next(std::size_t length) {
+  // One more character for the separator and one for the final newline
+  if (size_ + length + 2 > capacity_) {
+    throw std::length_error("Line of ASCII output is too long.");
+  }
+  if (size_ > 0) {
+    buffer_[size_++] = ' ';
+  }
+  return buffer_ + size_;
+}
+
+AsciiLine &AsciiLine::general(double x, int precision) {
+  char *out = next(max_general_length);
+  size_ = format_general(out, x, precision) - buffer_;
+  return *this;
+}
+
+AsciiLine &AsciiLine::integer(int x) {
+  char *out = next(11);
+  size_ = format_int(out, x) - buffer_;
+  return *this;
+}
+
+AsciiLine &AsciiLine::string(const char *s) {
+  const std::size_t length = std::strlen(s);
+  char *out = next(length);
+  std::memcpy(out, s, length);
+  size_ += length;
+  return *this;
+}
+
+void AsciiLine::write(std::FILE *file) {
+  buffer_[size_++] = '\n';
+  std::fwrite(buffer_, 1, size_, file);
+  size_ = 0;
+}
+
+}  // namespace smash
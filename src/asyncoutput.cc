@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/asyncoutput.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "smash/clock.h"
+#include "smash/cxx14compat.h"
+#include "smash/logging.h"
+#include "smash/particles.h"
+
+namespace smash {
+
+void RecordedAction::generate_final_state() {
+  throw std::logic_error("A recorded action cannot be performed again.");
+}
+
+void RecordedAction::format_debug_output(std::ostream &out) const {
+  out << "Recorded action of type " << get_type() << " at "
+      << time_of_execution();
+}
+
+OutputWriterThread::OutputWriterThread(std::size_t capacity)
+    : capacity_(capacity) {
+  if (capacity_ == 0) {
+    throw std::invalid_argument(
+        "The queue of the output writer needs a positive capacity.");
+  }
+  thread_ = std::thread(&OutputWriterThread::run, this);
+}
+
+OutputWriterThread::~OutputWriterThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  task_pushed_.notify_one();
+  thread_.join();
+}
+
+void OutputWriterThread::push(std::function<void()> task) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  task_done_.wait(lock,
+                  [this] { return tasks_.size() < capacity_ || error_; });
+  rethrow_error();
+  tasks_.push_back(std::move(task));
+  lock.unlock();
+  task_pushed_.notify_one();
+}
+
+void OutputWriterThread::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  task_done_.wait(lock,
+                  [this] { return (tasks_.empty() && !busy_) || error_; });
+  rethrow_error();
+}
+
+void OutputWriterThread::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    task_pushed_.wait(lock, [this] { return !tasks_.empty() || stop_; });
+    if (tasks_.empty()) {
+      return;
+    }
+    std::function<void()> task = std::move(tasks_.front());
+    tasks_.pop_front();
+    busy_ = true;
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+    busy_ = false;
+    if (error) {
+      // The following tasks would write an inconsistent output.
+      error_ = error;
+      tasks_.clear();
+    }
+    task_done_.notify_all();
+  }
+}
+
+void OutputWriterThread::rethrow_error() {
+  if (error_) {
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+AsyncOutput::AsyncOutput(std::unique_ptr<OutputInterface> output,
+                         std::shared_ptr<OutputWriterThread> writer)
+    : ForwardingOutput(std::move(output)), writer_(std::move(writer)) {}
+
+AsyncOutput::~AsyncOutput() {
+  try {
+    writer_->flush();
+  } catch (std::exception &e) {
+    logg[LOutput].error("Writing the output failed: ", e.what());
+  }
+}
+
+void AsyncOutput::before_forwarding() { writer_->flush(); }
+
+void AsyncOutput::at_eventstart(const Particles &particles,
+                                const int event_number, const EventInfo &info) {
+  std::shared_ptr<const Particles> snapshot = particles.clone();
+  OutputInterface *output = output_.get();
+  writer_->push([output, snapshot, event_number, info] {
+    output->at_eventstart(*snapshot, event_number, info);
+  });
+}
+
+void AsyncOutput::at_interaction(const Action &action, const double density) {
+  std::shared_ptr<const Action> record =
+      std::make_shared<RecordedAction>(action);
+  OutputInterface *output = output_.get();
+  writer_->push(
+      [output, record, density] { output->at_interaction(*record, density); });
+}
+
+void AsyncOutput::at_dilepton_decays(const std::vector<DileptonDecay> &decays) {
+  std::shared_ptr<const std::vector<DileptonDecay>> records =
+      std::make_shared<std::vector<DileptonDecay>>(decays);
+  OutputInterface *output = output_.get();
+  writer_->push([output, records] { output->at_dilepton_decays(*records); });
+}
+
+void AsyncOutput::at_intermediate_time(const Particles &particles,
+                                       const std::unique_ptr<Clock> &clock,
+                                       const DensityParameters &dens_param,
+                                       const EventInfo &info) {
+  std::shared_ptr<const Particles> snapshot = particles.clone();
+  const bool has_clock = clock != nullptr;
+  const double time = has_clock ? clock->current_time() : 0.;
+  const double dt = has_clock ? std::max(0., clock->timestep_duration()) : 0.;
+  OutputInterface *output = output_.get();
+  writer_->push([output, snapshot, has_clock, time, dt, dens_param, info] {
+    std::unique_ptr<Clock> snapshot_clock;
+    if (has_clock) {
+      snapshot_clock = make_unique<UniformClock>(time, dt);
+    }
+    output->at_intermediate_time(*snapshot, snapshot_clock, dens_param, info);
+  });
+}
+
+}  // namespace smash
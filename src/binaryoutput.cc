@@ -15,6 +15,7 @@
 
 #include "smash/action.h"
 #include "smash/clock.h"
+#include "smash/compression.h"
 #include "smash/config.h"
 
 namespace smash {
@@ -134,32 +135,32 @@ static constexpr int HyperSurfaceCrossing = LogArea::HyperSurfaceCrossing::id;
 BinaryOutputBase::BinaryOutputBase(const bf::path &path,
                                    const std::string &mode,
                                    const std::string &name,
-                                   bool extended_format)
-    : OutputInterface(name), file_{path, mode}, extended_(extended_format) {
-  std::fwrite("SMSH", 4, 1, file_.get());  // magic number
-  write(format_version_);                  // file format version number
+                                   bool extended_format,
+                                   const std::string &compression)
+    : OutputInterface(name),
+      file_{path, mode, create_compression_codec(compression)},
+      extended_(extended_format) {
+  append("SMSH", 4);        // magic number
+  write(format_version_);  // file format version number
   std::uint16_t format_variant = static_cast<uint16_t>(extended_);
   write(format_variant);
   write(VERSION_MAJOR);  // SMASH version
+  write_buffer();
 }
 
 // write functions:
-void BinaryOutputBase::write(const char c) {
-  std::fwrite(&c, sizeof(char), 1, file_.get());
-}
+void BinaryOutputBase::write(const char c) { append(c); }
 
 void BinaryOutputBase::write(const std::string &s) {
   const auto size = boost::numeric_cast<uint32_t>(s.size());
-  std::fwrite(&size, sizeof(std::uint32_t), 1, file_.get());
-  std::fwrite(s.c_str(), s.size(), 1, file_.get());
+  append(size);
+  append(s.c_str(), s.size());
 }
 
-void BinaryOutputBase::write(const double x) {
-  std::fwrite(&x, sizeof(x), 1, file_.get());
-}
+void BinaryOutputBase::write(const double x) { append(x); }
 
 void BinaryOutputBase::write(const FourVector &v) {
-  std::fwrite(v.begin(), sizeof(*v.begin()), 4, file_.get());
+  append(reinterpret_cast<const char *>(v.begin()), 4 * sizeof(*v.begin()));
 }
 
 void BinaryOutputBase::write(const Particles &particles) {
@@ -176,8 +177,7 @@ void BinaryOutputBase::write(const ParticleList &particles) {
 
 void BinaryOutputBase::write_particledata(const ParticleData &p) {
   write(p.position());
-  double mass = p.effective_mass();
-  std::fwrite(&mass, sizeof(mass), 1, file_.get());
+  write(p.effective_mass());
   write(p.momentum());
   write(p.pdgcode().get_decimal());
   write(p.id());
@@ -195,21 +195,29 @@ void BinaryOutputBase::write_particledata(const ParticleData &p) {
   }
 }
 
+void BinaryOutputBase::write_buffer() {
+  if (!buffer_.empty()) {
+    std::fwrite(buffer_.data(), 1, buffer_.size(), file_.get());
+    buffer_.clear();
+  }
+}
+
 BinaryOutputCollisions::BinaryOutputCollisions(const bf::path &path,
                                                std::string name,
                                                const OutputParameters &out_par)
     : BinaryOutputBase(
           path / ((name == "Collisions" ? "collisions_binary" : name) + ".bin"),
-          "wb", name, out_par.get_coll_extended(name)),
+          "wb", name, out_par.get_coll_extended(name), out_par.compression),
       print_start_end_(out_par.coll_printstartend) {}
 
 void BinaryOutputCollisions::at_eventstart(const Particles &particles,
                                            const int, const EventInfo &) {
   const char pchar = 'p';
   if (print_start_end_) {
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(particles.size());
     write(particles);
+    write_buffer();
   }
 }
 
@@ -218,54 +226,77 @@ void BinaryOutputCollisions::at_eventend(const Particles &particles,
                                          const EventInfo &event) {
   const char pchar = 'p';
   if (print_start_end_) {
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(particles.size());
     write(particles);
   }
 
   // Event end line
   const char fchar = 'f';
-  std::fwrite(&fchar, sizeof(char), 1, file_.get());
+  write(fchar);
   write(event_number);
   write(event.impact_parameter);
   const char empty = event.empty_event;
   write(empty);
 
   // Flush to disk
-  std::fflush(file_.get());
+  write_buffer();
+  file_.flush();
 }
 
 void BinaryOutputCollisions::at_interaction(const Action &action,
                                             const double density) {
   const char ichar = 'i';
-  std::fwrite(&ichar, sizeof(char), 1, file_.get());
+  write(ichar);
   write(action.incoming_particles().size());
   write(action.outgoing_particles().size());
-  std::fwrite(&density, sizeof(double), 1, file_.get());
+  write(density);
   const double weight = action.get_total_weight();
-  std::fwrite(&weight, sizeof(double), 1, file_.get());
+  write(weight);
   const double partial_weight = action.get_partial_weight();
-  std::fwrite(&partial_weight, sizeof(double), 1, file_.get());
+  write(partial_weight);
   const auto type = static_cast<uint32_t>(action.get_type());
-  std::fwrite(&type, sizeof(uint32_t), 1, file_.get());
+  write(type);
   write(action.incoming_particles());
   write(action.outgoing_particles());
+  write_buffer();
+}
+
+void BinaryOutputCollisions::at_dilepton_decays(
+    const std::vector<DileptonDecay> &decays) {
+  const char ichar = 'i';
+  const std::size_t n_in = 1;
+  const double density = 0.;
+  const auto type = static_cast<uint32_t>(ProcessType::Decay);
+  for (const DileptonDecay &decay : decays) {
+    write(ichar);
+    write(n_in);
+    write(decay.products.size());
+    write(density);
+    write(decay.weight);
+    write(decay.partial_width);
+    write(type);
+    write_particledata(decay.parent);
+    write(decay.products);
+  }
+  write_buffer();
 }
 
 BinaryOutputParticles::BinaryOutputParticles(const bf::path &path,
                                              std::string name,
                                              const OutputParameters &out_par)
     : BinaryOutputBase(path / "particles_binary.bin", "wb", name,
-                       out_par.part_extended),
+                       out_par.part_extended, out_par.compression),
       only_final_(out_par.part_only_final) {}
 
 void BinaryOutputParticles::at_eventstart(const Particles &particles, const int,
                                           const EventInfo &) {
   const char pchar = 'p';
   if (only_final_ == OutputOnlyFinal::No) {
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(particles.size());
     write(particles);
+    write_buffer();
   }
 }
 
@@ -274,21 +305,22 @@ void BinaryOutputParticles::at_eventend(const Particles &particles,
                                         const EventInfo &event) {
   const char pchar = 'p';
   if (!(event.empty_event && only_final_ == OutputOnlyFinal::IfNotEmpty)) {
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(particles.size());
     write(particles);
   }
 
   // Event end line
   const char fchar = 'f';
-  std::fwrite(&fchar, sizeof(char), 1, file_.get());
+  write(fchar);
   write(event_number);
   write(event.impact_parameter);
   const char empty = event.empty_event;
   write(empty);
 
   // Flush to disk
-  std::fflush(file_.get());
+  write_buffer();
+  file_.flush();
 }
 
 void BinaryOutputParticles::at_intermediate_time(const Particles &particles,
@@ -297,16 +329,17 @@ void BinaryOutputParticles::at_intermediate_time(const Particles &particles,
                                                  const EventInfo &) {
   const char pchar = 'p';
   if (only_final_ == OutputOnlyFinal::No) {
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(particles.size());
     write(particles);
+    write_buffer();
   }
 }
 
 BinaryOutputInitialConditions::BinaryOutputInitialConditions(
     const bf::path &path, std::string name, const OutputParameters &out_par)
-    : BinaryOutputBase(path / "SMASH_IC.bin", "wb", name, out_par.ic_extended) {
-}
+    : BinaryOutputBase(path / "SMASH_IC.bin", "wb", name, out_par.ic_extended,
+                       out_par.compression) {}
 
 void BinaryOutputInitialConditions::at_eventstart(const Particles &, const int,
                                                   const EventInfo &) {}
@@ -316,14 +349,15 @@ void BinaryOutputInitialConditions::at_eventend(const Particles &particles,
                                                 const EventInfo &event) {
   // Event end line
   const char fchar = 'f';
-  std::fwrite(&fchar, sizeof(char), 1, file_.get());
+  write(fchar);
   write(event_number);
   write(event.impact_parameter);
   const char empty = event.empty_event;
   write(empty);
 
   // Flush to disk
-  std::fflush(file_.get());
+  write_buffer();
+  file_.flush();
 
   // If the runtime is too short some particles might not yet have
   // reached the hypersurface. Warning is printed.
@@ -339,9 +373,10 @@ void BinaryOutputInitialConditions::at_interaction(const Action &action,
                                                    const double) {
   if (action.get_type() == ProcessType::HyperSurfaceCrossing) {
     const char pchar = 'p';
-    std::fwrite(&pchar, sizeof(char), 1, file_.get());
+    write(pchar);
     write(action.incoming_particles().size());
     write(action.incoming_particles());
+    write_buffer();
   }
 }
 }  // namespace smash
@@ -8,13 +8,57 @@
  */
 
 #include "smash/bremsstrahlungaction.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
 #include "smash/crosssectionsbrems.h"
+#include "smash/interpolation2D.h"
 #include "smash/outputinterface.h"
 #include "smash/random.h"
 
 namespace smash {
 static constexpr int LScatterAction = LogArea::ScatterAction::id;
 
+namespace {
+/// Smallest tabulated photon momentum [GeV]
+constexpr double brems_k_min = 0.001;
+/// Largest tabulated photon momentum [GeV]
+constexpr double brems_k_max = 1.0;
+
+/**
+ * Uniform sqrt(s) axis of the resampled differential cross sections. The
+ * spacing corresponds to the finest spacing of the tabulated data.
+ */
+const FloatGridTabulation::Axis brems_sqrts_axis = {0.3, 5.0, 470};
+
+/**
+ * Uniform ln(k) axis of the resampled dSigma/dk. The tabulated photon momenta
+ * are logarithmically spaced, so the grid points coincide with them.
+ */
+const FloatGridTabulation::Axis brems_log_k_axis = {
+    std::log(brems_k_min), std::log(brems_k_max), 99};
+
+/// Uniform theta axis of the resampled dSigma/dtheta
+const FloatGridTabulation::Axis brems_theta_axis = {0.0, M_PI, 79};
+
+/// Guards the creation of the interpolation objects
+std::once_flag brems_interpolations_created;
+}  // namespace
+
+std::unique_ptr<FloatGridTabulation>
+BremsstrahlungAction::resample_diff_cross_section(
+    const std::vector<double> &x, const std::vector<double> &sqrts,
+    const std::vector<double> &sigma, bool dsigma_dk) {
+  const InterpolateData2DSpline spline(x, sqrts, sigma);
+  return make_unique<FloatGridTabulation>(
+      dsigma_dk ? brems_log_k_axis : brems_theta_axis, brems_sqrts_axis,
+      [&](double u, double srts) {
+        return spline(dsigma_dk ? std::exp(u) : u, srts);
+      });
+}
+
 BremsstrahlungAction::BremsstrahlungAction(
     const ParticleList &in, const double time, const int n_frac_photons,
     const double hadronic_cross_section_input)
@@ -91,7 +135,7 @@ void BremsstrahlungAction::generate_final_state() {
   // Sample k and theta:
   // minimum cutoff for k to be in accordance with cross section calculations
   double delta_k;  // k-range
-  double k_min = 0.001;
+  double k_min = brems_k_min;
   double k_max =
       (sqrt_s() * sqrt_s() - 2 * outgoing_particles_[0].type().mass() * 2 *
                                  outgoing_particles_[1].type().mass()) /
@@ -184,11 +228,9 @@ CollisionBranchList BremsstrahlungAction::brems_cross_sections() {
   static const ParticleTypePtr pi_p_particle = &ParticleType::find(pdg::pi_p);
   static const ParticleTypePtr pi_m_particle = &ParticleType::find(pdg::pi_m);
 
-  // Create interpolation objects, if not yet existent; only trigger for one
-  // of them as either all or none is created
-  if (pi0pi0_pipi_dsigma_dtheta_interpolation == nullptr) {
-    create_interpolations();
-  }
+  // Create the interpolation objects on first use, also if several threads
+  // evaluate cross sections at the same time
+  std::call_once(brems_interpolations_created, create_interpolations);
 
   // Find cross section corresponding to given sqrt(s)
   double sqrts = sqrt_s();
@@ -269,43 +311,45 @@ CollisionBranchList BremsstrahlungAction::brems_cross_sections() {
 
 std::pair<double, double> BremsstrahlungAction::brems_diff_cross_sections() {
   static const ParticleTypePtr pi_z_particle = &ParticleType::find(pdg::pi_z);
+  std::call_once(brems_interpolations_created, create_interpolations);
   const double collision_energy = sqrt_s();
-  double dsigma_dk;
-  double dsigma_dtheta;
+  // k is 0 if no photon can be produced above the cutoff, the tables are
+  // clamped to the smallest tabulated momentum anyway
+  const double log_k = std::log(std::max(k_, brems_k_min));
+  const FloatGridTabulation *dk_table;
+  const FloatGridTabulation *dtheta_table;
 
   if (reac_ == ReactionType::pi_p_pi_m) {
     if (outgoing_particles_[0].type() != *pi_z_particle) {
       // pi+- + pi+-- -> pi+- + pi+- + gamma
-      dsigma_dk =
-          (*pipi_pipi_opp_dsigma_dk_interpolation)(k_, collision_energy);
-      dsigma_dtheta = (*pipi_pipi_opp_dsigma_dtheta_interpolation)(
-          theta_, collision_energy);
+      dk_table = pipi_pipi_opp_dsigma_dk_interpolation.get();
+      dtheta_table = pipi_pipi_opp_dsigma_dtheta_interpolation.get();
     } else {
       // pi+- + pi+-- -> pi0 + pi0 + gamma
-      dsigma_dk = (*pipi_pi0pi0_dsigma_dk_interpolation)(k_, collision_energy);
-      dsigma_dtheta =
-          (*pipi_pi0pi0_dsigma_dtheta_interpolation)(theta_, collision_energy);
+      dk_table = pipi_pi0pi0_dsigma_dk_interpolation.get();
+      dtheta_table = pipi_pi0pi0_dsigma_dtheta_interpolation.get();
     }
   } else if (reac_ == ReactionType::pi_p_pi_p ||
              reac_ == ReactionType::pi_m_pi_m) {
-    dsigma_dk = (*pipi_pipi_same_dsigma_dk_interpolation)(k_, collision_energy);
-    dsigma_dtheta =
-        (*pipi_pipi_same_dsigma_dtheta_interpolation)(theta_, collision_energy);
+    dk_table = pipi_pipi_same_dsigma_dk_interpolation.get();
+    dtheta_table = pipi_pipi_same_dsigma_dtheta_interpolation.get();
   } else if (reac_ == ReactionType::pi_z_pi_p ||
              reac_ == ReactionType::pi_z_pi_m) {
-    dsigma_dk = (*pipi0_pipi0_dsigma_dk_interpolation)(k_, collision_energy);
-    dsigma_dtheta =
-        (*pipi0_pipi0_dsigma_dtheta_interpolation)(theta_, collision_energy);
+    dk_table = pipi0_pipi0_dsigma_dk_interpolation.get();
+    dtheta_table = pipi0_pipi0_dsigma_dtheta_interpolation.get();
   } else if (reac_ == ReactionType::pi_z_pi_z) {
-    dsigma_dk = (*pi0pi0_pipi_dsigma_dk_interpolation)(k_, collision_energy);
-    dsigma_dtheta =
-        (*pi0pi0_pipi_dsigma_dtheta_interpolation)(theta_, collision_energy);
+    dk_table = pi0pi0_pipi_dsigma_dk_interpolation.get();
+    dtheta_table = pi0pi0_pipi_dsigma_dtheta_interpolation.get();
   } else {
     throw std::runtime_error(
         "Unkown channel when computing differential cross sections for "
         "bremsstrahlung processes.");
   }
 
+  double dsigma_dk = dk_table->get_value_linear(log_k, collision_energy);
+  double dsigma_dtheta =
+      dtheta_table->get_value_linear(theta_, collision_energy);
+
   // Prevent negative cross sections due to numerics in interpolation
   dsigma_dk = (dsigma_dk < 0.0) ? really_small : dsigma_dk;
   dsigma_dtheta = (dsigma_dtheta < 0.0) ? really_small : dsigma_dtheta;
@@ -362,35 +406,40 @@ void BremsstrahlungAction::create_interpolations() {
   pi0pi0_pipi_interpolation =
       make_unique<InterpolateDataLinear<double>>(sqrts, sigma_pi0pi0_pipi);
 
-  // Create interpolation objects containing bicubic interpolations for
-  // differential dSigma/dk
-  pipi_pipi_opp_dsigma_dk_interpolation = make_unique<InterpolateData2DSpline>(
-      photon_momentum, sqrts, dsigma_dk_pipi_pipi_opp);
-  pipi_pipi_same_dsigma_dk_interpolation = make_unique<InterpolateData2DSpline>(
-      photon_momentum, sqrts, dsigma_dk_pipi_pipi_same);
-  pipi0_pipi0_dsigma_dk_interpolation = make_unique<InterpolateData2DSpline>(
-      photon_momentum, sqrts, dsigma_dk_pipi0_pipi0);
-  pipi_pi0pi0_dsigma_dk_interpolation = make_unique<InterpolateData2DSpline>(
-      photon_momentum, sqrts, dsigma_dk_pipi_pi0pi0);
-  pi0pi0_pipi_dsigma_dk_interpolation = make_unique<InterpolateData2DSpline>(
-      photon_momentum, sqrts, dsigma_dk_pi0pi0_pipi);
-
-  // Create interpolation objects containing bicubic interpolations for
-  // differential dSigma/dtheta
+  // Resample bicubic interpolations of the differential dSigma/dk onto
+  // uniform grids in ln(k) and sqrt(s)
+  pipi_pipi_opp_dsigma_dk_interpolation =
+      resample_diff_cross_section(photon_momentum, sqrts,
+                                  dsigma_dk_pipi_pipi_opp, true);
+  pipi_pipi_same_dsigma_dk_interpolation =
+      resample_diff_cross_section(photon_momentum, sqrts,
+                                  dsigma_dk_pipi_pipi_same, true);
+  pipi0_pipi0_dsigma_dk_interpolation =
+      resample_diff_cross_section(photon_momentum, sqrts,
+                                  dsigma_dk_pipi0_pipi0, true);
+  pipi_pi0pi0_dsigma_dk_interpolation =
+      resample_diff_cross_section(photon_momentum, sqrts,
+                                  dsigma_dk_pipi_pi0pi0, true);
+  pi0pi0_pipi_dsigma_dk_interpolation =
+      resample_diff_cross_section(photon_momentum, sqrts,
+                                  dsigma_dk_pi0pi0_pipi, true);
+
+  // Resample bicubic interpolations of the differential dSigma/dtheta onto
+  // uniform grids in theta and sqrt(s)
   pipi_pipi_opp_dsigma_dtheta_interpolation =
-      make_unique<InterpolateData2DSpline>(photon_angle, sqrts,
-                                           dsigma_dtheta_pipi_pipi_opp);
+      resample_diff_cross_section(photon_angle, sqrts,
+                                  dsigma_dtheta_pipi_pipi_opp, false);
   pipi_pipi_same_dsigma_dtheta_interpolation =
-      make_unique<InterpolateData2DSpline>(photon_angle, sqrts,
-                                           dsigma_dtheta_pipi_pipi_same);
+      resample_diff_cross_section(photon_angle, sqrts,
+                                  dsigma_dtheta_pipi_pipi_same, false);
   pipi0_pipi0_dsigma_dtheta_interpolation =
-      make_unique<InterpolateData2DSpline>(photon_angle, sqrts,
-                                           dsigma_dtheta_pipi0_pipi0);
+      resample_diff_cross_section(photon_angle, sqrts,
+                                  dsigma_dtheta_pipi0_pipi0, false);
   pipi_pi0pi0_dsigma_dtheta_interpolation =
-      make_unique<InterpolateData2DSpline>(photon_angle, sqrts,
-                                           dsigma_dtheta_pipi_pi0pi0);
+      resample_diff_cross_section(photon_angle, sqrts,
+                                  dsigma_dtheta_pipi_pi0pi0, false);
   pi0pi0_pipi_dsigma_dtheta_interpolation =
-      make_unique<InterpolateData2DSpline>(photon_angle, sqrts,
-                                           dsigma_dtheta_pi0pi0_pipi);
+      resample_diff_cross_section(photon_angle, sqrts,
+                                  dsigma_dtheta_pi0pi0_pipi, false);
 }
 }  // namespace smash
@@ -0,0 +1,215 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/columnarfile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace smash {
+
+/*!\Userguide
+ * \page format_columnar_ Columnar Format
+ * The columnar format stores the particles at the end of every event in
+ * columns, followed by an index of all events. Single events can therefore be
+ * read without going through the file from the start. Like the
+ * \ref format_binary_ "binary format", it saves all numbers with full
+ * precision in the byte order of the machine that wrote the file. The file
+ * is called \c particles_columnar.bin and is only complete (and renamed from
+ * \c particles_columnar.bin.unfinished) when SMASH finishes, because the index
+ * is written last.
+ *
+ * **Header**
+ * \code
+ * 8*char        uint32_t        uint32_t
+ * magic_number, format_version, n_columns
+ * \endcode
+ * \li magic_number - 8 bytes that in ASCII read as "SMASHCOL".
+ * \li format_version is currently 1.
+ * \li n_columns is the number of columns of an event, currently 14.
+ *
+ * **Events**\n
+ * The columns of one event follow each other without gaps. The first columns
+ * consist of doubles, the others of 32 bit integers. For n particles, they
+ * are:
+ * \code
+ * 4n*double  4n*double       n*double  n*double        n*double
+ * t x y z    p0 px py pz     mass      formation_time  xsec_scaling_factor
+ *
+ * n*double                n*int32_t  n*int32_t  n*int32_t  n*int32_t
+ * time_last_collision     pdg        ID         charge     ncoll
+ *
+ * n*int32_t       n*int32_t         n*int32_t    n*int32_t
+ * proc_id_origin  proc_type_origin  pdg_mother1  pdg_mother2
+ * \endcode
+ * The four coordinates of a particle are next to each other, as are the four
+ * components of its momentum. The meaning of the history columns is
+ * described for the \ref format_binary_ "extended binary format". The event
+ * is padded with zeros to a multiple of 8 bytes.
+ *
+ * **Index**\n
+ * For every event, in the order in which they are written:
+ * \code
+ * uint64_t  uint64_t     int32_t       int32_t      double
+ * offset    n_particles  event_number  empty_event  impact_parameter
+ * \endcode
+ * \li offset - Position of the first column of the event in the file [bytes]
+ * \li empty_event - 1 if there was no interaction between projectile and
+ * target, 0 otherwise
+ *
+ * **Footer**
+ * \code
+ * uint64_t      uint64_t  8*char
+ * index_offset  n_events  magic_number
+ * \endcode
+ * \li index_offset - Position of the index in the file [bytes]
+ * \li magic_number - 8 bytes that in ASCII read as "SMASHIDX".
+ *
+ * The class smash::ColumnarFileReader maps such a file into memory and gives
+ * direct access to the columns of every event.
+ */
+
+std::size_t columnar_column_offset(ColumnarColumn column,
+                                   std::size_t n_particles) {
+  std::size_t offset = 0;
+  for (int c = 0; c < static_cast<int>(column); c++) {
+    const ColumnarColumn previous = static_cast<ColumnarColumn>(c);
+    offset += n_particles * columnar_values_per_particle(previous) *
+              (columnar_column_is_double(previous) ? 8 : 4);
+  }
+  return offset;
+}
+
+std::size_t columnar_event_size(std::size_t n_particles) {
+  const std::size_t size =
+      columnar_column_offset(ColumnarColumn::PdgMother2, n_particles) +
+      4 * n_particles;
+  return (size + 7) / 8 * 8;
+}
+
+namespace {
+/**
+ * Copy a value from the file.
+ *
+ * \param[out] value Value to read
+ * \param[in] data Position in the file
+ */
+template <typename T>
+void read_value(T &value, const char *data) {
+  std::memcpy(&value, data, sizeof(T));
+}
+}  // unnamed namespace
+
+ColumnarFileReader::ColumnarFileReader(const bf::path &path) {
+  const std::string name = path.native();
+  const int fd = ::open(name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open columnar file " + name + ": " +
+                             std::strerror(errno));
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Cannot get the size of " + name);
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  if (size_ < columnar_header_size + columnar_footer_size) {
+    ::close(fd);
+    throw std::runtime_error(name + " is too short to be a columnar file.");
+  }
+  void *mapped = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error("Cannot map columnar file " + name + ": " +
+                             std::strerror(errno));
+  }
+  data_ = static_cast<const char *>(mapped);
+
+  try {
+    std::uint32_t version, n_columns;
+    read_value(version, data_ + 8);
+    read_value(n_columns, data_ + 12);
+    if (std::memcmp(data_, columnar_magic, 8) != 0 ||
+        version != columnar_format_version ||
+        n_columns != static_cast<std::uint32_t>(n_columnar_columns)) {
+      throw std::runtime_error(name + " is no columnar file of version " +
+                               std::to_string(columnar_format_version) + ".");
+    }
+    const char *footer = data_ + size_ - columnar_footer_size;
+    std::uint64_t index_offset, n_events;
+    read_value(index_offset, footer);
+    read_value(n_events, footer + 8);
+    if (std::memcmp(footer + 16, columnar_index_magic, 8) != 0 ||
+        index_offset < columnar_header_size ||
+        n_events > size_ / sizeof(ColumnarEventInfo) ||
+        index_offset + n_events * sizeof(ColumnarEventInfo) !=
+            size_ - columnar_footer_size) {
+      throw std::runtime_error(name +
+                               " has no valid event index. Maybe it was not "
+                               "completely written.");
+    }
+    index_.resize(n_events);
+    if (n_events > 0) {
+      std::memcpy(&index_[0], data_ + index_offset,
+                  n_events * sizeof(ColumnarEventInfo));
+    }
+    for (const ColumnarEventInfo &info : index_) {
+      /* Every particle takes more than one byte, so the bounds on the offset
+       * and the number of particles keep the event size from overflowing. */
+      if (info.offset < columnar_header_size || info.offset % 8 != 0 ||
+          info.offset > index_offset || info.n_particles > size_ ||
+          columnar_event_size(info.n_particles) > index_offset - info.offset) {
+        throw std::runtime_error("The event index of " + name +
+                                 " points outside of the events.");
+      }
+    }
+  } catch (...) {
+    ::munmap(const_cast<char *>(data_), size_);
+    throw;
+  }
+}
+
+ColumnarFileReader::~ColumnarFileReader() {
+  ::munmap(const_cast<char *>(data_), size_);
+}
+
+const char *ColumnarFileReader::column_data(std::size_t i_event,
+                                            ColumnarColumn column) const {
+  const ColumnarEventInfo &info = index_.at(i_event);
+  return data_ + info.offset + columnar_column_offset(column, info.n_particles);
+}
+
+ConstSpan<double> ColumnarFileReader::double_column(
+    std::size_t i_event, ColumnarColumn column) const {
+  if (!columnar_column_is_double(column)) {
+    throw std::invalid_argument("The column consists of integers.");
+  }
+  const char *data = column_data(i_event, column);
+  return {reinterpret_cast<const double *>(data),
+          index_[i_event].n_particles * columnar_values_per_particle(column)};
+}
+
+ConstSpan<std::int32_t> ColumnarFileReader::int_column(
+    std::size_t i_event, ColumnarColumn column) const {
+  if (columnar_column_is_double(column)) {
+    throw std::invalid_argument("The column consists of doubles.");
+  }
+  const char *data = column_data(i_event, column);
+  return {reinterpret_cast<const std::int32_t *>(data),
+          index_[i_event].n_particles * columnar_values_per_particle(column)};
+}
+
+}  // namespace smash
@@ -0,0 +1,130 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/columnaroutput.h"
+
+#include <cstdio>
+
+#include "smash/particles.h"
+
+namespace smash {
+
+ColumnarOutput::ColumnarOutput(const bf::path &path, const std::string &name,
+                               const OutputParameters &)
+    : OutputInterface(name), file_{path / "particles_columnar.bin", "wb"} {
+  const std::uint32_t version = columnar_format_version;
+  const std::uint32_t n_columns = n_columnar_columns;
+  std::fwrite(columnar_magic, 1, 8, file_.get());
+  std::fwrite(&version, sizeof(version), 1, file_.get());
+  std::fwrite(&n_columns, sizeof(n_columns), 1, file_.get());
+  offset_ = columnar_header_size;
+}
+
+ColumnarOutput::~ColumnarOutput() {
+  const std::uint64_t index_offset = offset_;
+  const std::uint64_t n_events = index_.size();
+  if (!index_.empty()) {
+    std::fwrite(&index_[0], sizeof(ColumnarEventInfo), index_.size(),
+                file_.get());
+  }
+  std::fwrite(&index_offset, sizeof(index_offset), 1, file_.get());
+  std::fwrite(&n_events, sizeof(n_events), 1, file_.get());
+  std::fwrite(columnar_index_magic, 1, 8, file_.get());
+}
+
+template <typename T>
+void ColumnarOutput::write_column(const std::vector<T> &values) {
+  if (!values.empty()) {
+    std::fwrite(&values[0], sizeof(T), values.size(), file_.get());
+  }
+  offset_ += sizeof(T) * values.size();
+}
+
+void ColumnarOutput::at_eventend(const Particles &particles,
+                                 const int event_number,
+                                 const EventInfo &info) {
+  const std::size_t n = particles.size();
+  const std::uint64_t event_offset = offset_;
+  index_.push_back({event_offset, n, event_number, info.empty_event ? 1 : 0,
+                    info.impact_parameter});
+  for (int c = 0; c < n_columnar_columns; c++) {
+    const ColumnarColumn column = static_cast<ColumnarColumn>(c);
+    if (columnar_column_is_double(column)) {
+      doubles_.clear();
+      for (const ParticleData &p : particles) {
+        switch (column) {
+          case ColumnarColumn::Position:
+            doubles_.insert(doubles_.end(), p.position().begin(),
+                            p.position().end());
+            break;
+          case ColumnarColumn::Momentum:
+            doubles_.insert(doubles_.end(), p.momentum().begin(),
+                            p.momentum().end());
+            break;
+          case ColumnarColumn::Mass:
+            doubles_.push_back(p.effective_mass());
+            break;
+          case ColumnarColumn::FormationTime:
+            doubles_.push_back(p.formation_time());
+            break;
+          case ColumnarColumn::XsecScalingFactor:
+            doubles_.push_back(p.xsec_scaling_factor());
+            break;
+          case ColumnarColumn::TimeLastCollision:
+            doubles_.push_back(p.get_history().time_last_collision);
+            break;
+          default:
+            break;
+        }
+      }
+      write_column(doubles_);
+    } else {
+      ints_.clear();
+      for (const ParticleData &p : particles) {
+        const HistoryData h = p.get_history();
+        switch (column) {
+          case ColumnarColumn::Pdg:
+            ints_.push_back(p.pdgcode().get_decimal());
+            break;
+          case ColumnarColumn::Id:
+            ints_.push_back(p.id());
+            break;
+          case ColumnarColumn::Charge:
+            ints_.push_back(p.type().charge());
+            break;
+          case ColumnarColumn::Collisions:
+            ints_.push_back(h.collisions_per_particle);
+            break;
+          case ColumnarColumn::IdProcess:
+            ints_.push_back(h.id_process);
+            break;
+          case ColumnarColumn::ProcessType:
+            ints_.push_back(static_cast<std::int32_t>(h.process_type));
+            break;
+          case ColumnarColumn::PdgMother1:
+            ints_.push_back(h.p1.get_decimal());
+            break;
+          case ColumnarColumn::PdgMother2:
+            ints_.push_back(h.p2.get_decimal());
+            break;
+          default:
+            break;
+        }
+      }
+      write_column(ints_);
+    }
+  }
+  // Keep the next event aligned
+  const std::vector<char> padding(
+      event_offset + columnar_event_size(n) - offset_, 0);
+  write_column(padding);
+  std::fflush(file_.get());
+}
+
+}  // namespace smash
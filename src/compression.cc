@@ -0,0 +1,359 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/compression.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/filesystem/fstream.hpp>
+
+#ifdef SMASH_USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "smash/cxx14compat.h"
+#include "smash/logging.h"
+
+namespace smash {
+
+/*!\Userguide
+ * \page output_compression_ Compressed Output
+ * With \key Compression: "Zlib" in the \key Output section, the binary and
+ * OSCAR outputs are written compressed, and ".gz" is appended to their file
+ * names. Every event is compressed separately, as one member of a gzip file.
+ * Events of more than 4 MB are split over several members, such that they are
+ * not kept in memory as a whole. The files can be decompressed with the usual
+ * tools, e.g.
+ * \verbatim
+ zcat data/0/particle_lists.oscar.gz
+ \endverbatim
+ * and every event can be decompressed without the events before it. The
+ * compression runs on a separate thread for every file, while the simulation
+ * goes on. The list modus reads compressed particle lists directly, one member
+ * at a time, see \ref input_modi_list_.
+ *
+ * The compression needs zlib, which SMASH uses if it is found when SMASH is
+ * built.
+ */
+
+#ifdef SMASH_USE_ZLIB
+namespace {
+/// Maximal window size with a gzip header
+constexpr int zlib_window_bits = 15 + 16;
+/// Largest number of bytes that zlib takes at once
+constexpr std::size_t zlib_max_chunk = std::numeric_limits<uInt>::max();
+/// Size of the buffer for the output of zlib [bytes]
+constexpr uInt zlib_buffer_size = 1 << 16;
+
+/// Compresses every frame as one member of a gzip file.
+class ZlibCodec : public CompressionCodec {
+ public:
+  std::string extension() const override { return ".gz"; }
+
+  void compress(const char *data, std::size_t size,
+                std::string &frame) const override {
+    z_stream stream{};
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                     zlib_window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+      throw std::runtime_error("Cannot initialize the zlib compression.");
+    }
+    char out[zlib_buffer_size];
+    std::size_t done = 0;
+    int flush = Z_NO_FLUSH;
+    while (flush != Z_FINISH) {
+      const std::size_t chunk = std::min(size - done, zlib_max_chunk);
+      stream.next_in =
+          reinterpret_cast<Bytef *>(const_cast<char *>(data + done));
+      stream.avail_in = static_cast<uInt>(chunk);
+      done += chunk;
+      flush = done == size ? Z_FINISH : Z_NO_FLUSH;
+      do {
+        stream.next_out = reinterpret_cast<Bytef *>(out);
+        stream.avail_out = zlib_buffer_size;
+        deflate(&stream, flush);
+        frame.append(out, zlib_buffer_size - stream.avail_out);
+      } while (stream.avail_out == 0);
+    }
+    deflateEnd(&stream);
+  }
+
+  std::size_t decompress_frame(const char *data, std::size_t size,
+                               std::string &out) const override {
+    z_stream stream{};
+    if (inflateInit2(&stream, zlib_window_bits) != Z_OK) {
+      throw std::runtime_error("Cannot initialize the zlib decompression.");
+    }
+    char buffer[zlib_buffer_size];
+    std::size_t done = 0;
+    int status = Z_OK;
+    while (status != Z_STREAM_END) {
+      if (stream.avail_in == 0) {
+        const std::size_t chunk = std::min(size - done, zlib_max_chunk);
+        stream.next_in =
+            reinterpret_cast<Bytef *>(const_cast<char *>(data + done));
+        stream.avail_in = static_cast<uInt>(chunk);
+        done += chunk;
+      }
+      stream.next_out = reinterpret_cast<Bytef *>(buffer);
+      stream.avail_out = zlib_buffer_size;
+      status = inflate(&stream, Z_NO_FLUSH);
+      out.append(buffer, zlib_buffer_size - stream.avail_out);
+      if (status != Z_OK && status != Z_STREAM_END &&
+          !(status == Z_BUF_ERROR && done < size)) {
+        inflateEnd(&stream);
+        throw std::runtime_error(
+            "The compressed data is corrupt or incomplete.");
+      }
+    }
+    const std::size_t frame_size = done - stream.avail_in;
+    inflateEnd(&stream);
+    return frame_size;
+  }
+
+  bool decompress_frame(std::istream &in, std::string &out) const override {
+    z_stream stream{};
+    if (inflateInit2(&stream, zlib_window_bits) != Z_OK) {
+      throw std::runtime_error("Cannot initialize the zlib decompression.");
+    }
+    char input[zlib_buffer_size];
+    char buffer[zlib_buffer_size];
+    bool started = false;
+    int status = Z_OK;
+    while (status != Z_STREAM_END) {
+      if (stream.avail_in == 0) {
+        in.read(input, zlib_buffer_size);
+        const std::streamsize n_read = in.gcount();
+        if (n_read == 0) {
+          inflateEnd(&stream);
+          if (!started) {
+            return false;
+          }
+          throw std::runtime_error(
+              "The compressed data is corrupt or incomplete.");
+        }
+        started = true;
+        stream.next_in = reinterpret_cast<Bytef *>(input);
+        stream.avail_in = static_cast<uInt>(n_read);
+      }
+      stream.next_out = reinterpret_cast<Bytef *>(buffer);
+      stream.avail_out = zlib_buffer_size;
+      status = inflate(&stream, Z_NO_FLUSH);
+      out.append(buffer, zlib_buffer_size - stream.avail_out);
+      if (status != Z_OK && status != Z_STREAM_END &&
+          !(status == Z_BUF_ERROR && stream.avail_in == 0)) {
+        inflateEnd(&stream);
+        throw std::runtime_error(
+            "The compressed data is corrupt or incomplete.");
+      }
+    }
+    const std::streamoff unused = stream.avail_in;
+    inflateEnd(&stream);
+    // Give back what was read beyond the end of the frame.
+    in.clear();
+    in.seekg(-unused, std::ios::cur);
+    return true;
+  }
+};
+}  // unnamed namespace
+#endif
+
+std::unique_ptr<CompressionCodec> create_compression_codec(
+    const std::string &name) {
+  if (name == "None") {
+    return nullptr;
+  } else if (name == "Zlib") {
+#ifdef SMASH_USE_ZLIB
+    return make_unique<ZlibCodec>();
+#else
+    throw std::runtime_error(
+        "SMASH was built without zlib, so it cannot compress or decompress "
+        "files.");
+#endif
+  }
+  throw std::invalid_argument("Unknown compression \"" + name +
+                              "\". Use \"None\" or \"Zlib\".");
+}
+
+std::unique_ptr<CompressionCodec> detect_compression_codec(
+    const bf::path &path) {
+  bf::ifstream file{path, std::ios::binary};
+  char magic[2] = {0, 0};
+  file.read(magic, sizeof(magic));
+  if (file.gcount() == 2 && magic[0] == '\x1f' && magic[1] == '\x8b') {
+    return create_compression_codec("Zlib");
+  }
+  return nullptr;
+}
+
+std::string decompress_file(const bf::path &path,
+                            const CompressionCodec &codec) {
+  bf::ifstream file{path, std::ios::binary};
+  if (!file) {
+    throw std::runtime_error("Cannot open " + path.native());
+  }
+  std::string out;
+  while (codec.decompress_frame(file, out)) {
+  }
+  return out;
+}
+
+FrameDecompressor::FrameDecompressor(const bf::path &path,
+                                     std::unique_ptr<CompressionCodec> codec)
+    : file_(path, std::ios::binary), codec_(std::move(codec)) {
+  if (!file_) {
+    throw std::runtime_error("Cannot open " + path.native());
+  }
+  set_get_area(0);
+}
+
+bool FrameDecompressor::read_frame() {
+  const std::size_t offset = gptr() - eback();
+  const bool found = codec_->decompress_frame(file_, data_);
+  set_get_area(offset);
+  return found;
+}
+
+void FrameDecompressor::set_get_area(std::size_t offset) {
+  char *begin = &data_[0];
+  setg(begin, begin + offset, begin + data_.size());
+}
+
+FrameDecompressor::int_type FrameDecompressor::underflow() {
+  while (gptr() == egptr()) {
+    if (!read_frame()) {
+      return traits_type::eof();
+    }
+  }
+  return traits_type::to_int_type(*gptr());
+}
+
+FrameDecompressor::pos_type FrameDecompressor::seekoff(
+    off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+  const std::streamoff current = data_start_ + (gptr() - eback());
+  if (dir == std::ios_base::cur && off == 0) {
+    // Only the position is asked for, so nothing is forgotten.
+    return pos_type(current);
+  } else if (dir == std::ios_base::cur) {
+    return seekpos(pos_type(current + off), which);
+  } else if (dir == std::ios_base::beg) {
+    return seekpos(pos_type(off), which);
+  }
+  return pos_type(off_type(-1));
+}
+
+FrameDecompressor::pos_type FrameDecompressor::seekpos(
+    pos_type pos, std::ios_base::openmode which) {
+  const std::streamoff target = pos;
+  if (!(which & std::ios_base::in) || target < 0) {
+    return pos_type(off_type(-1));
+  }
+  if (target < data_start_) {
+    file_.clear();
+    file_.seekg(0);
+    data_.clear();
+    data_start_ = 0;
+  }
+  set_get_area(0);
+  while (target > data_start_ + static_cast<std::streamoff>(data_.size())) {
+    data_start_ += data_.size();
+    data_.clear();
+    if (!read_frame()) {
+      return pos_type(off_type(-1));
+    }
+  }
+  data_.erase(0, target - data_start_);
+  data_start_ = target;
+  set_get_area(0);
+  return pos;
+}
+
+namespace {
+/**
+ * Pass the data written to the collecting file on to the compressor.
+ *
+ * \param[in] cookie The compressor
+ * \param[in] data Data to write
+ * \param[in] size Size of the data [bytes]
+ * \return Number of bytes written
+ */
+#if defined(__APPLE__) || defined(__FreeBSD__)
+int write_to_compressor(void *cookie, const char *data, int size) {
+  static_cast<FrameCompressor *>(cookie)->append(data, size);
+  return size;
+}
+#else
+ssize_t write_to_compressor(void *cookie, const char *data, std::size_t size) {
+  static_cast<FrameCompressor *>(cookie)->append(data, size);
+  return size;
+}
+#endif
+}  // unnamed namespace
+
+FrameCompressor::FrameCompressor(std::FILE *target,
+                                 std::unique_ptr<CompressionCodec> codec,
+                                 std::size_t max_frame_size)
+    : target_(target),
+      codec_(std::move(codec)),
+      max_frame_size_(max_frame_size),
+      // The simulation waits, once this many frames are pending.
+      writer_(4) {
+#if defined(__APPLE__) || defined(__FreeBSD__)
+  collector_ = funopen(this, nullptr, &write_to_compressor, nullptr, nullptr);
+#else
+  cookie_io_functions_t functions = {nullptr, &write_to_compressor, nullptr,
+                                     nullptr};
+  collector_ = fopencookie(this, "w", functions);
+#endif
+  if (collector_ == nullptr) {
+    throw std::runtime_error("Cannot create the file for the compression.");
+  }
+}
+
+FrameCompressor::~FrameCompressor() {
+  std::fclose(collector_);
+  try {
+    submit_frame();
+    writer_.flush();
+  } catch (std::exception &e) {
+    logg[LOutput].error() << "Writing the compressed output failed: "
+                          << e.what();
+  }
+}
+
+void FrameCompressor::append(const char *data, std::size_t size) {
+  frame_.append(data, size);
+  if (frame_.size() >= max_frame_size_) {
+    submit_frame();
+  }
+}
+
+void FrameCompressor::end_frame() {
+  std::fflush(collector_);
+  submit_frame();
+}
+
+void FrameCompressor::submit_frame() {
+  if (frame_.empty()) {
+    return;
+  }
+  auto data = std::make_shared<std::string>();
+  data->swap(frame_);
+  writer_.push([this, data] {
+    compressed_.clear();
+    codec_->compress(data->data(), data->size(), compressed_);
+    if (std::fwrite(compressed_.data(), 1, compressed_.size(), target_) !=
+        compressed_.size()) {
+      throw std::runtime_error("Cannot write the compressed output.");
+    }
+  });
+}
+
+}  // namespace smash
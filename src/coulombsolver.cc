@@ -0,0 +1,205 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/coulombsolver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "smash/constants.h"
+#include "smash/parallel.h"
+
+namespace smash {
+
+namespace {
+/**
+ * \param[in] n_cells Number of lattice nodes in x, y and z direction
+ * \param[in] periodic Whether the lattice is periodic
+ * \return Number of points of the Fourier transforms in every direction
+ */
+std::array<int, 3> padded_dims(const std::array<int, 3> &n_cells,
+                               bool periodic) {
+  if (periodic) {
+    return n_cells;
+  }
+  // Separations range from -(n - 1) to n - 1, which must not wrap around.
+  std::array<int, 3> dims;
+  for (int dir = 0; dir < 3; dir++) {
+    dims[dir] = 1;
+    while (dims[dir] < 2 * n_cells[dir] - 1) {
+      dims[dir] *= 2;
+    }
+  }
+  return dims;
+}
+
+/**
+ * \param[in] k Index of a point of a cyclic Fourier transform, can be negative
+ * \param[in] m Length of the Fourier transform
+ * \return Equivalent index in [0, m)
+ */
+int wrap_index(int k, int m) { return (k % m + m) % m; }
+}  // unnamed namespace
+
+CoulombFieldSolver::CoulombFieldSolver(const std::array<int, 3> &n_cells,
+                                       const std::array<double, 3> &cell_sizes,
+                                       bool periodic, double r_cut)
+    : n_cells_(n_cells),
+      periodic_(periodic),
+      fft_(padded_dims(n_cells, periodic)) {
+  const std::array<int, 3> &m = fft_.dims();
+  const int size = fft_.size();
+  std::array<int, 3> max_offset;
+  for (int dir = 0; dir < 3; dir++) {
+    max_offset[dir] =
+        static_cast<int>(std::floor(r_cut / cell_sizes[dir] + really_small));
+    if (!periodic) {
+      max_offset[dir] = std::min(max_offset[dir], n_cells[dir] - 1);
+    }
+  }
+  const double prefactor =
+      elementary_charge * cell_sizes[0] * cell_sizes[1] * cell_sizes[2];
+
+  /* The kernel components are transformed as x + i y and z; offsets beyond
+   * the length of a periodic lattice are folded back onto it, which adds up
+   * all periodic images. */
+  std::vector<std::complex<double>> kernel_xy(size, 0.), kernel_z(size, 0.);
+  for (int dz = -max_offset[2]; dz <= max_offset[2]; dz++) {
+    for (int dy = -max_offset[1]; dy <= max_offset[1]; dy++) {
+      for (int dx = -max_offset[0]; dx <= max_offset[0]; dx++) {
+        if (dx == 0 && dy == 0 && dz == 0) {
+          continue;
+        }
+        const ThreeVector d(dx * cell_sizes[0], dy * cell_sizes[1],
+                            dz * cell_sizes[2]);
+        const ThreeVector k = prefactor * d / std::pow(d.abs(), 3);
+        const int index = transform_index(
+            wrap_index(dx, m[0]), wrap_index(dy, m[1]), wrap_index(dz, m[2]));
+        kernel_xy[index] += std::complex<double>(k.x1(), k.x2());
+        kernel_z[index] += k.x3();
+      }
+    }
+  }
+  fft_.forward(kernel_xy);
+  fft_.forward(kernel_z);
+  // The transform of a real, odd function f is i Im(f), so K(-k) = -K(k).
+  for (std::vector<double> &component : kernel_) {
+    component.resize(size);
+  }
+  for (int kz = 0; kz < m[2]; kz++) {
+    for (int ky = 0; ky < m[1]; ky++) {
+      for (int kx = 0; kx < m[0]; kx++) {
+        const int index = transform_index(kx, ky, kz);
+        const std::complex<double> sum = kernel_xy[index];
+        const std::complex<double> diff = std::conj(kernel_xy[transform_index(
+            wrap_index(-kx, m[0]), wrap_index(-ky, m[1]),
+            wrap_index(-kz, m[2]))]);
+        kernel_[0][index] = 0.5 * (sum + diff).imag();
+        kernel_[1][index] = 0.5 * (diff - sum).real();
+        kernel_[2][index] = kernel_z[index].imag();
+      }
+    }
+  }
+  for (std::vector<std::complex<double>> &buffer : sources_) {
+    buffer.resize(size);
+  }
+  for (std::vector<std::complex<double>> &buffer : fields_) {
+    buffer.resize(size);
+  }
+}
+
+void CoulombFieldSolver::compute_fields(
+    const RectangularLattice<DensityOnLattice> &jmu_el,
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> &em_lat,
+    int n_threads) {
+  if (jmu_el.n_cells() != n_cells_ || em_lat.n_cells() != n_cells_ ||
+      jmu_el.periodic() != periodic_ || em_lat.periodic() != periodic_) {
+    throw std::invalid_argument(
+        "CoulombFieldSolver was set up for a different lattice");
+  }
+  const std::array<int, 3> &m = fft_.dims();
+  const int n_xy = n_cells_[0] * n_cells_[1];
+  const int n_nodes = n_xy * n_cells_[2];
+
+  // Sources: the padding stays empty.
+  for (std::vector<std::complex<double>> &buffer : sources_) {
+    std::fill(buffer.begin(), buffer.end(), 0.);
+  }
+  parallel_for_blocks(n_nodes, n_threads, [&](int begin, int end, int) {
+    for (int node = begin; node < end; node++) {
+      const int index = transform_index(node % n_cells_[0],
+                                        (node / n_cells_[0]) % n_cells_[1],
+                                        node / n_xy);
+      DensityOnLattice charge = jmu_el[node];
+      const ThreeVector j = charge.jmu_net().threevec();
+      sources_[0][index] = std::complex<double>(charge.rho(), j.x1());
+      sources_[1][index] = std::complex<double>(j.x2(), j.x3());
+    }
+  });
+  fft_.forward(sources_[0], n_threads);
+  fft_.forward(sources_[1], n_threads);
+
+  /* The real sources are separated from the packed transforms with
+   * F(-k) = conj(F(k)); all fields are real again, which allows packing two
+   * of them into every inverse transform. */
+  const std::complex<double> i(0., 1.);
+  parallel_for_blocks(m[2], n_threads, [&](int begin, int end, int) {
+    for (int kz = begin; kz < end; kz++) {
+      for (int ky = 0; ky < m[1]; ky++) {
+        for (int kx = 0; kx < m[0]; kx++) {
+          const int index = transform_index(kx, ky, kz);
+          const int neg_index = transform_index(wrap_index(-kx, m[0]),
+                                                wrap_index(-ky, m[1]),
+                                                wrap_index(-kz, m[2]));
+          const std::complex<double> s0 = sources_[0][index],
+                                     s1 = sources_[1][index];
+          const std::complex<double> s0_neg = std::conj(sources_[0][neg_index]),
+                                     s1_neg = std::conj(sources_[1][neg_index]);
+          const std::complex<double> rho = 0.5 * (s0 + s0_neg);
+          const std::complex<double> jx = -0.5 * i * (s0 - s0_neg);
+          const std::complex<double> jy = 0.5 * (s1 + s1_neg);
+          const std::complex<double> jz = -0.5 * i * (s1 - s1_neg);
+          const double kx_im = kernel_[0][index];
+          const double ky_im = kernel_[1][index];
+          const double kz_im = kernel_[2][index];
+          // Transformed kernel is i k_im, so products are i k_im times source
+          const std::complex<double> ex = i * kx_im * rho;
+          const std::complex<double> ey = i * ky_im * rho;
+          const std::complex<double> ez = i * kz_im * rho;
+          const std::complex<double> bx = i * (jy * kz_im - jz * ky_im);
+          const std::complex<double> by = i * (jz * kx_im - jx * kz_im);
+          const std::complex<double> bz = i * (jx * ky_im - jy * kx_im);
+          fields_[0][index] = ex + i * ey;
+          fields_[1][index] = ez + i * bx;
+          fields_[2][index] = by + i * bz;
+        }
+      }
+    }
+  });
+  for (std::vector<std::complex<double>> &buffer : fields_) {
+    fft_.inverse(buffer, n_threads);
+  }
+
+  parallel_for_blocks(n_nodes, n_threads, [&](int begin, int end, int) {
+    for (int node = begin; node < end; node++) {
+      const int index = transform_index(node % n_cells_[0],
+                                        (node / n_cells_[0]) % n_cells_[1],
+                                        node / n_xy);
+      const std::complex<double> f0 = fields_[0][index];
+      const std::complex<double> f1 = fields_[1][index];
+      const std::complex<double> f2 = fields_[2][index];
+      em_lat[node] =
+          std::make_pair(ThreeVector(f0.real(), f0.imag(), f1.real()),
+                         ThreeVector(f1.imag(), f2.real(), f2.imag()));
+    }
+  });
+}
+
+}  // namespace smash
@@ -11,6 +11,7 @@
 
 #include "smash/clebschgordan.h"
 #include "smash/constants.h"
+#include "smash/decaymodes.h"
 #include "smash/logging.h"
 #include "smash/parametrizations.h"
 #include "smash/pow.h"
@@ -191,6 +192,29 @@ CollisionBranchList CrossSections::generate_collision_list(
   return process_list;
 }
 
+CollisionBranchList CrossSections::generate_elastic_and_resonance_list(
+    double elastic_parameter, bool include_elastic, double low_snn_cut,
+    bool use_AQM, const ParticleTypePtrList& resonances, double scale_xs,
+    double additional_el_xs) const {
+  CollisionBranchList process_list;
+  const ParticleType& t1 = incoming_particles_[0].type();
+  const ParticleType& t2 = incoming_particles_[1].type();
+
+  /* Elastic collisions between two nucleons with sqrt_s below
+   * low_snn_cut can not happen. */
+  const bool reject_by_nucleon_elastic_cutoff =
+      t1.is_nucleon() && t2.is_nucleon() &&
+      t1.antiparticle_sign() == t2.antiparticle_sign() && sqrt_s_ < low_snn_cut;
+  if (include_elastic && !reject_by_nucleon_elastic_cutoff) {
+    process_list.emplace_back(
+        elastic(elastic_parameter, use_AQM, additional_el_xs, scale_xs));
+  }
+  if (!resonances.empty()) {
+    append_list(process_list, two_to_one(resonances), scale_xs);
+  }
+  return process_list;
+}
+
 CollisionBranchPtr CrossSections::elastic(double elast_par, bool use_AQM,
                                           double add_el_xs,
                                           double scale_xs) const {
@@ -737,22 +761,73 @@ CollisionBranchList CrossSections::two_to_one(
       continue;
     }
 
-    double resonance_xsection = formation(type_resonance, p_cm_sqr);
+    append_formation(resonance_process_list, type_resonance, p_cm_sqr);
+  }
+  return resonance_process_list;
+}
 
-    // If cross section is non-negligible, add resonance to the list
-    if (resonance_xsection > really_small) {
-      resonance_process_list.push_back(make_unique<CollisionBranch>(
-          type_resonance, resonance_xsection, ProcessType::TwoToOne));
-      logg[LCrossSections].debug("Found resonance: ", type_resonance);
-      logg[LCrossSections].debug(type_particle_a.name(), type_particle_b.name(),
-                                 "->", type_resonance.name(),
-                                 " at sqrt(s)[GeV] = ", sqrt_s_,
-                                 " with xs[mb] = ", resonance_xsection);
-    }
+CollisionBranchList CrossSections::two_to_one(
+    const ParticleTypePtrList& resonances) const {
+  CollisionBranchList resonance_process_list;
+  const double m1 = incoming_particles_[0].effective_mass();
+  const double m2 = incoming_particles_[1].effective_mass();
+  const double p_cm_sqr = pCM_sqr(sqrt_s_, m1, m2);
+  for (const ParticleTypePtr type_resonance : resonances) {
+    append_formation(resonance_process_list, *type_resonance, p_cm_sqr);
   }
   return resonance_process_list;
 }
 
+void CrossSections::append_formation(CollisionBranchList& process_list,
+                                     const ParticleType& type_resonance,
+                                     double cm_momentum_sqr) const {
+  const double resonance_xsection = formation(type_resonance, cm_momentum_sqr);
+
+  // If cross section is non-negligible, add resonance to the list
+  if (resonance_xsection > really_small) {
+    process_list.push_back(make_unique<CollisionBranch>(
+        type_resonance, resonance_xsection, ProcessType::TwoToOne));
+    logg[LCrossSections].debug("Found resonance: ", type_resonance);
+    logg[LCrossSections].debug(incoming_particles_[0].type().name(),
+                               incoming_particles_[1].type().name(), "->",
+                               type_resonance.name(), " at sqrt(s)[GeV] = ",
+                               sqrt_s_, " with xs[mb] = ", resonance_xsection);
+  }
+}
+
+std::vector<ParticleTypePtrList> CrossSections::resonance_formation_table() {
+  const ParticleTypeList& all_types = ParticleType::list_all();
+  const size_t n = all_types.size();
+  const auto offset = [&all_types](ParticleTypePtr type) -> size_t {
+    return std::addressof(*type) - std::addressof(all_types[0]);
+  };
+  std::vector<ParticleTypePtrList> table(n * n);
+  for (const ParticleType& type_resonance : all_types) {
+    if (type_resonance.is_stable()) {
+      continue;
+    }
+    const ParticleTypePtr resonance = &type_resonance;
+    for (const auto& mode : type_resonance.decay_modes().decay_mode_list()) {
+      const ParticleTypePtrList& products = mode->type().particle_types();
+      // Only two-body modes contribute to the partial in-width, and the
+      // resonance is never formed from itself
+      if (products.size() != 2 || products[0] == resonance ||
+          products[1] == resonance) {
+        continue;
+      }
+      const size_t a = offset(products[0]);
+      const size_t b = offset(products[1]);
+      for (const size_t index : {a * n + b, b * n + a}) {
+        // A resonance can have several modes into the same pair
+        if (table[index].empty() || table[index].back() != resonance) {
+          table[index].push_back(resonance);
+        }
+      }
+    }
+  }
+  return table;
+}
+
 double CrossSections::formation(const ParticleType& type_resonance,
                                 double cm_momentum_sqr) const {
   const ParticleType& type_particle_a = incoming_particles_[0].type();
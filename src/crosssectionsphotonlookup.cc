@@ -0,0 +1,573 @@
+/*
+ *
+ *    Copyright (c) 2020
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <boost/filesystem.hpp>
+
+#include "smash/constants.h"
+#include "smash/crosssectionsphoton.h"
+#include "smash/filelock.h"
+#include "smash/logging.h"
+#include "smash/tabulation.h"
+
+namespace smash {
+static constexpr int LCrossSections = LogArea::CrossSections::id;
+
+namespace {
+
+/// Shorthand for the analytic cross sections the tables are created from.
+using Analytic = CrosssectionsPhoton<ComputationMethod::Analytic>;
+
+/// Kinematics of a photon process, determining threshold and t range.
+enum class PhotonKinematics {
+  /// pi + pi -> rho + gamma
+  PiPiToRho,
+  /// pi + rho -> pi + gamma
+  PiRhoToPi,
+};
+
+/// A tabulated total cross section.
+struct TotalChannel {
+  /// name of the channel, used for the file name of the table
+  const char *name;
+  /// kinematics of the channel
+  PhotonKinematics kinematics;
+  /// whether the channel has an omega in the s-channel
+  bool omega_s_channel;
+  /// analytic cross section
+  double (*analytic)(double, double);
+};
+
+/// A tabulated differential cross section.
+struct DiffChannel {
+  /// name of the channel, used for the file name of the table
+  const char *name;
+  /// kinematics of the channel
+  PhotonKinematics kinematics;
+  /// whether the channel has an omega in the s-channel
+  bool omega_s_channel;
+  /// analytic cross section
+  double (*analytic)(double, double, double);
+};
+
+/// Indices of the total cross sections in total_channels.
+enum TotalIndex : size_t {
+  Total_pi_pi_rho0,
+  Total_pi_pi0_rho,
+  Total_pi0_rho0_pi0,
+  Total_pi_rho0_pi,
+  Total_pi_rho_pi0,
+  Total_pi_rho_pi0_rho_mediated,
+  Total_pi_rho_pi0_omega_mediated,
+  Total_pi0_rho_pi,
+  Total_pi0_rho_pi_rho_mediated,
+  Total_pi0_rho_pi_omega_mediated,
+  N_Total
+};
+
+/// Indices of the differential cross sections in diff_channels.
+enum DiffIndex : size_t {
+  Diff_pi_pi_rho0,
+  Diff_pi_pi0_rho,
+  Diff_pi0_rho0_pi0,
+  Diff_pi_rho0_pi,
+  Diff_pi_rho_pi0_rho_mediated,
+  Diff_pi_rho_pi0_omega_mediated,
+  Diff_pi0_rho_pi_rho_mediated,
+  Diff_pi0_rho_pi_omega_mediated,
+  N_Diff
+};
+
+/// All tabulated total cross sections, ordered like TotalIndex.
+const std::array<TotalChannel, N_Total> total_channels = {{
+    {"pi_pi_rho0", PhotonKinematics::PiPiToRho, false,
+     Analytic::xs_pi_pi_rho0},
+    {"pi_pi0_rho", PhotonKinematics::PiPiToRho, false,
+     Analytic::xs_pi_pi0_rho},
+    {"pi0_rho0_pi0", PhotonKinematics::PiRhoToPi, true,
+     Analytic::xs_pi0_rho0_pi0},
+    {"pi_rho0_pi", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_pi_rho0_pi},
+    {"pi_rho_pi0", PhotonKinematics::PiRhoToPi, true,
+     Analytic::xs_pi_rho_pi0},
+    {"pi_rho_pi0_rho_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_pi_rho_pi0_rho_mediated},
+    {"pi_rho_pi0_omega_mediated", PhotonKinematics::PiRhoToPi, true,
+     Analytic::xs_pi_rho_pi0_omega_mediated},
+    {"pi0_rho_pi", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_pi0_rho_pi},
+    {"pi0_rho_pi_rho_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_pi0_rho_pi_rho_mediated},
+    {"pi0_rho_pi_omega_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_pi0_rho_pi_omega_mediated},
+}};
+
+/// All tabulated differential cross sections, ordered like DiffIndex.
+const std::array<DiffChannel, N_Diff> diff_channels = {{
+    {"pi_pi_rho0", PhotonKinematics::PiPiToRho, false,
+     Analytic::xs_diff_pi_pi_rho0},
+    {"pi_pi0_rho", PhotonKinematics::PiPiToRho, false,
+     Analytic::xs_diff_pi_pi0_rho},
+    {"pi0_rho0_pi0", PhotonKinematics::PiRhoToPi, true,
+     Analytic::xs_diff_pi0_rho0_pi0},
+    {"pi_rho0_pi", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_diff_pi_rho0_pi},
+    {"pi_rho_pi0_rho_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_diff_pi_rho_pi0_rho_mediated},
+    {"pi_rho_pi0_omega_mediated", PhotonKinematics::PiRhoToPi, true,
+     Analytic::xs_diff_pi_rho_pi0_omega_mediated},
+    {"pi0_rho_pi_rho_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_diff_pi0_rho_pi_rho_mediated},
+    {"pi0_rho_pi_omega_mediated", PhotonKinematics::PiRhoToPi, false,
+     Analytic::xs_diff_pi0_rho_pi_omega_mediated},
+}};
+
+/*
+ * Grids of the tables. Collisions with a larger sqrt(s) or rho mass are rare
+ * and fall back to the analytic formulas. The differential cross sections
+ * are tabulated in v instead of t, see t_from_grid().
+ */
+/// sqrt(s) axis of the total cross sections [GeV]
+const GridTabulation::Axis total_sqrts_axis = {0.27, 3.03, 276};
+/// rho mass axis of the total cross sections [GeV]
+const GridTabulation::Axis total_m_rho_axis = {0.27, 1.47, 120};
+/// sqrt(s) axis of the differential cross sections [GeV]
+const GridTabulation::Axis diff_sqrts_axis = {0.27, 3.03, 138};
+/// normalized t axis of the differential cross sections
+const GridTabulation::Axis diff_v_axis = {0.0, 1.0, 64};
+/// rho mass axis of the differential cross sections [GeV]
+const GridTabulation::Axis diff_m_rho_axis = {0.27, 1.47, 60};
+
+/// Tables of the total cross sections, ordered like TotalIndex.
+std::array<GridTabulation, N_Total> total_tabulations;
+
+/// Tables of the differential cross sections, ordered like DiffIndex.
+std::array<GridTabulation, N_Diff> diff_tabulations;
+
+/**
+ * \param[in] kinematics Kinematics of the photon process.
+ * \param[in] sqrts Center-of-mass energy [GeV].
+ * \param[in] m_rho Mass of the participating rho meson [GeV].
+ * \return Whether the process is kinematically allowed and the analytic
+ *         cross sections can be evaluated.
+ */
+bool above_threshold(PhotonKinematics kinematics, double sqrts, double m_rho) {
+  const double threshold = kinematics == PhotonKinematics::PiPiToRho
+                               ? std::max(2 * pion_mass, m_rho)
+                               : pion_mass + m_rho;
+  return sqrts > threshold + really_small;
+}
+
+/**
+ * \param[in] kinematics Kinematics of the photon process.
+ * \param[in] sqrts Center-of-mass energy [GeV].
+ * \param[in] m_rho Mass of the participating rho meson [GeV].
+ * \return Range of Mandelstam-t as given by get_t_range: {t_max, t_min}.
+ */
+std::array<double, 2> photon_t_range(PhotonKinematics kinematics, double sqrts,
+                                     double m_rho) {
+  return kinematics == PhotonKinematics::PiPiToRho
+             ? get_t_range(sqrts, pion_mass, pion_mass, m_rho, 0.)
+             : get_t_range(sqrts, pion_mass, m_rho, pion_mass, 0.);
+}
+
+/**
+ * Map the grid variable of the differential cross sections onto t. The
+ * mapping \f$ t = t_{min} + (t_{max} - t_{min}) (1 - \cos(\pi v)) / 2 \f$
+ * places more grid points near the edges of the t range, where the
+ * differential cross sections are peaked by the pion exchange.
+ *
+ * \param[in] t_range Range of Mandelstam-t: {t_max, t_min} [GeV^2].
+ * \param[in] v Grid variable between 0 and 1.
+ * \return Mandelstam-t [GeV^2].
+ */
+double t_from_grid(const std::array<double, 2> &t_range, double v) {
+  const double u = 0.5 * (1. - std::cos(M_PI * v));
+  return t_range[1] + u * (t_range[0] - t_range[1]);
+}
+
+/**
+ * Inverse of t_from_grid().
+ *
+ * \param[in] t_range Range of Mandelstam-t: {t_max, t_min} [GeV^2].
+ * \param[in] t Mandelstam-t within the range [GeV^2].
+ * \return Grid variable between 0 and 1.
+ */
+double grid_from_t(const std::array<double, 2> &t_range, double t) {
+  const double u = (t - t_range[1]) / (t_range[0] - t_range[1]);
+  return std::acos(1. - 2. * std::min(std::max(u, 0.), 1.)) / M_PI;
+}
+
+/**
+ * \param[in] axis Axis of a table.
+ * \param[in] x Argument along the axis.
+ * \return The closest grid point of the axis below x.
+ */
+double lower_node(const GridTabulation::Axis &axis, double x) {
+  const double d = (axis.max - axis.min) / axis.num;
+  return axis.min + std::floor((x - axis.min) / d) * d;
+}
+
+/**
+ * Check whether the tabulated values can be interpolated at (sqrts, m_rho).
+ *
+ * This is not the case close to the kinematic threshold, where the cross
+ * sections diverge. All corners of the grid cell containing (sqrts, m_rho) and
+ * of the cell below have to be above the threshold. The threshold grows with
+ * the rho mass, so it is sufficient to check the corner with the smallest
+ * sqrt(s) and the largest rho mass. The omega in the s-channel opens at the
+ * omega mass and diverges there as well, so a window above the omega mass is
+ * excluded for the corresponding channels.
+ *
+ * \param[in] channel The tabulated cross section.
+ * \param[in] sqrts_axis sqrt(s) axis of the table.
+ * \param[in] m_rho_axis Rho mass axis of the table.
+ * \param[in] sqrts Center-of-mass energy [GeV].
+ * \param[in] m_rho Mass of the participating rho meson [GeV].
+ * \return Whether the tabulated values can be interpolated.
+ */
+template <typename Channel>
+bool can_interpolate(const Channel &channel,
+                     const GridTabulation::Axis &sqrts_axis,
+                     const GridTabulation::Axis &m_rho_axis, double sqrts,
+                     double m_rho) {
+  const double d_sqrts = (sqrts_axis.max - sqrts_axis.min) / sqrts_axis.num;
+  const double d_m_rho = (m_rho_axis.max - m_rho_axis.min) / m_rho_axis.num;
+  if (channel.omega_s_channel) {
+    constexpr double omega_window = 0.1;  // [GeV]
+    if (sqrts > omega_mass - d_sqrts &&
+        sqrts < omega_mass + omega_window + d_sqrts) {
+      return false;
+    }
+  }
+  return above_threshold(channel.kinematics,
+                         lower_node(sqrts_axis, sqrts) - d_sqrts,
+                         lower_node(m_rho_axis, m_rho) + d_m_rho);
+}
+
+/**
+ * Create the table of a total cross section. Grid points below the threshold
+ * are set to zero, they are never interpolated.
+ *
+ * \param[in] channel The tabulated cross section.
+ * \return The table.
+ */
+GridTabulation tabulate_total(const TotalChannel &channel) {
+  return GridTabulation(
+      total_sqrts_axis, total_m_rho_axis, [&](double sqrts, double m_rho) {
+        if (!above_threshold(channel.kinematics, sqrts, m_rho)) {
+          return 0.;
+        }
+        return channel.analytic(sqrts * sqrts, m_rho);
+      });
+}
+
+/**
+ * Create the table of a differential cross section. Grid points below the
+ * threshold are set to zero, they are never interpolated.
+ *
+ * \param[in] channel The tabulated cross section.
+ * \return The table.
+ */
+GridTabulation tabulate_diff(const DiffChannel &channel) {
+  return GridTabulation(
+      diff_sqrts_axis, diff_v_axis, diff_m_rho_axis,
+      [&](double sqrts, double v, double m_rho) {
+        if (!above_threshold(channel.kinematics, sqrts, m_rho)) {
+          return 0.;
+        }
+        const auto t_range = photon_t_range(channel.kinematics, sqrts, m_rho);
+        const double t = t_from_grid(t_range, v);
+        // dsigma/dt diverges like 1/(t_max - t_min) at the threshold, the
+        // product is much smoother
+        return (t_range[0] - t_range[1]) *
+               channel.analytic(sqrts * sqrts, t, m_rho);
+      });
+}
+
+/**
+ * Look up a total cross section, falling back to the analytic formula where
+ * the table cannot be used.
+ *
+ * \param[in] index Index of the cross section.
+ * \param[in] s Mandelstam-s [GeV^2]
+ * \param[in] m_rho Mass of participating rho-meson [GeV]
+ * \return photon cross-section [mb]
+ */
+double lookup_total(TotalIndex index, double s, double m_rho) {
+  const TotalChannel &channel = total_channels[index];
+  const GridTabulation &tab = total_tabulations[index];
+  const double sqrts = std::sqrt(s);
+  if (tab.is_empty() || !tab.contains(sqrts, m_rho) ||
+      !can_interpolate(channel, total_sqrts_axis, total_m_rho_axis, sqrts,
+                       m_rho)) {
+    return channel.analytic(s, m_rho);
+  }
+  return tab.get_value_linear(sqrts, m_rho);
+}
+
+/**
+ * Look up a differential cross section, falling back to the analytic formula
+ * where the table cannot be used.
+ *
+ * \param[in] index Index of the cross section.
+ * \param[in] s Mandelstam-s [GeV^2]
+ * \param[in] t Mandelstam-t [GeV^2]
+ * \param[in] m_rho Mass of participating rho-meson [GeV]
+ * \return photon cross-section [mb]
+ */
+double lookup_diff(DiffIndex index, double s, double t, double m_rho) {
+  const DiffChannel &channel = diff_channels[index];
+  const GridTabulation &tab = diff_tabulations[index];
+  const double sqrts = std::sqrt(s);
+  if (tab.is_empty() || !tab.contains(sqrts, 0., m_rho) ||
+      !can_interpolate(channel, diff_sqrts_axis, diff_m_rho_axis, sqrts,
+                       m_rho)) {
+    return channel.analytic(s, t, m_rho);
+  }
+  const auto t_range = photon_t_range(channel.kinematics, sqrts, m_rho);
+  const double dt = t_range[0] - t_range[1];
+  // t outside of the physical range, e.g. for off-shell pions
+  if (t < t_range[1] - really_small * dt ||
+      t > t_range[0] + really_small * dt) {
+    return channel.analytic(s, t, m_rho);
+  }
+  return tab.get_value_linear(sqrts, grid_from_t(t_range, t), m_rho) / dt;
+}
+
+/**
+ * Deviation of a table from the analytic formula, accumulated over the
+ * sampled points.
+ */
+struct Deviation {
+  /// number of sampled points
+  size_t n = 0;
+  /// largest absolute deviation [mb or mb/GeV^2]
+  double max_abs = 0.;
+  /// largest relative deviation
+  double max_rel = 0.;
+  /// sum of the relative deviations
+  double sum_rel = 0.;
+
+  /**
+   * Add a sampled point.
+   *
+   * \param[in] tabulated Interpolated value.
+   * \param[in] analytic Value of the analytic formula.
+   */
+  void add(double tabulated, double analytic) {
+    // Vanishing cross sections are not relevant for the relative deviation.
+    constexpr double min_relevant_xs = 1e-3;
+    const double diff = std::abs(tabulated - analytic);
+    max_abs = std::max(max_abs, diff);
+    if (std::abs(analytic) > min_relevant_xs) {
+      const double rel = diff / std::abs(analytic);
+      max_rel = std::max(max_rel, rel);
+      sum_rel += rel;
+      n++;
+    }
+  }
+};
+
+}  // unnamed namespace
+
+void CrosssectionsPhoton<ComputationMethod::Lookup>::tabulate(
+    sha256::Hash hash, const bf::path &tabulations_path) {
+  // To avoid race conditions, make sure we are the only ones currently storing
+  // tabulations. Otherwise, we ignore any stored tabulations and don't store
+  // our results.
+  FileLock lock(tabulations_path / "tabulations.lock");
+  const bf::path &dir = lock.acquire() ? tabulations_path : "";
+
+  bool created = false;
+  for (size_t i = 0; i < N_Total; i++) {
+    const TotalChannel &channel = total_channels[i];
+    total_tabulations[i] = cache_tabulation<GridTabulation>(
+        dir, std::string("photon_xs_") + channel.name + ".bin", hash,
+        [&]() { return tabulate_total(channel); }, &created);
+  }
+  for (size_t i = 0; i < N_Diff; i++) {
+    const DiffChannel &channel = diff_channels[i];
+    diff_tabulations[i] = cache_tabulation<GridTabulation>(
+        dir, std::string("photon_xs_diff_") + channel.name + ".bin", hash,
+        [&]() { return tabulate_diff(channel); }, &created);
+  }
+  // The tables on disk have already been checked when they were created.
+  if (created) {
+    report_accuracy();
+  }
+}
+
+bool CrosssectionsPhoton<ComputationMethod::Lookup>::is_tabulated() {
+  return !total_tabulations[0].is_empty();
+}
+
+void CrosssectionsPhoton<ComputationMethod::Lookup>::report_accuracy() {
+  if (!is_tabulated()) {
+    logg[LCrossSections].warn(
+        "Photon cross sections are not tabulated, no accuracy to report.");
+    return;
+  }
+  /* Compare in the centers of the grid cells, where the interpolation error
+   * is largest. Only every fourth cell along each axis is sampled to keep
+   * this cheaper than the tabulation itself. */
+  constexpr size_t stride = 4;
+  auto center = [](const GridTabulation::Axis &axis, size_t i) {
+    return axis.min + (i + 0.5) * (axis.max - axis.min) / axis.num;
+  };
+  auto log_deviation = [](const std::string &name, const Deviation &dev) {
+    logg[LCrossSections].info(
+        "Photon cross section table ", name, ": max. abs. deviation ",
+        dev.max_abs, ", max. rel. deviation ", dev.max_rel,
+        ", mean rel. deviation ", dev.n > 0 ? dev.sum_rel / dev.n : 0.);
+  };
+  for (size_t c = 0; c < N_Total; c++) {
+    const TotalChannel &channel = total_channels[c];
+    Deviation dev;
+    for (size_t i = 0; i < total_sqrts_axis.num; i += stride) {
+      const double sqrts = center(total_sqrts_axis, i);
+      for (size_t j = 0; j < total_m_rho_axis.num; j += stride) {
+        const double m_rho = center(total_m_rho_axis, j);
+        if (!can_interpolate(channel, total_sqrts_axis, total_m_rho_axis,
+                             sqrts, m_rho)) {
+          continue;
+        }
+        const double s = sqrts * sqrts;
+        dev.add(lookup_total(static_cast<TotalIndex>(c), s, m_rho),
+                channel.analytic(s, m_rho));
+      }
+    }
+    log_deviation(channel.name, dev);
+  }
+  for (size_t c = 0; c < N_Diff; c++) {
+    const DiffChannel &channel = diff_channels[c];
+    Deviation dev;
+    for (size_t i = 0; i < diff_sqrts_axis.num; i += stride) {
+      const double sqrts = center(diff_sqrts_axis, i);
+      for (size_t j = 0; j < diff_m_rho_axis.num; j += stride) {
+        const double m_rho = center(diff_m_rho_axis, j);
+        if (!can_interpolate(channel, diff_sqrts_axis, diff_m_rho_axis,
+                             sqrts, m_rho)) {
+          continue;
+        }
+        const double s = sqrts * sqrts;
+        const auto t_range = photon_t_range(channel.kinematics, sqrts, m_rho);
+        for (size_t k = 0; k < diff_v_axis.num; k += stride) {
+          const double t = t_from_grid(t_range, center(diff_v_axis, k));
+          dev.add(lookup_diff(static_cast<DiffIndex>(c), s, t, m_rho),
+                  channel.analytic(s, t, m_rho));
+        }
+      }
+    }
+    log_deviation(std::string("diff_") + channel.name, dev);
+  }
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_pi_rho0(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_pi_rho0, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_pi0_rho(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_pi0_rho, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi0_rho0_pi0(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi0_rho0_pi0, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_rho0_pi(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_rho0_pi, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_rho_pi0(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_rho_pi0, s, m_rho);
+}
+
+double
+CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_rho_pi0_rho_mediated(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_rho_pi0_rho_mediated, s, m_rho);
+}
+
+double
+CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi_rho_pi0_omega_mediated(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi_rho_pi0_omega_mediated, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi0_rho_pi(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi0_rho_pi, s, m_rho);
+}
+
+double
+CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi0_rho_pi_rho_mediated(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi0_rho_pi_rho_mediated, s, m_rho);
+}
+
+double
+CrosssectionsPhoton<ComputationMethod::Lookup>::xs_pi0_rho_pi_omega_mediated(
+    const double s, const double m_rho) {
+  return lookup_total(Total_pi0_rho_pi_omega_mediated, s, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_diff_pi_pi_rho0(
+    const double s, const double t, const double m_rho) {
+  return lookup_diff(Diff_pi_pi_rho0, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_diff_pi_pi0_rho(
+    const double s, const double t, const double m_rho) {
+  return lookup_diff(Diff_pi_pi0_rho, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_diff_pi0_rho0_pi0(
+    const double s, const double t, const double m_rho) {
+  return lookup_diff(Diff_pi0_rho0_pi0, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::xs_diff_pi_rho0_pi(
+    const double s, const double t, const double m_rho) {
+  return lookup_diff(Diff_pi_rho0_pi, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::
+    xs_diff_pi_rho_pi0_rho_mediated(const double s, const double t,
+                                    const double m_rho) {
+  return lookup_diff(Diff_pi_rho_pi0_rho_mediated, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::
+    xs_diff_pi_rho_pi0_omega_mediated(const double s, const double t,
+                                      const double m_rho) {
+  return lookup_diff(Diff_pi_rho_pi0_omega_mediated, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::
+    xs_diff_pi0_rho_pi_rho_mediated(const double s, const double t,
+                                    const double m_rho) {
+  return lookup_diff(Diff_pi0_rho_pi_rho_mediated, s, t, m_rho);
+}
+
+double CrosssectionsPhoton<ComputationMethod::Lookup>::
+    xs_diff_pi0_rho_pi_omega_mediated(const double s, const double t,
+                                      const double m_rho) {
+  return lookup_diff(Diff_pi0_rho_pi_omega_mediated, s, t, m_rho);
+}
+
+}  // namespace smash
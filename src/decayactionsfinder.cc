@@ -9,9 +9,12 @@
 
 #include "smash/decayactionsfinder.h"
 
+#include <array>
+
 #include "smash/constants.h"
 #include "smash/cxx14compat.h"
 #include "smash/decayaction.h"
+#include "smash/decaymodes.h"
 #include "smash/fourvector.h"
 #include "smash/random.h"
 
@@ -25,15 +28,28 @@ ActionList DecayActionsFinder::find_actions_in_cell(
    * less than 10 decays in most time steps */
   actions.reserve(10);
 
+  /* The partial widths are first only evaluated into this buffer. The decay
+   * branches are then built only for the few particles that actually decay in
+   * this timestep. Particle types with more decay modes than fit into the
+   * buffer fall back to a heap-allocated one. */
+  std::array<double, max_decay_modes_on_stack> stack_widths;
+  std::vector<double> heap_widths;
+
   for (const auto &p : search_list) {
     if (p.type().is_stable()) {
       continue;  // particle doesn't decay
     }
 
-    DecayBranchList processes = p.type().get_partial_widths(
-        p.momentum(), p.position().threevec(), WhichDecaymodes::Hadronic);
+    const size_t n_modes = p.type().decay_modes().decay_mode_list().size();
+    double *partial_widths = stack_widths.data();
+    if (n_modes > stack_widths.size()) {
+      heap_widths.resize(n_modes);
+      partial_widths = heap_widths.data();
+    }
     // total decay width (mass-dependent)
-    const double width = total_weight<DecayBranch>(processes);
+    const double width =
+        p.type().get_total_width(p.momentum(), p.position().threevec(),
+                                 WhichDecaymodes::Hadronic, partial_widths);
 
     // check if there are any (hadronic) decays
     if (!(width > 0.0)) {
@@ -61,7 +77,7 @@ ActionList DecayActionsFinder::find_actions_in_cell(
       /* => decay_time ∈ [0, dt[
        * => the particle decays in this timestep. */
       auto act = make_unique<DecayAction>(p, decay_time);
-      act->add_decays(std::move(processes));
+      act->add_decays(p.type().get_decay_branches(partial_widths));
       actions.emplace_back(std::move(act));
     }
   }
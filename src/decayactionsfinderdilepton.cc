@@ -9,6 +9,9 @@
 
 #include "smash/decayactionsfinderdilepton.h"
 
+#include <algorithm>
+#include <memory>
+
 #include "smash/constants.h"
 #include "smash/cxx14compat.h"
 #include "smash/decayactiondilepton.h"
@@ -16,46 +19,87 @@
 
 namespace smash {
 
+DecayActionsFinderDilepton::DecayActionsFinderDilepton() {
+  const ParticleTypeList &all_types = ParticleType::list_all();
+  dilepton_modes_.resize(all_types.size());
+  for (size_t i = 0; i < all_types.size(); i++) {
+    const ParticleType &t = all_types[i];
+    const auto &modes = t.decay_modes().decay_mode_list();
+    for (unsigned int m = 0; m < modes.size(); m++) {
+      if (t.wanted_decaymode(modes[m]->type(), WhichDecaymodes::Dileptons)) {
+        dilepton_modes_[i].push_back(m);
+      }
+    }
+  }
+}
+
+DileptonDecay DecayActionsFinderDilepton::sample_decay(
+    const ParticleData &p, const DecayType &mode, double width,
+    double shining_weight) {
+  DecayActionDilepton act(p, 0., shining_weight);
+  act.add_decay(make_unique<DecayBranch>(mode, width));
+  act.generate_final_state();
+  return {p, act.outgoing_particles(), act.get_total_weight(), width};
+}
+
+const std::vector<unsigned int> &DecayActionsFinderDilepton::dilepton_modes(
+    const ParticleType &type) const {
+  const auto offset =
+      std::addressof(type) - std::addressof(ParticleType::list_all()[0]);
+  return dilepton_modes_[offset];
+}
+
 void DecayActionsFinderDilepton::shine(const Particles &search_list,
                                        OutputInterface *output,
                                        double dt) const {
   if (!output->is_dilepton_output()) {
     return;
   }
+  std::vector<DileptonDecay> decays;
+  std::vector<double> partial_widths;
   for (const auto &p : search_list) {
-    const auto n_all_modes =
-        p.type()
-            .get_partial_widths(p.momentum(), p.position().threevec(),
-                                WhichDecaymodes::All)
-            .size();
-    if (n_all_modes == 0) {
-      continue;
-    }
-
-    const double inv_gamma = p.inverse_gamma();
-    DecayBranchList dil_modes = p.type().get_partial_widths(
-        p.momentum(), p.position().threevec(), WhichDecaymodes::Dileptons);
-
+    const ParticleType &t = p.type();
+    const auto &dil_modes = dilepton_modes(t);
     /* If particle can only decay into dileptons or is stable, use shining only
      * in find_final_actions and ignore them here, also unformed
      * resonances cannot decay */
-    if (dil_modes.size() == n_all_modes || p.type().is_stable() ||
+    if (dil_modes.empty() || t.is_stable() ||
         (p.formation_time() > p.position().x0())) {
       continue;
     }
 
-    for (DecayBranchPtr &mode : dil_modes) {
-      // SHINING as described in \iref{Schmidt:2008hm}, chapter 2D
-      const double shining_weight = dt * inv_gamma * mode->weight() / hbarc;
+    /* The widths of all modes of a particle are evaluated in one go, they are
+     * needed to check whether it has any hadronic decays. */
+    const auto &all_modes = t.decay_modes().decay_mode_list();
+    partial_widths.resize(all_modes.size());
+    t.get_total_width(p.momentum(), p.position().threevec(),
+                      WhichDecaymodes::All, partial_widths.data());
+    const auto n_all_modes = std::count_if(
+        partial_widths.begin(), partial_widths.end(),
+        [](double w) { return w > 0.; });
+    const auto n_dil_modes =
+        std::count_if(dil_modes.begin(), dil_modes.end(),
+                      [&](unsigned int m) { return partial_widths[m] > 0.; });
+    if (n_dil_modes == n_all_modes) {
+      continue;
+    }
 
-      if (shining_weight > 0.0) {  // decays that can happen
-        DecayActionDilepton act(p, 0., shining_weight);
-        act.add_decay(std::move(mode));
-        act.generate_final_state();
-        output->at_interaction(act, 0.0);
+    for (unsigned int m : dil_modes) {
+      if (!(partial_widths[m] > 0.)) {  // decays that cannot happen
+        continue;
+      }
+      // SHINING as described in \iref{Schmidt:2008hm}, chapter 2D
+      const double shining_weight =
+          dt * p.inverse_gamma() * partial_widths[m] / hbarc;
+      if (shining_weight > 0.0) {
+        decays.push_back(sample_decay(p, all_modes[m]->type(),
+                                      partial_widths[m], shining_weight));
       }
     }
   }
+  if (!decays.empty()) {
+    output->at_dilepton_decays(decays);
+  }
 }
 
 void DecayActionsFinderDilepton::shine_final(const Particles &search_list,
@@ -64,31 +108,37 @@ void DecayActionsFinderDilepton::shine_final(const Particles &search_list,
   if (!output->is_dilepton_output()) {
     return;
   }
+  std::vector<DileptonDecay> decays;
+  std::vector<double> partial_widths;
   for (const auto &p : search_list) {
     const ParticleType &t = p.type();
-    if (t.decay_modes().decay_mode_list().empty() ||
-        (only_res && t.is_stable())) {
+    const auto &dil_modes = dilepton_modes(t);
+    if (dil_modes.empty() || (only_res && t.is_stable())) {
       continue;
     }
 
-    DecayBranchList dil_modes = t.get_partial_widths(
-        p.momentum(), p.position().threevec(), WhichDecaymodes::Dileptons);
-
+    const auto &all_modes = t.decay_modes().decay_mode_list();
+    partial_widths.resize(all_modes.size());
     // total decay width, also hadronic decays
-    const double width_tot = total_weight<DecayBranch>(t.get_partial_widths(
-        p.momentum(), p.position().threevec(), WhichDecaymodes::All));
+    const double width_tot =
+        t.get_total_width(p.momentum(), p.position().threevec(),
+                          WhichDecaymodes::All, partial_widths.data());
 
-    for (DecayBranchPtr &mode : dil_modes) {
-      const double shining_weight = mode->weight() / width_tot;
+    for (unsigned int m : dil_modes) {
+      if (!(partial_widths[m] > 0.0)) {  // decays that cannot happen
+        continue;
+      }
+      const double shining_weight = partial_widths[m] / width_tot;
 
-      if (shining_weight > 0.0) {  // decays that can happen
-        DecayActionDilepton act(p, 0., shining_weight);
-        act.add_decay(std::move(mode));
-        act.generate_final_state();
-        output->at_interaction(act, 0.0);
+      if (shining_weight > 0.0) {
+        decays.push_back(sample_decay(p, all_modes[m]->type(),
+                                      partial_widths[m], shining_weight));
       }
     }
   }
+  if (!decays.empty()) {
+    output->at_dilepton_decays(decays);
+  }
 }
 
 }  // namespace smash
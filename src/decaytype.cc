@@ -13,6 +13,7 @@
 #include "smash/constants.h"
 #include "smash/cxx14compat.h"
 #include "smash/formfactors.h"
+#include "smash/potentials.h"
 #include "smash/pow.h"
 
 namespace smash {
@@ -47,6 +48,17 @@ static double integrand_rho_Manley_2res(double sqrts, double m1, double m2,
          t2->spectral_function(m2);
 }
 
+// DecayType
+
+DecayType::DecayType(ParticleTypePtrList part_types, int l)
+    : particle_types_(part_types), L_(l), final_state_force_scale_(0., 0.) {
+  for (const auto &type : particle_types_) {
+    const auto scale = Potentials::force_scale(*type);
+    final_state_force_scale_.first += scale.first;
+    final_state_force_scale_.second += scale.second * type->isospin3_rel();
+  }
+}
+
 // TwoBodyDecay
 
 TwoBodyDecay::TwoBodyDecay(ParticleTypePtrList part_types, int l)
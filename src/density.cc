@@ -60,6 +60,11 @@ std::pair<double, ThreeVector> unnormalized_smearing_factor(
   return std::make_pair(sf, sf_grad);
 }
 
+/// \return The particle itself
+inline const ParticleData &as_particle(const ParticleData &p) { return p; }
+/// \return The particle pointed to
+inline const ParticleData &as_particle(const ParticleData *p) { return *p; }
+
 /// \copydoc smash::current_eckart
 template <typename /*ParticlesContainer*/ T>
 std::tuple<double, FourVector, ThreeVector, ThreeVector, FourVector, FourVector,
@@ -82,7 +87,8 @@ current_eckart_impl(const ThreeVector &r, const T &plist,
    * while the next 3 ones are spacial derivatives. */
   std::array<FourVector, 4> djmu_dxnu;
 
-  for (const auto &p : plist) {
+  for (const auto &entry : plist) {
+    const ParticleData &p = as_particle(entry);
     if (par.only_participants()) {
       // if this conditions holds, the hadron is a spectator
       if (p.get_history().collisions_per_particle == 0) {
@@ -178,6 +184,15 @@ current_eckart(const ThreeVector &r, const Particles &plist,
   return current_eckart_impl(r, plist, par, dens_type, compute_gradient,
                              smearing);
 }
+std::tuple<double, FourVector, ThreeVector, ThreeVector, FourVector, FourVector,
+           FourVector, FourVector>
+current_eckart(const ThreeVector &r,
+               const std::vector<const ParticleData *> &plist,
+               const DensityParameters &par, DensityType dens_type,
+               bool compute_gradient, bool smearing) {
+  return current_eckart_impl(r, plist, par, dens_type, compute_gradient,
+                             smearing);
+}
 
 void update_lattice(
     RectangularLattice<DensityOnLattice> *lat,
@@ -194,6 +209,13 @@ void update_lattice(
   const std::array<int, 3> lattice_n_cells = lat->n_cells();
   const int number_of_nodes =
       lattice_n_cells[0] * lattice_n_cells[1] * lattice_n_cells[2];
+  const int n_threads = par.n_threads();
+  if (par.derivatives() == DerivativesMode::FiniteDifference &&
+      (old_jmu == nullptr || new_jmu == nullptr ||
+       four_grad_lattice == nullptr)) {
+    throw std::invalid_argument(
+        "Finite difference derivatives need the auxiliary lattices.");
+  }
 
   /*
    * Take the provided DensityOnLattice lattice and use the information about
@@ -204,9 +226,12 @@ void update_lattice(
   // copy values of jmu at t_0 onto old_jmu;
   // proceed only if finite difference gradients are calculated
   if (par.derivatives() == DerivativesMode::FiniteDifference) {
-    for (int i = 0; i < number_of_nodes; i++) {
-      old_jmu->assign_value(i, ((*lat)[i]).jmu_net());
-    }
+    parallel_for_blocks(number_of_nodes, n_threads,
+                        [&](int begin, int end, int) {
+                          for (int i = begin; i < end; i++) {
+                            old_jmu->assign_value(i, ((*lat)[i]).jmu_net());
+                          }
+                        });
   }
 
   update_lattice(lat, update, dens_type, par, ensembles, compute_gradient);
@@ -214,65 +239,90 @@ void update_lattice(
   // calculate the gradients for finite difference derivatives
   if (par.derivatives() == DerivativesMode::FiniteDifference) {
     // copy values of jmu FourVectors at t_0 + time_step onto new_jmu
-    for (int i = 0; i < number_of_nodes; i++) {
-      new_jmu->assign_value(i, ((*lat)[i]).jmu_net());
-    }
+    parallel_for_blocks(number_of_nodes, n_threads,
+                        [&](int begin, int end, int) {
+                          for (int i = begin; i < end; i++) {
+                            new_jmu->assign_value(i, ((*lat)[i]).jmu_net());
+                          }
+                        });
 
     // compute time derivatives and gradients of all components of jmu
     new_jmu->compute_four_gradient_lattice(*old_jmu, time_step,
-                                           *four_grad_lattice);
+                                           *four_grad_lattice, n_threads);
 
     // substitute new derivatives
-    int node_number = 0;
-    for (auto &node : *lat) {
-      auto tmp = (*four_grad_lattice)[node_number];
-      node.overwrite_djmu_dxnu(tmp[0], tmp[1], tmp[2], tmp[3]);
-      node_number++;
-    }
+    parallel_for_blocks(
+        number_of_nodes, n_threads, [&](int begin, int end, int) {
+          for (int i = begin; i < end; i++) {
+            const auto &tmp = (*four_grad_lattice)[i];
+            (*lat)[i].overwrite_djmu_dxnu(tmp[0], tmp[1], tmp[2], tmp[3]);
+          }
+        });
   }  // if (par.derivatives() == DerivativesMode::FiniteDifference)
 
   // calculate gradients of rest frame density
   if (par.rho_derivatives() == RestFrameDensityDerivativesMode::On) {
-    for (auto &node : *lat) {
-      // the rest frame density
-      double rho = node.rho();
-      const int sgn = rho > 0 ? 1 : -1;
-      if (std::abs(rho) < very_small_double) {
-        rho = sgn * very_small_double;
-      }
+    parallel_for_blocks(number_of_nodes, n_threads, [&](int begin, int end,
+                                                        int) {
+      for (int i = begin; i < end; i++) {
+        DensityOnLattice &node = (*lat)[i];
+        // the rest frame density
+        double rho = node.rho();
+        const int sgn = rho > 0 ? 1 : -1;
+        if (std::abs(rho) < very_small_double) {
+          rho = sgn * very_small_double;
+        }
 
-      // the computational frame j^mu
-      const FourVector jmu = node.jmu_net();
-      // computational frame array of derivatives of j^mu
-      const std::array<FourVector, 4> djmu_dxnu = node.djmu_dxnu();
+        // the computational frame j^mu
+        const FourVector jmu = node.jmu_net();
+        // computational frame array of derivatives of j^mu
+        const std::array<FourVector, 4> djmu_dxnu = node.djmu_dxnu();
 
-      const double drho_dt =
-          (1 / rho) *
-          (jmu.x0() * djmu_dxnu[0].x0() - jmu.x1() * djmu_dxnu[0].x1() -
-           jmu.x2() * djmu_dxnu[0].x2() - jmu.x3() * djmu_dxnu[0].x3());
+        const double drho_dt =
+            (1 / rho) *
+            (jmu.x0() * djmu_dxnu[0].x0() - jmu.x1() * djmu_dxnu[0].x1() -
+             jmu.x2() * djmu_dxnu[0].x2() - jmu.x3() * djmu_dxnu[0].x3());
 
-      const double drho_dx =
-          (1 / rho) *
-          (jmu.x0() * djmu_dxnu[1].x0() - jmu.x1() * djmu_dxnu[1].x1() -
-           jmu.x2() * djmu_dxnu[1].x2() - jmu.x3() * djmu_dxnu[1].x3());
+        const double drho_dx =
+            (1 / rho) *
+            (jmu.x0() * djmu_dxnu[1].x0() - jmu.x1() * djmu_dxnu[1].x1() -
+             jmu.x2() * djmu_dxnu[1].x2() - jmu.x3() * djmu_dxnu[1].x3());
 
-      const double drho_dy =
-          (1 / rho) *
-          (jmu.x0() * djmu_dxnu[2].x0() - jmu.x1() * djmu_dxnu[2].x1() -
-           jmu.x2() * djmu_dxnu[2].x2() - jmu.x3() * djmu_dxnu[2].x3());
+        const double drho_dy =
+            (1 / rho) *
+            (jmu.x0() * djmu_dxnu[2].x0() - jmu.x1() * djmu_dxnu[2].x1() -
+             jmu.x2() * djmu_dxnu[2].x2() - jmu.x3() * djmu_dxnu[2].x3());
 
-      const double drho_dz =
-          (1 / rho) *
-          (jmu.x0() * djmu_dxnu[3].x0() - jmu.x1() * djmu_dxnu[3].x1() -
-           jmu.x2() * djmu_dxnu[3].x2() - jmu.x3() * djmu_dxnu[3].x3());
+        const double drho_dz =
+            (1 / rho) *
+            (jmu.x0() * djmu_dxnu[3].x0() - jmu.x1() * djmu_dxnu[3].x1() -
+             jmu.x2() * djmu_dxnu[3].x2() - jmu.x3() * djmu_dxnu[3].x3());
 
-      const FourVector drho_dxnu = {drho_dt, drho_dx, drho_dy, drho_dz};
+        const FourVector drho_dxnu = {drho_dt, drho_dx, drho_dy, drho_dz};
 
-      node.overwrite_drho_dxnu(drho_dxnu);
-    }
+        node.overwrite_drho_dxnu(drho_dxnu);
+      }
+    });
   }  // if (par.rho_derivatives() == RestFrameDensityDerivatives::On){
 }  // void update_lattice()
 
+double density_at_interaction_point(const ThreeVector &r,
+                                    const Particles &particles,
+                                    const DensityParameters &par,
+                                    DensityType dens_type,
+                                    DensityLattice *lat) {
+  DensityOnLattice node;
+  if (lat != nullptr && lat->value_at(r, node)) {
+    return node.rho();
+  }
+  constexpr bool compute_gradient = false;
+  constexpr bool smearing = true;
+  const double rho = std::get<0>(current_eckart(
+      r, particles, par, dens_type, compute_gradient, smearing));
+  // outside of the lattice, normalize like the lattice to all ensembles
+  return lat != nullptr ? par.nensembles() * rho : rho;
+}
+
 std::ostream &operator<<(std::ostream &os, DensityType dens_type) {
   switch (dens_type) {
     case DensityType::Hadron:
@@ -237,6 +237,17 @@ ExperimentPtr ExperimentBase::create(Configuration config,
  * \li \key "pion" - Pion density
  * \li \key "none" - Do not calculate density, print 0.0
  *
+ * \key Asynchronous (bool, optional, default = false): \n
+ * Write the particles and interactions on a separate thread, while the
+ * simulation goes on. They are copied for this purpose, which needs
+ * additional memory. Lattices are still written on the main thread, and every
+ * event is completely written before the next one starts.
+ *
+ * \key Compression (string, optional, default = "None"): \n
+ * Compress the binary and OSCAR outputs, see \ref output_compression_.
+ * \li \key "None" - Write uncompressed files
+ * \li \key "Zlib" - Compress every event with zlib, in gzip format
+ *
  * \n
  * ### Format configuration independently of the specific output content
  * Further options are defined for every single output content
@@ -270,6 +281,10 @@ ExperimentPtr ExperimentBase::create(Configuration config,
  *                         is not empty (i.e. any collisions happened between
  *                         projectile and target). Useful to save disk space. \n
  *   \li \key No - Particle list at output interval including initial time \n
+ *
+ *   \key Filter (section, optional): \n
+ *   Write only the particles and columns selected by the
+ *   \ref output_filter_ "output filter". \n
  * \n
  * - \b Collisions (VTK not available) \n
  *   \key Extended (bool, optional, default = false, incompatible with
@@ -281,6 +296,10 @@ ExperimentPtr ExperimentBase::create(Configuration config,
  *                  Root and HepMC format): \n
  *   \li \key true - Initial and final particle list is printed out \n
  *   \li \key false - Initial and final particle list is not printed out \n
+ *
+ *   \key Filter (section, optional): \n
+ *   Write only the particles and columns selected by the
+ *   \ref output_filter_ "output filter". \n
  * \n
  * - \b Dileptons (Only Oscar1999, Oscar2013 and binary formats) \n
  *   \key Extended (bool, optional, default = false, incompatible with
@@ -602,6 +621,11 @@ ExperimentParameters create_experiment_parameters(Configuration config) {
   }
   const bool potential_affect_threshold =
       config.take({"Lattice", "Potentials_Affect_Thresholds"}, false);
+  const int lattice_threads = config.take({"Lattice", "Threads"}, 1);
+  if (lattice_threads < 1) {
+    throw std::invalid_argument(
+        "The number of lattice threads has to be at least 1.");
+  }
   const double scale_xs = config_coll.take({"Cross_Section_Scaling"}, 1.0);
 
   const auto criterion =
@@ -655,6 +679,7 @@ ExperimentParameters create_experiment_parameters(Configuration config) {
           config.take({"General", "Gauss_Cutoff_In_Sigma"}, 4.),
           config.take({"General", "Discrete_Weight"}, 1. / 3.0),
           config.take({"General", "Triangular_Range"}, 2.0),
+          lattice_threads,
           criterion,
           config_coll.take({"Two_to_One"}, true),
           config_coll.take({"Included_2to2"}, ReactionsBitSet().set()),
@@ -9,6 +9,8 @@
 
 #include "smash/file.h"
 
+#include "smash/compression.h"
+
 namespace smash {
 
 FilePtr fopen(const bf::path& filename, const std::string& mode) {
@@ -17,16 +19,39 @@ FilePtr fopen(const bf::path& filename, const std::string& mode) {
 }
 
 RenamingFilePtr::RenamingFilePtr(const bf::path& filename,
-                                 const std::string& mode) {
+                                 const std::string& mode)
+    : RenamingFilePtr(filename, mode, nullptr) {}
+
+RenamingFilePtr::RenamingFilePtr(const bf::path& filename,
+                                 const std::string& mode,
+                                 std::unique_ptr<CompressionCodec> codec) {
   filename_ = filename;
-  filename_unfinished_ = filename;
+  if (codec) {
+    filename_ += codec->extension();
+  }
+  filename_unfinished_ = filename_;
   filename_unfinished_ += ".unfinished";
   file_ = std::fopen(filename_unfinished_.c_str(), mode.c_str());
+  if (codec) {
+    compressor_ = make_unique<FrameCompressor>(file_, std::move(codec));
+  }
 }
 
-FILE* RenamingFilePtr::get() { return file_; }
+FILE* RenamingFilePtr::get() {
+  return compressor_ ? compressor_->get() : file_;
+}
+
+void RenamingFilePtr::flush() {
+  if (compressor_) {
+    compressor_->end_frame();
+  } else {
+    std::fflush(file_);
+  }
+}
 
 RenamingFilePtr::~RenamingFilePtr() {
+  // The compressor writes the last frame to the file.
+  compressor_.reset();
   std::fclose(file_);
   bf::rename(filename_unfinished_, filename_);
 }
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/forwardingoutput.h"
+
+namespace smash {
+
+std::string ForwardingOutput::kind_of(const OutputInterface &output) {
+  if (output.is_dilepton_output()) {
+    return "Dileptons";
+  } else if (output.is_photon_output()) {
+    return "Photons";
+  } else if (output.is_IC_output()) {
+    return "SMASH_IC";
+  }
+  return "";
+}
+
+ForwardingOutput::ForwardingOutput(std::unique_ptr<OutputInterface> output)
+    : OutputInterface(kind_of(*output)), output_(std::move(output)) {}
+
+void ForwardingOutput::at_eventstart(const Particles &particles,
+                                     const int event_number,
+                                     const EventInfo &info) {
+  before_forwarding();
+  output_->at_eventstart(particles, event_number, info);
+}
+
+void ForwardingOutput::at_eventstart(const std::vector<Particles> &ensembles,
+                                     int event_number) {
+  before_forwarding();
+  output_->at_eventstart(ensembles, event_number);
+}
+
+void ForwardingOutput::at_eventstart(
+    const int event_number, const ThermodynamicQuantity tq,
+    const DensityType dens_type, RectangularLattice<DensityOnLattice> lattice) {
+  before_forwarding();
+  output_->at_eventstart(event_number, tq, dens_type, std::move(lattice));
+}
+
+void ForwardingOutput::at_eventstart(
+    const int event_number, const ThermodynamicQuantity tq,
+    const DensityType dens_type,
+    RectangularLattice<EnergyMomentumTensor> lattice) {
+  before_forwarding();
+  output_->at_eventstart(event_number, tq, dens_type, std::move(lattice));
+}
+
+void ForwardingOutput::at_eventend(const int event_number,
+                                   const ThermodynamicQuantity tq,
+                                   const DensityType dens_type) {
+  before_forwarding();
+  output_->at_eventend(event_number, tq, dens_type);
+}
+
+void ForwardingOutput::at_eventend(const ThermodynamicQuantity tq) {
+  before_forwarding();
+  output_->at_eventend(tq);
+}
+
+void ForwardingOutput::at_eventend(const Particles &particles,
+                                   const int event_number,
+                                   const EventInfo &info) {
+  before_forwarding();
+  output_->at_eventend(particles, event_number, info);
+}
+
+void ForwardingOutput::at_eventend(const std::vector<Particles> &ensembles,
+                                   const int event_number) {
+  before_forwarding();
+  output_->at_eventend(ensembles, event_number);
+}
+
+void ForwardingOutput::at_interaction(const Action &action,
+                                      const double density) {
+  before_forwarding();
+  output_->at_interaction(action, density);
+}
+
+void ForwardingOutput::at_dilepton_decays(
+    const std::vector<DileptonDecay> &decays) {
+  before_forwarding();
+  output_->at_dilepton_decays(decays);
+}
+
+void ForwardingOutput::at_intermediate_time(
+    const Particles &particles, const std::unique_ptr<Clock> &clock,
+    const DensityParameters &dens_param, const EventInfo &info) {
+  before_forwarding();
+  output_->at_intermediate_time(particles, clock, dens_param, info);
+}
+
+void ForwardingOutput::at_intermediate_time(
+    const std::vector<Particles> &ensembles,
+    const std::unique_ptr<Clock> &clock, const DensityParameters &dens_param) {
+  before_forwarding();
+  output_->at_intermediate_time(ensembles, clock, dens_param);
+}
+
+void ForwardingOutput::thermodynamics_output(
+    const ThermodynamicQuantity tq, const DensityType dt,
+    RectangularLattice<DensityOnLattice> &lattice) {
+  before_forwarding();
+  output_->thermodynamics_output(tq, dt, lattice);
+}
+
+void ForwardingOutput::thermodynamics_output(
+    const ThermodynamicQuantity tq, const DensityType dt,
+    RectangularLattice<EnergyMomentumTensor> &lattice) {
+  before_forwarding();
+  output_->thermodynamics_output(tq, dt, lattice);
+}
+
+void ForwardingOutput::thermodynamics_lattice_output(
+    RectangularLattice<DensityOnLattice> &lattice, const double current_time) {
+  before_forwarding();
+  output_->thermodynamics_lattice_output(lattice, current_time);
+}
+
+void ForwardingOutput::thermodynamics_lattice_output(
+    RectangularLattice<DensityOnLattice> &lattice, const double current_time,
+    const std::vector<Particles> &ensembles,
+    const DensityParameters &dens_param) {
+  before_forwarding();
+  output_->thermodynamics_lattice_output(lattice, current_time, ensembles,
+                                         dens_param);
+}
+
+void ForwardingOutput::thermodynamics_lattice_output(
+    const ThermodynamicQuantity tq,
+    RectangularLattice<EnergyMomentumTensor> &lattice,
+    const double current_time) {
+  before_forwarding();
+  output_->thermodynamics_lattice_output(tq, lattice, current_time);
+}
+
+void ForwardingOutput::thermodynamics_output(const GrandCanThermalizer &gct) {
+  before_forwarding();
+  output_->thermodynamics_output(gct);
+}
+
+void ForwardingOutput::fields_output(
+    const std::string name1, const std::string name2,
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> &lat) {
+  before_forwarding();
+  output_->fields_output(name1, name2, lat);
+}
+
+}  // namespace smash
@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/fouriertransform.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "smash/constants.h"
+#include "smash/parallel.h"
+
+namespace smash {
+
+namespace {
+/// \return Whether n is a power of two
+bool is_power_of_two(int n) { return (n & (n - 1)) == 0; }
+}  // unnamed namespace
+
+FourierTransform::FourierTransform(int n) : n_(n), m_(n) {
+  if (n < 1) {
+    throw std::invalid_argument(
+        "FourierTransform needs a positive number of values, got " +
+        std::to_string(n));
+  }
+  if (!is_power_of_two(n)) {
+    // The cyclic convolution of Bluestein's algorithm needs 2n - 1 values.
+    m_ = 1;
+    while (m_ < 2 * n - 1) {
+      m_ *= 2;
+    }
+  }
+  twiddles_.resize(m_ / 2);
+  for (int k = 0; k < m_ / 2; k++) {
+    twiddles_[k] = std::polar(1.0, -twopi * k / m_);
+  }
+  if (m_ == n_) {
+    return;
+  }
+  // k^2 is reduced modulo 2n to keep the argument of the chirp small.
+  chirp_.resize(n_);
+  for (int k = 0; k < n_; k++) {
+    const long long k2 = static_cast<long long>(k) * k % (2 * n_);
+    chirp_[k] = std::polar(1.0, -M_PI * k2 / n_);
+  }
+  chirp_spectrum_.assign(m_, 0.);
+  chirp_spectrum_[0] = std::conj(chirp_[0]);
+  for (int k = 1; k < n_; k++) {
+    chirp_spectrum_[k] = chirp_spectrum_[m_ - k] = std::conj(chirp_[k]);
+  }
+  radix2(chirp_spectrum_.data(), false);
+}
+
+void FourierTransform::forward(std::complex<double> *data) const {
+  if (chirp_.empty()) {
+    radix2(data, false);
+  } else {
+    bluestein(data);
+  }
+}
+
+void FourierTransform::inverse(std::complex<double> *data) const {
+  if (chirp_.empty()) {
+    radix2(data, true);
+  } else {
+    // The inverse transform is the conjugate transform of the conjugate data.
+    for (int k = 0; k < n_; k++) {
+      data[k] = std::conj(data[k]);
+    }
+    bluestein(data);
+    for (int k = 0; k < n_; k++) {
+      data[k] = std::conj(data[k]);
+    }
+  }
+  const double norm = 1. / n_;
+  for (int k = 0; k < n_; k++) {
+    data[k] *= norm;
+  }
+}
+
+void FourierTransform::radix2(std::complex<double> *data, bool inverse) const {
+  // Bit reversal permutation
+  for (int i = 1, j = 0; i < m_; i++) {
+    int bit = m_ >> 1;
+    for (; j & bit; bit >>= 1) {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j) {
+      std::swap(data[i], data[j]);
+    }
+  }
+  // Butterflies of increasing length
+  for (int length = 2; length <= m_; length <<= 1) {
+    const int half = length / 2;
+    const int step = m_ / length;
+    for (int start = 0; start < m_; start += length) {
+      for (int k = 0; k < half; k++) {
+        const std::complex<double> w = inverse
+                                           ? std::conj(twiddles_[k * step])
+                                           : twiddles_[k * step];
+        const std::complex<double> u = data[start + k];
+        const std::complex<double> v = data[start + k + half] * w;
+        data[start + k] = u + v;
+        data[start + k + half] = u - v;
+      }
+    }
+  }
+}
+
+void FourierTransform::bluestein(std::complex<double> *data) const {
+  /* With jk = (j^2 + k^2 - (k - j)^2) / 2 the transform becomes a convolution
+   * of the chirped data with the conjugate chirp. */
+  std::vector<std::complex<double>> work(m_, 0.);
+  for (int k = 0; k < n_; k++) {
+    work[k] = data[k] * chirp_[k];
+  }
+  radix2(work.data(), false);
+  for (int k = 0; k < m_; k++) {
+    work[k] *= chirp_spectrum_[k];
+  }
+  radix2(work.data(), true);
+  const double norm = 1. / m_;
+  for (int k = 0; k < n_; k++) {
+    data[k] = work[k] * chirp_[k] * norm;
+  }
+}
+
+FourierTransform3D::FourierTransform3D(const std::array<int, 3> &dims)
+    : dims_(dims) {
+  axes_.reserve(3);
+  for (int dir = 0; dir < 3; dir++) {
+    axes_.emplace_back(dims[dir]);
+  }
+}
+
+void FourierTransform3D::forward(std::vector<std::complex<double>> &data,
+                                 int n_threads) const {
+  transform(data, false, n_threads);
+}
+
+void FourierTransform3D::inverse(std::vector<std::complex<double>> &data,
+                                 int n_threads) const {
+  transform(data, true, n_threads);
+}
+
+void FourierTransform3D::transform(std::vector<std::complex<double>> &data,
+                                   bool inverse, int n_threads) const {
+  if (data.size() != static_cast<size_t>(size())) {
+    throw std::invalid_argument(
+        "FourierTransform3D got " + std::to_string(data.size()) +
+        " values instead of " + std::to_string(size()));
+  }
+  const int stride[3] = {1, dims_[0], dims_[0] * dims_[1]};
+  for (int dir = 0; dir < 3; dir++) {
+    const FourierTransform &axis = axes_[dir];
+    const int n = dims_[dir];
+    const int n_lines = size() / n;
+    parallel_for_blocks(n_lines, n_threads, [&](int begin, int end, int) {
+      std::vector<std::complex<double>> line(n);
+      for (int l = begin; l < end; l++) {
+        // Offset of the first value; lines are labeled by the other indices.
+        const int offset =
+            l % stride[dir] + (l / stride[dir]) * stride[dir] * n;
+        for (int i = 0; i < n; i++) {
+          line[i] = data[offset + i * stride[dir]];
+        }
+        if (inverse) {
+          axis.inverse(line.data());
+        } else {
+          axis.forward(line.data());
+        }
+        for (int i = 0; i < n; i++) {
+          data[offset + i * stride[dir]] = line[i];
+        }
+      }
+    });
+  }
+}
+
+}  // namespace smash
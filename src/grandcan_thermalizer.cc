@@ -40,6 +40,14 @@ void ThermLatticeNode::add_particle(const ParticleData &part, double factor) {
   nq_ += static_cast<double>(part.type().charge()) * factor;
 }
 
+ThermLatticeNode &ThermLatticeNode::operator+=(const ThermLatticeNode &node) {
+  Tmu0_ += node.Tmu0_;
+  nb_ += node.nb_;
+  ns_ += node.ns_;
+  nq_ += node.nq_;
+  return *this;
+}
+
 void ThermLatticeNode::compute_rest_frame_quantities(HadronGasEos &eos) {
   /// \todo(oliiny): use Newton's method instead of these iterations
   const int max_iter = 50;
@@ -282,7 +282,7 @@ class Action {
    *
    * \return four vector of interaction point
    */
-  FourVector get_interaction_point() const;
+  virtual FourVector get_interaction_point() const;
 
   /**
    * Get the skyrme and asymmetry potential at the interaction point
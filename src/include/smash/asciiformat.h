@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_ASCIIFORMAT_H_
+#define SRC_INCLUDE_SMASH_ASCIIFORMAT_H_
+
+#include <cstddef>
+#include <cstdio>
+
+namespace smash {
+
+/// Maximal number of characters written by format_general()
+constexpr std::size_t max_general_length = 24;
+
+/**
+ * Write a number like std::printf("%.*g", precision, x) does, i.e. with the
+ * given number of significant digits and without trailing zeros.
+ *
+ * The digits are found by a single multiplication with an exact power of ten,
+ * which is much faster than printf. Numbers, for which this is not guaranteed
+ * to round correctly (close to halfway between two results, with a very large
+ * or small exponent, infinite or NaN), are passed on to std::snprintf. So the
+ * result is always identical to the one of printf.
+ *
+ * \param[out] out Space for at least max_general_length characters
+ * \param[in] x Number to write
+ * \param[in] precision Number of significant digits, from 1 to 9
+ * \return Pointer behind the last written character. The string is not
+ *         terminated by a null character.
+ */
+char *format_general(char *out, double x, int precision);
+
+/**
+ * Write an integer like std::printf("%i", x) does.
+ *
+ * \param[out] out Space for at least 11 characters
+ * \param[in] x Number to write
+ * \return Pointer behind the last written character. The string is not
+ *         terminated by a null character.
+ */
+char *format_int(char *out, int x);
+
+/**
+ * One line of space separated values in an ASCII output, which is written to
+ * the file at once.
+ *
+ * \code
+ * AsciiLine line;
+ * line.general(x).general(y, 9).integer(id).string(name);
+ * line.write(file);  // same as std::fprintf(file, "%g %.9g %i %s\n", ...)
+ * \endcode
+ */
+class AsciiLine {
+ public:
+  /**
+   * Append a number like "%.<precision>g".
+   *
+   * \param[in] x Number to append
+   * \param[in] precision Number of significant digits, from 1 to 9
+   * \return This line
+   */
+  AsciiLine &general(double x, int precision = 6);
+
+  /**
+   * Append an integer like "%i".
+   *
+   * \param[in] x Number to append
+   * \return This line
+   */
+  AsciiLine &integer(int x);
+
+  /**
+   * Append a string like "%s".
+   *
+   * \param[in] s Null terminated string to append
+   * \return This line
+   * \throw std::length_error if the line becomes too long
+   */
+  AsciiLine &string(const char *s);
+
+  /**
+   * Write the line with a newline to a file, and start a new line.
+   *
+   * \param[in] file File to write to
+   */
+  void write(std::FILE *file);
+
+ private:
+  /// Maximal number of characters in a line
+  static constexpr std::size_t capacity_ = 512;
+
+  /**
+   * Prepare appending a value.
+   *
+   * \param[in] length Maximal number of characters of the value
+   * \return Where to write the value
+   * \throw std::length_error if the line becomes too long
+   */
+  char *next(std::size_t length);
+
+  /// Characters of the line
+  char buffer_[capacity_];
+  /// Number of characters in the line
+  std::size_t size_ = 0;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_ASCIIFORMAT_H_
@@ -0,0 +1,256 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_ASYNCOUTPUT_H_
+#define SRC_INCLUDE_SMASH_ASYNCOUTPUT_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "action.h"
+#include "forwardingoutput.h"
+#include "outputinterface.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Immutable record of a performed action, which keeps everything the outputs
+ * need from it after the action itself is gone.
+ */
+class RecordedAction : public Action {
+ public:
+  /**
+   * Record an action.
+   *
+   * \param[in] action Action after it was performed
+   */
+  explicit RecordedAction(const Action &action)
+      : Action(action.incoming_particles(), action.outgoing_particles(),
+               action.time_of_execution(), action.get_type()),
+        total_weight_(action.get_total_weight()),
+        partial_weight_(action.get_partial_weight()),
+        interaction_point_(action.get_interaction_point()) {}
+
+  /**
+   * Record an action with only some of its particles.
+   *
+   * \param[in] action Action after it was performed
+   * \param[in] incoming Incoming particles to be recorded
+   * \param[in] outgoing Outgoing particles to be recorded
+   */
+  RecordedAction(const Action &action, const ParticleList &incoming,
+                 const ParticleList &outgoing)
+      : Action(incoming, outgoing, action.time_of_execution(),
+               action.get_type()),
+        total_weight_(action.get_total_weight()),
+        partial_weight_(action.get_partial_weight()),
+        interaction_point_(action.get_interaction_point()) {}
+
+  /**
+   * Record a dilepton decay as a decay at the position of the decaying
+   * particle.
+   *
+   * \param[in] decay Dilepton decay
+   */
+  explicit RecordedAction(const DileptonDecay &decay)
+      : Action({decay.parent}, decay.products,
+               decay.parent.position().x0(), ProcessType::Decay),
+        total_weight_(decay.weight),
+        partial_weight_(decay.partial_width),
+        interaction_point_(decay.parent.position()) {}
+
+  /// \return Total weight of the recorded action
+  double get_total_weight() const override { return total_weight_; }
+
+  /// \return Partial weight of the recorded action
+  double get_partial_weight() const override { return partial_weight_; }
+
+  /// \return Interaction point of the recorded action
+  FourVector get_interaction_point() const override {
+    return interaction_point_;
+  }
+
+  /**
+   * A recorded action has already been performed.
+   *
+   * \throw std::logic_error always
+   */
+  void generate_final_state() override;
+
+ protected:
+  /**
+   * Writes information about the recorded action to the output stream.
+   *
+   * \param[out] out The output stream
+   */
+  void format_debug_output(std::ostream &out) const override;
+
+ private:
+  /// Total weight of the recorded action
+  double total_weight_;
+  /// Partial weight of the recorded action
+  double partial_weight_;
+  /// Interaction point of the recorded action
+  FourVector interaction_point_;
+};
+
+/**
+ * \ingroup output
+ *
+ * A thread that executes writing tasks in the order in which they are pushed.
+ *
+ * The queue of pending tasks is bounded. If it is full, push() waits until
+ * the writer has caught up, such that a slow output cannot accumulate an
+ * unbounded number of snapshots. An exception thrown by a task is rethrown
+ * on the pushing thread by the next call of push() or flush().
+ */
+class OutputWriterThread {
+ public:
+  /**
+   * Start the writer thread.
+   *
+   * \param[in] capacity Maximal number of pending tasks
+   * \throw std::invalid_argument if the capacity is zero
+   */
+  explicit OutputWriterThread(std::size_t capacity);
+
+  /// Finish all pending tasks and stop the thread.
+  ~OutputWriterThread();
+
+  /// Cannot be copied
+  OutputWriterThread(const OutputWriterThread &) = delete;
+  /// Cannot be copied
+  OutputWriterThread &operator=(const OutputWriterThread &) = delete;
+
+  /**
+   * Queue a task, waiting while the queue is full.
+   *
+   * \param[in] task Task to be executed on the writer thread
+   */
+  void push(std::function<void()> task);
+
+  /// Wait until all pending tasks are done.
+  void flush();
+
+ private:
+  /// Execute the tasks until the thread is stopped.
+  void run();
+
+  /// Rethrow and forget the exception of a failed task, if any.
+  void rethrow_error();
+
+  /// Maximal number of pending tasks
+  const std::size_t capacity_;
+  /// Pending tasks
+  std::deque<std::function<void()>> tasks_;
+  /// Whether a task is being executed right now
+  bool busy_ = false;
+  /// Whether the thread should stop once all tasks are done
+  bool stop_ = false;
+  /// Exception thrown by a task
+  std::exception_ptr error_;
+  /// Protects all of the above
+  std::mutex mutex_;
+  /// Signals new tasks and stopping to the writer
+  std::condition_variable task_pushed_;
+  /// Signals finished tasks to the pushing thread
+  std::condition_variable task_done_;
+  /// The writer thread
+  std::thread thread_;
+};
+
+/**
+ * \ingroup output
+ *
+ * Passes the output calls of the simulation to another output, which writes
+ * them on a writer thread.
+ *
+ * Particle lists and actions are copied into immutable snapshots, so the
+ * simulation goes on while they are formatted and written. Calls with
+ * lattices, ensembles or the thermalizer, which are not copied, wait until
+ * all earlier calls are written and are then executed directly. So are the
+ * calls at the end of an event, such that every event is completely written
+ * when the next one starts.
+ */
+class AsyncOutput : public ForwardingOutput {
+ public:
+  /**
+   * Wrap an output.
+   *
+   * \param[in] output Output doing the actual writing
+   * \param[in] writer Thread on which the writing takes place. It can be
+   *            shared by several outputs.
+   */
+  AsyncOutput(std::unique_ptr<OutputInterface> output,
+              std::shared_ptr<OutputWriterThread> writer);
+
+  /// Wait until everything is written.
+  ~AsyncOutput() override;
+
+  using ForwardingOutput::at_eventstart;
+  using ForwardingOutput::at_intermediate_time;
+
+  /**
+   * Queue the output of the particles at event start.
+   * \param[in] particles List of particles
+   * \param[in] event_number Number of the current event
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventstart(const Particles &particles, const int event_number,
+                     const EventInfo &info) override;
+
+  /**
+   * Queue the output of an action.
+   * \param[in] action The action object, containing the initial and final
+   *            state etc.
+   * \param[in] density The density at the interaction point
+   */
+  void at_interaction(const Action &action, const double density) override;
+
+  /**
+   * Queue the output of dilepton decays.
+   * \param[in] decays Dilepton decays found by the shining method
+   */
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override;
+
+  /**
+   * Queue the output of the particles at an intermediate time.
+   * \param[in] particles List of particles
+   * \param[in] clock System clock, of which the time and time step are kept
+   * \param[in] dens_param Parameters for density calculation
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_intermediate_time(const Particles &particles,
+                            const std::unique_ptr<Clock> &clock,
+                            const DensityParameters &dens_param,
+                            const EventInfo &info) override;
+
+ protected:
+  /// Wait until all earlier calls are written.
+  void before_forwarding() override;
+
+ private:
+  /// Thread on which the writing takes place
+  std::shared_ptr<OutputWriterThread> writer_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_ASYNCOUTPUT_H_
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -25,6 +26,10 @@ namespace smash {
 /**
  * \ingroup output
  * Base class for SMASH binary output.
+ *
+ * The write functions serialize into a buffer, which holds the current
+ * block of the output. Every output function ends with write_buffer(), which
+ * emits the whole block with a single call of fwrite.
  */
 class BinaryOutputBase : public OutputInterface {
  protected:
@@ -35,9 +40,12 @@ class BinaryOutputBase : public OutputInterface {
    * \param[in] mode Is used to determine the file access mode.
    * \param[in] name Name of the output.
    * \param[in] extended_format Is the written output extended.
+   * \param[in] compression Compression of the file, see
+   *            create_compression_codec.
    */
   explicit BinaryOutputBase(const bf::path &path, const std::string &mode,
-                            const std::string &name, bool extended_format);
+                            const std::string &name, bool extended_format,
+                            const std::string &compression);
 
   /**
    * Write byte to binary output.
@@ -67,25 +75,19 @@ class BinaryOutputBase : public OutputInterface {
    * Write integer (32 bit) to binary output.
    * \param[in] x Value to be written.
    */
-  void write(const std::int32_t x) {
-    std::fwrite(&x, sizeof(x), 1, file_.get());
-  }
+  void write(const std::int32_t x) { append(x); }
 
   /**
    * Write unsigned integer (32 bit) to binary output.
    * \param[in] x Value to be written.
    */
-  void write(const std::uint32_t x) {
-    std::fwrite(&x, sizeof(x), 1, file_.get());
-  }
+  void write(const std::uint32_t x) { append(x); }
 
   /**
    * Write unsigned integer (16 bit) to binary output.
    * \param[in] x Value to be written.
    */
-  void write(const std::uint16_t x) {
-    std::fwrite(&x, sizeof(x), 1, file_.get());
-  }
+  void write(const std::uint16_t x) { append(x); }
 
   /**
    * Write a std::size_t to binary output.
@@ -111,10 +113,34 @@ class BinaryOutputBase : public OutputInterface {
    */
   void write_particledata(const ParticleData &p);
 
+  /// Write the buffered block to the file and empty the buffer.
+  void write_buffer();
+
   /// Binary particles output file path
   RenamingFilePtr file_;
 
  private:
+  /**
+   * Append the bytes of a value to the buffer.
+   * \param[in] x Value to be appended.
+   */
+  template <typename T>
+  void append(const T &x) {
+    append(reinterpret_cast<const char *>(&x), sizeof(T));
+  }
+
+  /**
+   * Append bytes to the buffer.
+   * \param[in] data First byte to be appended.
+   * \param[in] size Number of bytes.
+   */
+  void append(const char *data, std::size_t size) {
+    buffer_.insert(buffer_.end(), data, data + size);
+  }
+
+  /// Serialized data of the current block, which is not yet written
+  std::vector<char> buffer_;
+
   /// Binary file format version number
   const uint16_t format_version_ = 7;
   /// Option for extended output
@@ -173,6 +199,13 @@ class BinaryOutputCollisions : public BinaryOutputBase {
    */
   void at_interaction(const Action &action, const double density) override;
 
+  /**
+   * Writes an interaction block for every dilepton decay, like for a decay
+   * action at zero density, and passes them on to the file in one go.
+   * \param[in] decays Dilepton decays found by the shining method.
+   */
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override;
+
  private:
   /// Write initial and final particles additonally to collisions?
   bool print_start_end_;
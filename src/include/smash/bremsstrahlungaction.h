@@ -10,9 +10,12 @@
 #ifndef SRC_INCLUDE_SMASH_BREMSSTRAHLUNGACTION_H_
 #define SRC_INCLUDE_SMASH_BREMSSTRAHLUNGACTION_H_
 
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include "scatteraction.h"
+#include "tabulation.h"
 
 namespace smash {
 /**
@@ -135,6 +138,23 @@ class BremsstrahlungAction : public ScatterAction {
     return bremsstrahlung_reaction_type(in) != ReactionType::no_reaction;
   }
 
+  /**
+   * Resample a bicubic spline of a tabulated differential cross section onto
+   * the uniform grid, on which it is looked up. This avoids evaluating the
+   * (not thread-safe) spline accelerators for every photon.
+   *
+   * \param[in] x Tabulated values of the first argument (k or theta).
+   * \param[in] sqrts Tabulated values of sqrt(s).
+   * \param[in] sigma Tabulated differential cross section.
+   * \param[in] dsigma_dk Whether sigma is dSigma/dk, which is resampled over
+   *            ln(k), or dSigma/dtheta, which is resampled over theta.
+   * \return Table of the differential cross section over (ln k, sqrt(s)) or
+   *         (theta, sqrt(s)).
+   */
+  static std::unique_ptr<FloatGridTabulation> resample_diff_cross_section(
+      const std::vector<double> &x, const std::vector<double> &sqrts,
+      const std::vector<double> &sigma, bool dsigma_dk);
+
  private:
   /**
    * Holds the bremsstrahlung branch. As of now, this will always
@@ -169,9 +189,12 @@ class BremsstrahlungAction : public ScatterAction {
 
   /**
    * Create interpolation objects for tabularized cross sections:
-   * total cross section, differential dSigma/dk, differential dSigma/dtheta
+   * total cross section, differential dSigma/dk, differential dSigma/dtheta.
+   * The differential cross sections are resampled onto uniform grids, which
+   * are interpolated bilinearly. Called exactly once, before the first cross
+   * section is evaluated.
    */
-  void create_interpolations();
+  static void create_interpolations();
 
   /**
    * Computes the total cross section of the bremsstrahlung process.
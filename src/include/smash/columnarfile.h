@@ -0,0 +1,254 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_COLUMNARFILE_H_
+#define SRC_INCLUDE_SMASH_COLUMNARFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "forwarddeclarations.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Columns of an event in the columnar output, see \ref format_columnar_.
+ * The columns of doubles come first, such that all columns are aligned.
+ */
+enum class ColumnarColumn : int {
+  /// t, x, y, z of every particle [fm]
+  Position,
+  /// p0, px, py, pz of every particle [GeV]
+  Momentum,
+  /// Effective mass [GeV]
+  Mass,
+  /// Formation time [fm]
+  FormationTime,
+  /// Cross section scaling factor
+  XsecScalingFactor,
+  /// Time of the last collision [fm]
+  TimeLastCollision,
+  /// PDG code in decimal form
+  Pdg,
+  /// Particle id
+  Id,
+  /// Electric charge
+  Charge,
+  /// Number of collisions
+  Collisions,
+  /// Id of the last process
+  IdProcess,
+  /// Type of the last process
+  ProcessType,
+  /// PDG code of the first mother in decimal form
+  PdgMother1,
+  /// PDG code of the second mother in decimal form
+  PdgMother2,
+};
+
+/// Number of columns of an event
+constexpr int n_columnar_columns = 14;
+
+/// Version of the columnar format
+constexpr std::uint32_t columnar_format_version = 1;
+
+/// Magic number at the start of a columnar file
+constexpr char columnar_magic[] = "SMASHCOL";
+
+/// Magic number at the end of a columnar file, after the index
+constexpr char columnar_index_magic[] = "SMASHIDX";
+
+/// Size of the header: magic number, format version and number of columns
+constexpr std::size_t columnar_header_size = 16;
+
+/// Size of the footer: offset of the index, number of events and magic number
+constexpr std::size_t columnar_footer_size = 24;
+
+/**
+ * \param[in] column Column
+ * \return Whether the column consists of doubles instead of 32 bit integers
+ */
+inline bool columnar_column_is_double(ColumnarColumn column) {
+  return column < ColumnarColumn::Pdg;
+}
+
+/**
+ * \param[in] column Column
+ * \return Number of values per particle in the column
+ */
+inline std::size_t columnar_values_per_particle(ColumnarColumn column) {
+  return column == ColumnarColumn::Position ||
+                 column == ColumnarColumn::Momentum
+             ? 4
+             : 1;
+}
+
+/**
+ * \param[in] column Column
+ * \param[in] n_particles Number of particles of the event
+ * \return Offset of the column from the start of the event [bytes]
+ */
+std::size_t columnar_column_offset(ColumnarColumn column,
+                                   std::size_t n_particles);
+
+/**
+ * \param[in] n_particles Number of particles of the event
+ * \return Size of all columns of the event, padded to a multiple of 8 [bytes]
+ */
+std::size_t columnar_event_size(std::size_t n_particles);
+
+/**
+ * \ingroup output
+ *
+ * Entry of the event index at the end of a columnar file.
+ */
+struct ColumnarEventInfo {
+  /// Offset of the first column from the start of the file [bytes]
+  std::uint64_t offset;
+  /// Number of particles
+  std::uint64_t n_particles;
+  /// Event number
+  std::int32_t event_number;
+  /// Whether there was no interaction between projectile and target (0 or 1)
+  std::int32_t empty_event;
+  /// Impact parameter [fm]
+  double impact_parameter;
+};
+static_assert(sizeof(ColumnarEventInfo) == 32,
+              "The index entries have to be written without padding.");
+
+/**
+ * Values of a column, which stay in the mapped file.
+ *
+ * \tparam T Type of the values
+ */
+template <typename T>
+class ConstSpan {
+ public:
+  /**
+   * \param[in] data First value
+   * \param[in] size Number of values
+   */
+  ConstSpan(const T *data, std::size_t size) : data_(data), size_(size) {}
+  /// \return Pointer to the first value
+  const T *data() const { return data_; }
+  /// \return Number of values
+  std::size_t size() const { return size_; }
+  /// \return Whether there are no values
+  bool empty() const { return size_ == 0; }
+  /// \return Iterator to the first value
+  const T *begin() const { return data_; }
+  /// \return Iterator behind the last value
+  const T *end() const { return data_ + size_; }
+  /**
+   * \param[in] i Index
+   * \return Value at the index
+   */
+  const T &operator[](std::size_t i) const { return data_[i]; }
+
+ private:
+  /// First value
+  const T *data_;
+  /// Number of values
+  std::size_t size_;
+};
+
+/**
+ * \ingroup output
+ *
+ * Random access to the events of a file written by the columnar output.
+ *
+ * The file is mapped into memory, so opening it only reads the index, and the
+ * columns of an event are returned without copying them. They stay valid as
+ * long as the reader exists.
+ *
+ * \code
+ * ColumnarFileReader file("data/0/particles_columnar.bin");
+ * const auto pdg = file.int_column(9731, ColumnarColumn::Pdg);
+ * const auto p = file.double_column(9731, ColumnarColumn::Momentum);
+ * for (std::size_t i = 0; i < pdg.size(); i++) {
+ *   // p0, px, py, pz of particle i are p[4 * i], ..., p[4 * i + 3]
+ * }
+ * \endcode
+ */
+class ColumnarFileReader {
+ public:
+  /**
+   * Map a columnar file and read its index.
+   *
+   * \param[in] path Path of the file
+   * \throw std::runtime_error if the file cannot be read or is no complete
+   *        columnar file
+   */
+  explicit ColumnarFileReader(const bf::path &path);
+
+  /// Unmap the file.
+  ~ColumnarFileReader();
+
+  /// Cannot be copied
+  ColumnarFileReader(const ColumnarFileReader &) = delete;
+  /// Cannot be copied
+  ColumnarFileReader &operator=(const ColumnarFileReader &) = delete;
+
+  /// \return Number of events in the file
+  std::size_t n_events() const { return index_.size(); }
+
+  /**
+   * \param[in] i_event Position of the event in the file
+   * \return Index entry of the event
+   * \throw std::out_of_range if there is no such event
+   */
+  const ColumnarEventInfo &event(std::size_t i_event) const {
+    return index_.at(i_event);
+  }
+
+  /**
+   * \param[in] i_event Position of the event in the file
+   * \param[in] column Column consisting of doubles
+   * \return Values of the column
+   * \throw std::out_of_range if there is no such event
+   * \throw std::invalid_argument if the column consists of integers
+   */
+  ConstSpan<double> double_column(std::size_t i_event,
+                                  ColumnarColumn column) const;
+
+  /**
+   * \param[in] i_event Position of the event in the file
+   * \param[in] column Column consisting of integers
+   * \return Values of the column
+   * \throw std::out_of_range if there is no such event
+   * \throw std::invalid_argument if the column consists of doubles
+   */
+  ConstSpan<std::int32_t> int_column(std::size_t i_event,
+                                     ColumnarColumn column) const;
+
+ private:
+  /**
+   * \param[in] i_event Position of the event in the file
+   * \param[in] column Column
+   * \return Start of the column in the mapped file
+   */
+  const char *column_data(std::size_t i_event, ColumnarColumn column) const;
+
+  /// Start of the mapped file
+  const char *data_ = nullptr;
+  /// Size of the mapped file [bytes]
+  std::size_t size_ = 0;
+  /// Event index
+  std::vector<ColumnarEventInfo> index_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_COLUMNARFILE_H_
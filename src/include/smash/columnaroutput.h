@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_COLUMNAROUTPUT_H_
+#define SRC_INCLUDE_SMASH_COLUMNAROUTPUT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "columnarfile.h"
+#include "file.h"
+#include "forwarddeclarations.h"
+#include "outputinterface.h"
+#include "outputparameters.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Writes the particles at the end of every event in the columnar format,
+ * see \ref format_columnar_. The event index is written when the output is
+ * destroyed.
+ */
+class ColumnarOutput : public OutputInterface {
+ public:
+  /**
+   * Create the columnar output file and write its header.
+   *
+   * \param[in] path Output path.
+   * \param[in] name Name of the output.
+   * \param[in] out_par Unused, but needed for a common interface.
+   */
+  ColumnarOutput(const bf::path &path, const std::string &name,
+                 const OutputParameters &out_par);
+
+  /// Write the event index and the footer.
+  ~ColumnarOutput() override;
+
+  /**
+   * Write the columns of the particles at the end of an event and remember
+   * the event for the index.
+   *
+   * \param[in] particles Current list of particles.
+   * \param[in] event_number Number of the event.
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventend(const Particles &particles, const int event_number,
+                   const EventInfo &info) override;
+
+ private:
+  /**
+   * Write the values of a column.
+   *
+   * \param[in] values Values to write
+   */
+  template <typename T>
+  void write_column(const std::vector<T> &values);
+
+  /// Number of bytes written so far
+  std::uint64_t offset_ = 0;
+
+  /// Index entries of all written events
+  std::vector<ColumnarEventInfo> index_;
+
+  /// Columns of doubles of the current event, reused between events
+  std::vector<double> doubles_;
+
+  /// Columns of integers of the current event, reused between events
+  std::vector<std::int32_t> ints_;
+
+  /// Output file
+  RenamingFilePtr file_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_COLUMNAROUTPUT_H_
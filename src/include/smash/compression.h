@@ -0,0 +1,258 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_COMPRESSION_H_
+#define SRC_INCLUDE_SMASH_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstdio>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include "asyncoutput.h"
+#include "forwarddeclarations.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Compresses and decompresses data in frames, which can be decompressed
+ * independently of each other. A compressed file is a sequence of frames.
+ */
+class CompressionCodec {
+ public:
+  /// Virtual destructor for the derived codecs
+  virtual ~CompressionCodec() = default;
+
+  /// \return Extension that is appended to the names of compressed files
+  virtual std::string extension() const = 0;
+
+  /**
+   * Compress data into one frame.
+   *
+   * \param[in] data Uncompressed data
+   * \param[in] size Size of the uncompressed data [bytes]
+   * \param[out] frame The compressed frame is appended to it
+   */
+  virtual void compress(const char *data, std::size_t size,
+                        std::string &frame) const = 0;
+
+  /**
+   * Decompress the frame at the start of the given data.
+   *
+   * \param[in] data Compressed data starting with a frame
+   * \param[in] size Size of the compressed data [bytes]
+   * \param[out] out The uncompressed frame is appended to it
+   * \return Size of the compressed frame [bytes]
+   * \throw std::runtime_error if the data does not start with a complete frame
+   */
+  virtual std::size_t decompress_frame(const char *data, std::size_t size,
+                                       std::string &out) const = 0;
+
+  /**
+   * Decompress the next frame of a stream. The stream is left at the start
+   * of the following frame.
+   *
+   * \param[in] in Seekable stream of compressed data
+   * \param[out] out The uncompressed frame is appended to it
+   * \return False if the stream has no further frame
+   * \throw std::runtime_error if the stream ends within a frame
+   */
+  virtual bool decompress_frame(std::istream &in, std::string &out) const = 0;
+};
+
+/**
+ * Create the codec for the \key Compression option of the output.
+ *
+ * \param[in] name "None" or "Zlib"
+ * \return The codec or nullptr for "None"
+ * \throw std::invalid_argument if the compression is unknown
+ * \throw std::runtime_error if SMASH was built without the codec
+ */
+std::unique_ptr<CompressionCodec> create_compression_codec(
+    const std::string &name);
+
+/**
+ * Recognize a compressed file by its first bytes.
+ *
+ * \param[in] path Path of the file
+ * \return The codec that the file was compressed with or nullptr if the file
+ *         is not compressed
+ */
+std::unique_ptr<CompressionCodec> detect_compression_codec(
+    const bf::path &path);
+
+/**
+ * Decompress all frames of a file into memory.
+ *
+ * \param[in] path Path of the compressed file
+ * \param[in] codec Codec that the file was compressed with
+ * \return Uncompressed content of the file
+ * \throw std::runtime_error if the file cannot be read or decompressed
+ */
+std::string decompress_file(const bf::path &path,
+                            const CompressionCodec &codec);
+
+/**
+ * \ingroup output
+ *
+ * Reads a compressed file as a stream of its uncompressed content,
+ * decompressing one frame at a time.
+ *
+ * Only the data after the position that was last sought to is kept in
+ * memory. Reading on from there, or seeking forward, decompresses the
+ * following frames. Seeking back before that position decompresses the
+ * file again from its start. A reader that seeks to the start of every
+ * event thus keeps only about one event in memory.
+ */
+class FrameDecompressor : public std::streambuf {
+ public:
+  /**
+   * \param[in] path Path of the compressed file
+   * \param[in] codec Codec that the file was compressed with
+   * \throw std::runtime_error if the file cannot be opened
+   */
+  FrameDecompressor(const bf::path &path,
+                    std::unique_ptr<CompressionCodec> codec);
+
+ protected:
+  /**
+   * Decompress the next frame.
+   *
+   * \return The next character or EOF at the end of the file
+   * \throw std::runtime_error if the file ends within a frame
+   */
+  int_type underflow() override;
+
+  /**
+   * Seek relative to the start or the current position.
+   *
+   * \param[in] off Offset in the uncompressed content
+   * \param[in] dir Start or current position; the end is not supported
+   * \param[in] which Only reading is supported
+   * \return New position or -1 if the seek failed
+   */
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override;
+
+  /**
+   * Seek to a position and forget the data before it.
+   *
+   * \param[in] pos Position in the uncompressed content
+   * \param[in] which Only reading is supported
+   * \return New position or -1 if the seek failed
+   */
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+ private:
+  /**
+   * Append the next frame to the data in memory.
+   *
+   * \return False at the end of the file
+   */
+  bool read_frame();
+
+  /**
+   * Let the get area cover the data in memory.
+   *
+   * \param[in] offset Offset of the current position from data_start_
+   */
+  void set_get_area(std::size_t offset);
+
+  /// Compressed file
+  bf::ifstream file_;
+  /// Codec that the file was compressed with
+  std::unique_ptr<CompressionCodec> codec_;
+  /// Uncompressed data in memory
+  std::string data_;
+  /// Position of the first byte of data_ in the uncompressed content
+  std::streamoff data_start_ = 0;
+};
+
+/**
+ * \ingroup output
+ *
+ * Collects everything that is written to a `FILE*` and writes it compressed
+ * into another file, one frame at a time. The frames are compressed on a
+ * separate thread, such that the simulation does not wait for the
+ * compression.
+ *
+ * A frame ends when end_frame() is called or when the collected data reaches
+ * a maximal size. Therefore a large event does not have to be kept in
+ * memory as a whole, but it may be split over several frames.
+ */
+class FrameCompressor {
+ public:
+  /**
+   * \param[in] target File that the compressed frames are written to. It has
+   *            to stay open as long as the compressor exists.
+   * \param[in] codec Codec that compresses the frames
+   * \param[in] max_frame_size Size of the uncompressed data, at which a frame
+   *            is ended also without end_frame() [bytes]
+   */
+  FrameCompressor(std::FILE *target, std::unique_ptr<CompressionCodec> codec,
+                  std::size_t max_frame_size = 1 << 22);
+
+  /// Compress the last frame and wait until everything is written.
+  ~FrameCompressor();
+
+  /// Cannot be copied
+  FrameCompressor(const FrameCompressor &) = delete;
+  /// Cannot be copied
+  FrameCompressor &operator=(const FrameCompressor &) = delete;
+
+  /// \return The file that collects the uncompressed data
+  std::FILE *get() { return collector_; }
+
+  /**
+   * End the current frame, such that everything written so far can be
+   * decompressed without the following frames. Nothing happens if nothing
+   * was written since the last frame.
+   */
+  void end_frame();
+
+  /**
+   * Append uncompressed data to the current frame and end the frame if it
+   * reached the maximal size. This is called for the data written to the
+   * collecting file.
+   *
+   * \param[in] data Data to append
+   * \param[in] size Size of the data [bytes]
+   */
+  void append(const char *data, std::size_t size);
+
+ private:
+  /// Hand the current frame over to the compressing thread.
+  void submit_frame();
+
+  /// File that the compressed frames are written to
+  std::FILE *target_;
+  /// Codec that compresses the frames
+  std::unique_ptr<CompressionCodec> codec_;
+  /// Size of the uncompressed data, at which a frame is ended [bytes]
+  const std::size_t max_frame_size_;
+  /// File that collects the uncompressed data
+  std::FILE *collector_ = nullptr;
+  /// Uncompressed data of the current frame
+  std::string frame_;
+  /// Compressed frame, only used on the compressing thread
+  std::string compressed_;
+  /// Compresses and writes the frames
+  OutputWriterThread writer_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_COMPRESSION_H_
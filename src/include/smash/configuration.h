@@ -299,6 +299,16 @@ namespace smash {
  * Number of fractional photons sampled per single perturbatively produced
  * photon.
  *
+ * \key Tabulated_Cross_Sections (bool, optional, default = false):\n
+ * Whether to look up the cross sections of the photon production in mesonic
+ * scattering processes in precomputed tables instead of evaluating the
+ * analytic formulas for every scattering. The tables are cached on disk
+ * together with the other tabulations (unless \c --no-cache is given) and
+ * the deviations from the analytic formulas are printed when they are
+ * created. The analytic formulas are still used close to the kinematic
+ * thresholds, above \f$ \sqrt{s} = 3 \f$ GeV and for rho masses above
+ * 1.47 GeV.
+ *
  * Remember to also activate the photon output in the output section.
  *
  * \n
@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_COULOMBSOLVER_H_
+#define SRC_INCLUDE_SMASH_COULOMBSOLVER_H_
+
+#include <array>
+#include <complex>
+#include <utility>
+#include <vector>
+
+#include "density.h"
+#include "fouriertransform.h"
+#include "lattice.h"
+#include "threevector.h"
+
+namespace smash {
+
+/**
+ * Computes the electric and magnetic fields on a lattice from the electric
+ * charge density and current, using fast Fourier transforms.
+ *
+ * The fields of the magnetostatic approximation,
+ * \f[ \vec{E}(\vec{r}_j) = \sum_{i \neq j} \rho(\vec{r}_i) \vec{K}(\vec{r}_j -
+ * \vec{r}_i), \quad \vec{B}(\vec{r}_j) = \sum_{i \neq j} \vec{j}(\vec{r}_i)
+ * \times \vec{K}(\vec{r}_j - \vec{r}_i), \quad \vec{K}(\vec{d}) = e \Delta V
+ * \frac{\vec{d}}{|\vec{d}|^3}, \f]
+ * are discrete convolutions of the sources with the kernel \f$ \vec{K} \f$.
+ * They are evaluated as products in Fourier space, which takes
+ * \f$ O(N \log N) \f$ operations for N lattice nodes instead of
+ * \f$ O(N M) \f$ for M nodes within the cutoff. The kernel is restricted to
+ * separations with \f$ |d_k| \leq R_\mathrm{cut} \f$ in every direction.
+ * For periodic lattices the convolution is cyclic, such that all periodic
+ * images of a source contribute. Otherwise the lattice is padded with empty
+ * cells to at least twice its size, which avoids any wrap-around.
+ */
+class CoulombFieldSolver {
+ public:
+  /**
+   * Set up the Fourier transforms and tabulate the transformed kernel.
+   *
+   * \param[in] n_cells Number of lattice nodes in x, y and z direction
+   * \param[in] cell_sizes Lattice spacings in x, y and z direction in fm
+   * \param[in] periodic Whether the lattice is periodic
+   * \param[in] r_cut Cutoff of the kernel in every direction in fm
+   */
+  CoulombFieldSolver(const std::array<int, 3> &n_cells,
+                     const std::array<double, 3> &cell_sizes, bool periodic,
+                     double r_cut);
+
+  /**
+   * Compute the electric and magnetic fields at all lattice nodes.
+   *
+   * \param[in] jmu_el Electric charge density and current on the lattice
+   * \param[out] em_lat Electric and magnetic fields in fm\f$^{-2}\f$ on a
+   *             lattice with the same geometry
+   * \param[in] n_threads Number of threads sharing the work
+   * \throw std::invalid_argument if a lattice does not match the geometry
+   *        the solver was set up for
+   */
+  void compute_fields(
+      const RectangularLattice<DensityOnLattice> &jmu_el,
+      RectangularLattice<std::pair<ThreeVector, ThreeVector>> &em_lat,
+      int n_threads = 1);
+
+  /// \return Number of points of the Fourier transforms in every direction
+  const std::array<int, 3> &transform_dims() const { return fft_.dims(); }
+
+ private:
+  /**
+   * \param[in] ix Index in x direction
+   * \param[in] iy Index in y direction
+   * \param[in] iz Index in z direction
+   * \return Index of the given point of the Fourier transforms
+   */
+  int transform_index(int ix, int iy, int iz) const {
+    const std::array<int, 3> &m = fft_.dims();
+    return ix + m[0] * (iy + m[1] * iz);
+  }
+
+  /// Number of lattice nodes in x, y and z direction
+  std::array<int, 3> n_cells_;
+  /// Whether the lattice is periodic
+  bool periodic_;
+  /// Fourier transform of the padded lattice
+  FourierTransform3D fft_;
+  /**
+   * Imaginary parts of the transformed kernel components; the kernel is odd,
+   * so its transform is purely imaginary.
+   */
+  std::array<std::vector<double>, 3> kernel_;
+  /// Transformed sources \f$ \rho + i j_x \f$ and \f$ j_y + i j_z \f$
+  std::array<std::vector<std::complex<double>>, 2> sources_;
+  /// Fields \f$ E_x + i E_y \f$, \f$ E_z + i B_x \f$ and \f$ B_y + i B_z \f$
+  std::array<std::vector<std::complex<double>>, 3> fields_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_COULOMBSOLVER_H_
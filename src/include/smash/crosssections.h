@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "forwarddeclarations.h"
 #include "isoparticletype.h"
@@ -109,6 +110,44 @@ class CrossSections {
       NNbarTreatment nnbar_treatment, StringProcess* string_process,
       double scale_xs, double additional_el_xs) const;
 
+  /**
+   * Generate a list of all elastic and 2->1 processes.
+   *
+   * This is a reduced version of generate_collision_list for the case that no
+   * other binary reactions are enabled. Instead of all particle types, only
+   * a precomputed list of resonances that can be formed by the incoming pair
+   * is considered, see resonance_formation_table. The resulting list is
+   * identical to the one of generate_collision_list in that case.
+   *
+   * \param[in] elastic_parameter Value of the constant global elastic cross
+   *            section, if it is non-zero.
+   *            The parametrized elastic cross section is used otherwise.
+   * \param[in] include_elastic Are elastic reactions enabled?
+   * \param[in] low_snn_cut Elastic collisions with CME below are forbidden.
+   * \param[in] use_AQM Is the Additive Quark Model enabled?
+   * \param[in] resonances Resonances that can be formed by the incoming
+   *            particles, empty if 2->1 reactions are disabled.
+   * \param[in] scale_xs Factor by which all (partial) cross sections are scaled
+   * \param[in] additional_el_xs Additional constant elastic cross section
+   * \return List of all possible collisions.
+   */
+  CollisionBranchList generate_elastic_and_resonance_list(
+      double elastic_parameter, bool include_elastic, double low_snn_cut,
+      bool use_AQM, const ParticleTypePtrList& resonances, double scale_xs,
+      double additional_el_xs) const;
+
+  /**
+   * List the resonances which can be formed in a 2->1 reaction for every
+   * pair of particle types, i.e. all unstable types with a two-body decay
+   * mode into the pair. The resonances are listed in the order of
+   * ParticleType::list_all().
+   *
+   * \return Table indexed by i * N + j, where i and j are the positions of
+   *         the two types in ParticleType::list_all() and N is the number of
+   *         particle types.
+   */
+  static std::vector<ParticleTypePtrList> resonance_formation_table();
+
   /**
    * Helper function:
    * Sum all cross sections of the given process list.
@@ -159,6 +198,18 @@ class CrossSections {
    */
   CollisionBranchList two_to_one(const bool prevent_dprime_form) const;
 
+  /**
+   * Find the production cross sections of the given resonances in a 2->1
+   * collision of the two input particles.
+   *
+   * \param[in] resonances Candidate resonances, from
+   *            resonance_formation_table.
+   *
+   * \return A list of processes with resonance in the final state, see
+   *         two_to_one(const bool).
+   */
+  CollisionBranchList two_to_one(const ParticleTypePtrList& resonances) const;
+
   /**
    * Return the 2-to-1 resonance production cross section for a given resonance.
    *
@@ -350,6 +401,19 @@ class CrossSections {
                                   const double region_upper) const;
 
  private:
+  /**
+   * Add the process forming the given resonance in a 2->1 collision to a
+   * list of processes, if its cross section is non-negligible.
+   *
+   * \param[in,out] process_list List to which the process is added.
+   * \param[in] type_resonance Type information for the resonance.
+   * \param[in] cm_momentum_sqr Square of the center-of-mass momentum of the
+   * two initial particles.
+   */
+  void append_formation(CollisionBranchList& process_list,
+                        const ParticleType& type_resonance,
+                        double cm_momentum_sqr) const;
+
   /**
    * Choose the appropriate parametrizations for given incoming particles and
    * return the (parametrized) elastic cross section.
@@ -14,7 +14,7 @@
 #include <memory>
 
 #include "interpolation.h"
-#include "interpolation2D.h"
+#include "tabulation.h"
 
 namespace smash {
 // sqrt(s), k and theta lists are identical for all channels, so we need
@@ -81,15 +81,19 @@ const std::initializer_list<double> BREMS_THETA = {
     2.78369,  2.82346,  2.86322,  2.90299,  2.94276,  2.98252,  3.02229,
     3.06206,  3.10183,  3.14159};
 
+// The tabulated differential cross sections are resampled once onto uniform
+// grids in (ln k, sqrt(s)) and (theta, sqrt(s)), which are stored in single
+// precision and looked up by bilinear interpolation.
+
 /** @name Interpolation objects for π+- + π-+ -> π+- + π-+ + γ processes
 // (opposite charge incoming pions, charged pions in final state)
  */
 ///@{
 static std::unique_ptr<InterpolateDataLinear<double>>
     pipi_pipi_opp_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pipi_opp_dsigma_dk_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pipi_opp_dsigma_dtheta_interpolation = nullptr;
 ///@}
 
@@ -8967,9 +8971,9 @@ const std::initializer_list<double> BREMS_PIPI_PIPI_OPP_DIFF_SIG_THETA = {
 ///@{
 static std::unique_ptr<InterpolateDataLinear<double>>
     pipi_pipi_same_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pipi_same_dsigma_dk_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pipi_same_dsigma_dtheta_interpolation = nullptr;
 ///@}
 
@@ -18752,9 +18756,9 @@ const std::initializer_list<double> BREMS_PIPI_PIPI_SAME_DIFF_SIG_THETA = {
 ///@{
 static std::unique_ptr<InterpolateDataLinear<double>>
     pipi0_pipi0_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi0_pipi0_dsigma_dk_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi0_pipi0_dsigma_dtheta_interpolation = nullptr;
 ///@}
 
@@ -27637,9 +27641,9 @@ const std::initializer_list<double> BREMS_PIPI0_PIPI0_DIFF_SIG_THETA = {
 ///@{
 static std::unique_ptr<InterpolateDataLinear<double>>
     pipi_pi0pi0_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pi0pi0_dsigma_dk_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pipi_pi0pi0_dsigma_dtheta_interpolation = nullptr;
 ///@}
 
@@ -35880,9 +35884,9 @@ const std::initializer_list<double> BREMS_PIPI_PI0PI0_DIFF_SIG_THETA = {
 ///@{
 static std::unique_ptr<InterpolateDataLinear<double>>
     pi0pi0_pipi_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pi0pi0_pipi_dsigma_dk_interpolation = nullptr;
-static std::unique_ptr<InterpolateData2DSpline>
+static std::unique_ptr<FloatGridTabulation>
     pi0pi0_pipi_dsigma_dtheta_interpolation = nullptr;
 ///@}
 
@@ -11,7 +11,9 @@
 #define SRC_INCLUDE_SMASH_CROSSSECTIONSPHOTON_H_
 
 #include "cxx14compat.h"
+#include "forwarddeclarations.h"
 #include "kinematics.h"
+#include "sha256.h"
 
 namespace smash {
 /** Cross section after cut off.
@@ -32,10 +34,11 @@ namespace smash {
 double cut_off(const double sigma_mb);
 
 /**
- * Calculation method for the cross sections. It has only one member at the
- * moment. In the future there will be more options.
+ * Calculation method for the cross sections. Either the analytic formulas are
+ * evaluated directly, or the cross sections are looked up in tables that were
+ * precomputed from the analytic formulas.
  */
-enum class ComputationMethod { Analytic };
+enum class ComputationMethod { Analytic, Lookup };
 
 template <ComputationMethod method>
 class CrosssectionsPhoton {};
@@ -142,6 +145,106 @@ class CrosssectionsPhoton<ComputationMethod::Analytic> {
   constexpr static double Pi = M_PI;
 };
 
+/**
+ * Class to look up the cross-section of a meson-meson to meson-photon process
+ * in precomputed tables. This template specialization provides the same
+ * interface as the analytic one.
+ *
+ * The total cross sections are tabulated on a \f$ (\sqrt{s}, m_\rho) \f$ grid
+ * and the differential cross sections on a \f$ (\sqrt{s}, t, m_\rho) \f$ grid,
+ * where t is mapped onto the kinematically allowed range for the given
+ * \f$ \sqrt{s} \f$ and \f$ m_\rho \f$. The mass of the rho meson is a grid
+ * dimension, because it is sampled from the spectral function for every
+ * reaction. Outside of the tabulated domain, in grid cells touching the
+ * kinematic threshold (where the cross sections diverge) and before
+ * tabulate() was called, the analytic formulas are used.
+ */
+template <>
+class CrosssectionsPhoton<ComputationMethod::Lookup> {
+ public:
+  /**
+   * Create the tables from the analytic formulas or read them from disk.
+   *
+   * \param[in] hash Hash of the SMASH version and the particle properties,
+   *            used to validate the tables on disk.
+   * \param[in] tabulations_path Directory where the tables are cached. If it
+   *            is empty, the tables are neither read nor stored.
+   */
+  static void tabulate(sha256::Hash hash, const bf::path &tabulations_path);
+
+  /// \return Whether the tables were created.
+  static bool is_tabulated();
+
+  /**
+   * Compare the tables against the analytic formulas in the centers of the
+   * grid cells and log the deviations for every cross section.
+   */
+  static void report_accuracy();
+
+  /** @name Total cross-section
+   * The functions in this group look up the total cross-section for a photon
+   * process.
+   */
+  ///@{
+  /**
+   * Total cross sections for given photon process:
+   *
+   * \param[in] s Mandelstam-s [GeV^2]
+   * \param[in] m_rho Mass of participating rho-meson [GeV]
+   * \returns photon cross-section [mb]
+   */
+  static double xs_pi_pi_rho0(const double s, const double m_rho);
+  static double xs_pi_pi0_rho(const double s, const double m_rho);
+  static double xs_pi0_rho0_pi0(const double s, const double m_rho);
+  static double xs_pi_rho0_pi(const double s, const double m_rho);
+
+  static double xs_pi_rho_pi0(const double s, const double m_rho);
+  static double xs_pi_rho_pi0_rho_mediated(const double s, const double m_rho);
+  static double xs_pi_rho_pi0_omega_mediated(const double s,
+                                             const double m_rho);
+
+  static double xs_pi0_rho_pi(const double s, const double m_rho);
+  static double xs_pi0_rho_pi_rho_mediated(const double s, const double m_rho);
+  static double xs_pi0_rho_pi_omega_mediated(const double s,
+                                             const double m_rho);
+  ///@}
+
+  /** @name Differential cross-section
+   * The functions in this group look up the differential cross-section for a
+   * photon process.
+   */
+  ///@{
+  /**
+   * Differential cross section for given photon process.
+   *
+   * \param[in] s Mandelstam-s [GeV^2]
+   * \param[in] t Mandelstam-t [GeV^2]
+   * \param[in] m_rho Mass of participating rho-meson [GeV]
+   * \returns photon cross-section [mb]
+   */
+  static double xs_diff_pi_pi_rho0(const double s, const double t,
+                                   const double m_rho);
+  static double xs_diff_pi_pi0_rho(const double s, const double t,
+                                   const double m_rho);
+  static double xs_diff_pi0_rho0_pi0(const double s, const double t,
+                                     const double m_rho);
+  static double xs_diff_pi_rho0_pi(const double s, const double t,
+                                   const double m_rho);
+
+  static double xs_diff_pi_rho_pi0_rho_mediated(const double s, const double t,
+                                                const double m_rho);
+  static double xs_diff_pi_rho_pi0_omega_mediated(const double s,
+                                                  const double t,
+                                                  const double m_rho);
+
+  static double xs_diff_pi0_rho_pi_rho_mediated(const double s, const double t,
+                                                const double m_rho);
+  static double xs_diff_pi0_rho_pi_omega_mediated(const double s,
+                                                  const double t,
+                                                  const double m_rho);
+  ///@}
+};
+
 }  // namespace smash
 
 #endif  // SRC_INCLUDE_SMASH_CROSSSECTIONSPHOTON_H_
@@ -72,6 +72,14 @@ class DecayActionsFinder : public ActionFinderInterface {
 
   /// Multiplicative factor to be applied to resonance lifetimes
   const double res_lifetime_factor_ = 1.;
+
+ private:
+  /**
+   * Number of decay modes, for which the partial widths are evaluated in a
+   * buffer on the stack. This covers all particle types of the default
+   * particle list; others are handled with a heap-allocated buffer.
+   */
+  static constexpr size_t max_decay_modes_on_stack = 64;
 };
 
 }  // namespace smash
@@ -10,6 +10,8 @@
 #ifndef SRC_INCLUDE_SMASH_DECAYACTIONSFINDERDILEPTON_H_
 #define SRC_INCLUDE_SMASH_DECAYACTIONSFINDERDILEPTON_H_
 
+#include <vector>
+
 #include "outputinterface.h"
 
 namespace smash {
@@ -26,11 +28,21 @@ namespace smash {
  * See \iref{Schmidt:2008hm}, chapter 2D.
  * The finder works with two body dilepton decays as well as with dalitz
  * dilepton decays.
+ *
+ * Since only few particle types can decay into dileptons, the finder
+ * determines these types and their dilepton decay modes once at
+ * construction. All other particles are skipped without evaluating any
+ * widths. The dilepton decays found in one search are kept as compact
+ * records and passed to the output in one call.
  */
 class DecayActionsFinderDilepton {
  public:
-  /// Initialize the finder
-  DecayActionsFinderDilepton() {}
+  /**
+   * Initialize the finder and find the dilepton decay modes of all particle
+   * types. Therefore the particle types and decay modes have to be set up
+   * before.
+   */
+  DecayActionsFinderDilepton();
 
   /**
    * Check the whole particles list and print out possible dilepton decays.
@@ -56,6 +68,35 @@ class DecayActionsFinderDilepton {
    */
   void shine_final(const Particles& search_list, OutputInterface* output,
                    bool only_res = false) const;
+
+ private:
+  /**
+   * Sample the final state of a dilepton decay.
+   *
+   * \param[in] p Decaying particle.
+   * \param[in] mode Dilepton decay mode.
+   * \param[in] width Partial width of the mode [GeV].
+   * \param[in] shining_weight Shining weight of the decay.
+   * \return Record of the decay for the output.
+   */
+  static DileptonDecay sample_decay(const ParticleData& p,
+                                    const DecayType& mode, double width,
+                                    double shining_weight);
+
+  /**
+   * \param[in] type A particle type.
+   * \return the positions of the dilepton decay modes of \p type in its decay
+   *         mode list.
+   */
+  const std::vector<unsigned int>& dilepton_modes(
+      const ParticleType& type) const;
+
+  /**
+   * Positions of the dilepton decay modes in the decay mode list, for each
+   * particle type (in the order of ParticleType::list_all). Empty for types,
+   * which cannot shine.
+   */
+  std::vector<std::vector<unsigned int>> dilepton_modes_;
 };
 
 }  // namespace smash
@@ -9,6 +9,7 @@
 #define SRC_INCLUDE_SMASH_DECAYTYPE_H_
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "forwarddeclarations.h"
@@ -29,8 +30,7 @@ class DecayType {
    * \param[in] l Angular momentum of the decay.
    * \return The constructed object.
    */
-  DecayType(ParticleTypePtrList part_types, int l)
-      : particle_types_(part_types), L_(l) {}
+  DecayType(ParticleTypePtrList part_types, int l);
   /**
    * Virtual Destructor.
    *
@@ -59,6 +59,16 @@ class DecayType {
   const ParticleTypePtrList &particle_types() const { return particle_types_; }
   /// \return the angular momentum of this branch.
   inline int angular_momentum() const { return L_; }
+  /**
+   * \return the summed potential scale factors of the final-state particles,
+   * for the Skyrme/VDF potential (first) and for the symmetry potential
+   * (second, already weighted with the relative isospin projection).
+   *
+   * \see Potentials::force_scale
+   */
+  const std::pair<double, double> &final_state_force_scale() const {
+    return final_state_force_scale_;
+  }
   /**
    * \return the mass-dependent width of the decay.
    *
@@ -84,6 +94,11 @@ class DecayType {
   ParticleTypePtrList particle_types_;
   /// angular momentum of the decay
   int L_;
+  /**
+   * Potential scale factors of the final state; they only depend on the
+   * particle types and are therefore computed once at construction.
+   */
+  std::pair<double, double> final_state_force_scale_;
 };
 
 /**
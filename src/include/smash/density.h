@@ -9,7 +9,9 @@
 #ifndef SRC_INCLUDE_SMASH_DENSITY_H_
 #define SRC_INCLUDE_SMASH_DENSITY_H_
 
+#include <algorithm>
 #include <iostream>
+#include <map>
 #include <tuple>
 #include <typeinfo>
 #include <utility>
@@ -20,6 +22,7 @@
 #include "forwarddeclarations.h"
 #include "fourvector.h"
 #include "lattice.h"
+#include "parallel.h"
 #include "particledata.h"
 #include "particles.h"
 #include "pdgcode.h"
@@ -115,8 +118,9 @@ class DensityParameters {
    *            \f$r_{\rm cut}=a\sigma\f$, the test-particle number, the number
    *            of ensembles, the mode of calculating the derivatives, the
    *            smearing mode, the central weight for Discrete smearing, the
-   *            range (in units of lattice spacing) for Triangular smearing
-   *            and the flag about using only participants or also spectators
+   *            range (in units of lattice spacing) for Triangular smearing,
+   *            the number of lattice threads and the flag about using only
+   *            participants or also spectators
    */
   DensityParameters(const ExperimentParameters &par)  // NOLINT
       : sig_(par.gaussian_sigma),
@@ -128,6 +132,7 @@ class DensityParameters {
         smearing_(par.smearing_mode),
         central_weight_(par.discrete_weight),
         triangular_range_(par.triangular_range),
+        n_threads_(par.lattice_threads),
         only_participants_(par.only_participants) {
     r_cut_sqr_ = r_cut_ * r_cut_;
     const double two_sig_sqr = 2 * sig_ * sig_;
@@ -153,6 +158,8 @@ class DensityParameters {
   double central_weight() const { return central_weight_; }
   /// \return Range of the triangular smearing, in units of lattice spacing
   double triangular_range() const { return triangular_range_; }
+  /// \return Number of threads used for the lattice updates
+  int n_threads() const { return n_threads_; }
   /// \return Cut-off radius [fm]
   double r_cut() const { return r_cut_; }
   /// \return Squared cut-off radius [fm\f$^2\f$]
@@ -193,6 +200,8 @@ class DensityParameters {
   const double central_weight_;
   /// Range of the triangular smearing
   const double triangular_range_;
+  /// Number of threads used for the lattice updates
+  const int n_threads_;
   /// Flag to take into account only participants
   bool only_participants_;
 };
@@ -279,6 +288,63 @@ std::tuple<double, FourVector, ThreeVector, ThreeVector, FourVector, FourVector,
 current_eckart(const ThreeVector &r, const Particles &plist,
                const DensityParameters &par, DensityType dens_type,
                bool compute_gradient, bool smearing);
+/**
+ * convenience overload of the above (ParticleList -> list of pointers, e.g.
+ * the neighbors of the point from ParticleCells)
+ */
+std::tuple<double, FourVector, ThreeVector, ThreeVector, FourVector, FourVector,
+           FourVector, FourVector>
+current_eckart(const ThreeVector &r,
+               const std::vector<const ParticleData *> &plist,
+               const DensityParameters &par, DensityType dens_type,
+               bool compute_gradient, bool smearing);
+
+/**
+ * The positive and negative summands of the four-current on a lattice node,
+ * without the derivatives. It serves as a compact node for the partial sums
+ * of single threads in update_lattice(), when no gradients are smeared onto
+ * the lattice. It then takes 64 instead of 224 bytes per node, see
+ * DensityOnLattice.
+ */
+class CurrentOnLattice {
+ public:
+  /**
+   * Adds a particle to the four-current, like
+   * DensityOnLattice::add_particle().
+   *
+   * \param[in] part Particle would be added to the current density on the
+   *            lattice.
+   * \param[in] FactorTimesSf particle's factor for the density times the
+   *            smearing factor.
+   */
+  void add_particle(const ParticleData &part, double FactorTimesSf) {
+    const FourVector part_four_velocity = FourVector(1.0, part.velocity());
+    if (FactorTimesSf > 0.0) {
+      jmu_pos_ += part_four_velocity * FactorTimesSf;
+    } else {
+      jmu_neg_ += part_four_velocity * FactorTimesSf;
+    }
+  }
+
+  /**
+   * Dummy function, the node has no derivatives. It is only used if the
+   * smeared gradients vanish, see update_lattice().
+   */
+  void add_particle_for_derivatives(const ParticleData &, double,
+                                    ThreeVector) {}
+
+  /// \return Four-current density of the positively charged particles
+  FourVector jmu_pos() const { return jmu_pos_; }
+
+  /// \return Four-current density of the negatively charged particles
+  FourVector jmu_neg() const { return jmu_neg_; }
+
+ private:
+  /// Four-current density of the positively charged particles.
+  FourVector jmu_pos_;
+  /// Four-current density of the negatively charged particles.
+  FourVector jmu_neg_;
+};
 
 /**
  * A class for time-efficient (time-memory trade-off) calculation of density
@@ -359,6 +425,35 @@ class DensityOnLattice {
     }
   }
 
+  /**
+   * Add the currents and their derivatives of another node, which was filled
+   * with a different set of particles.
+   *
+   * \param[in] node Node to be added
+   * \return This node
+   */
+  DensityOnLattice &operator+=(const DensityOnLattice &node) {
+    jmu_pos_ += node.jmu_pos_;
+    jmu_neg_ += node.jmu_neg_;
+    for (int k = 0; k < 4; k++) {
+      djmu_dxnu_[k] += node.djmu_dxnu_[k];
+    }
+    drho_dxnu_ += node.drho_dxnu_;
+    return *this;
+  }
+
+  /**
+   * Adds the four-currents of a compact node.
+   *
+   * \param[in] node The node whose four-currents are added
+   * \return The updated node
+   */
+  DensityOnLattice &operator+=(const CurrentOnLattice &node) {
+    jmu_pos_ += node.jmu_pos();
+    jmu_neg_ += node.jmu_neg();
+    return *this;
+  }
+
   /**
    * Compute the net Eckart density on the local lattice
    *
@@ -520,9 +615,280 @@ class DensityOnLattice {
 /// Conveniency typedef for lattice of density
 typedef RectangularLattice<DensityOnLattice> DensityLattice;
 
+/**
+ * Type of the nodes on which single threads accumulate their partial sums in
+ * update_lattice() if no gradients are smeared. By default these are the
+ * nodes of the lattice itself.
+ *
+ * \tparam T Type of the nodes of the lattice
+ */
+template <typename T>
+struct CompactNode {
+  /// Type of the compact node
+  typedef T type;
+};
+
+/// The compact node of the density lattices holds only the four-currents
+template <>
+struct CompactNode<DensityOnLattice> {
+  /// Type of the compact node
+  typedef CurrentOnLattice type;
+};
+
+/**
+ * Adds the covariant Gaussian smearing of a particle to the lattice nodes
+ * within the cut-off radius.
+ *
+ * The result is the same as evaluating unnormalized_smearing_factor for every
+ * node, but the exponentials are mostly avoided: Along a row of nodes in x
+ * direction the exponent \f$ E_k = r_{rest}^2(x_k) / (2 \sigma^2) \f$ is a
+ * quadratic function of the index k. The smearing factor therefore follows
+ * the recursion \f$ f_{k+1} = f_k R_k \f$, \f$ R_{k+1} = R_k Q \f$ with a
+ * constant \f$ Q \f$ per particle, and only \f$ f \f$ and \f$ R \f$ at
+ * the first node of a row within the cut-off need exponentials. Starting
+ * there keeps all factors bounded by \f$ \exp(r_{cut}^2 / (2 \sigma^2)) \f$.
+ * The nodes of a row within the cut-off ellipsoid are found by solving the
+ * quadratic equation, so nodes outside of it are not visited.
+ *
+ * \param[out] lat The lattice on which the particle is smeared
+ * \param[in] part The particle to be smeared
+ * \param[in] m_inv Inverse mass of the particle \f$ (E^2 - p^2)^{-1/2} \f$
+ *            [GeV\f$^{-1}\f$]
+ * \param[in] dens_factor Contribution of the particle to the density type
+ * \param[in] par Parameters of the smearing
+ * \param[in] compute_gradient Whether to compute the gradients
+ * \tparam T LatticeType
+ */
+template <typename T>
+void add_covariant_gaussian_smearing(RectangularLattice<T> &lat,
+                                     const ParticleData &part,
+                                     const double m_inv,
+                                     const double dens_factor,
+                                     const DensityParameters &par,
+                                     const bool compute_gradient) {
+  const ThreeVector pos = part.position().threevec();
+  const FourVector u = part.momentum() * m_inv;
+  const ThreeVector u_vec = u.threevec();
+  const double a = par.two_sig_sqr_inv();
+  const double h = lat.cell_sizes()[0];
+  const double c_xx = 1.0 + u_vec.x1() * u_vec.x1();
+  // ratio of consecutive R_k along a row
+  const double q = std::exp(-2.0 * a * c_xx * h * h);
+  const double weight = dens_factor * par.norm_factor_sf();
+  const bool gaussian_derivatives =
+      par.derivatives() == DerivativesMode::CovariantGaussian;
+
+  /* Range of x within the cut-off ellipsoid for a row. It is widened a bit
+   * against rounding, the nodes are checked individually below anyway. */
+  auto x_range = [&](int iy, int iz) {
+    const ThreeVector center = lat.cell_center(0, iy, iz);
+    const double ry = pos.x2() - center.x2();
+    const double rz = pos.x3() - center.x3();
+    const double u_r_perp = u_vec.x2() * ry + u_vec.x3() * rz;
+    const double b = u_vec.x1() * u_r_perp;
+    const double discriminant =
+        b * b - c_xx * (ry * ry + rz * rz + u_r_perp * u_r_perp -
+                        par.r_cut_sqr());
+    const double sqrt_disc = std::sqrt(std::max(discriminant, 0.0));
+    return std::make_pair(pos.x1() + (b - sqrt_disc) / c_xx - really_small,
+                          pos.x1() + (b + sqrt_disc) / c_xx + really_small);
+  };
+
+  // state of the recursion along the current row
+  bool in_row = false;
+  int next_ix = 0, row_iy = 0, row_iz = 0;
+  double f = 0.0, ratio = 0.0;
+  auto add_to_node = [&](T &node, int ix, int iy, int iz) {
+    const ThreeVector r = pos - lat.cell_center(ix, iy, iz);
+    const double u_r = u_vec * r;
+    const double r_rest_sqr = r.sqr() + u_r * u_r;
+    // Lorentz contracted distance from particle to node > r_cut
+    if (r_rest_sqr > par.r_cut_sqr()) {
+      in_row = false;
+      return;
+    }
+    if (in_row && ix == next_ix && iy == row_iy && iz == row_iz) {
+      f *= ratio;
+      ratio *= q;
+    } else {
+      f = std::exp(-a * r_rest_sqr);
+      // E_{k+1} - E_k for the step from this node to the next one
+      const double u_r_perp = u_r - u_vec.x1() * r.x1();
+      const double delta =
+          a * h * (c_xx * (h - 2.0 * r.x1()) - 2.0 * u_vec.x1() * u_r_perp);
+      ratio = std::exp(-delta);
+      in_row = true;
+      row_iy = iy;
+      row_iz = iz;
+    }
+    next_ix = ix + 1;
+
+    const double sf = f * u.x0();
+    node.add_particle(part, sf * weight);
+    if (gaussian_derivatives) {
+      const ThreeVector sf_grad = compute_gradient
+                                      ? sf * (r + u_vec * u_r) * a * 2.0
+                                      : ThreeVector(0.0, 0.0, 0.0);
+      node.add_particle_for_derivatives(part, dens_factor,
+                                        sf_grad * par.norm_factor_sf());
+    }
+  };
+  lat.iterate_in_cube_rows(pos, par.r_cut(), x_range, add_to_node);
+}
+
+/**
+ * Smears a particle onto the lattice with the smearing mode of the density
+ * parameters.
+ *
+ * \param[out] lat The lattice on which the particle is smeared
+ * \param[in] part The particle to be smeared
+ * \param[in] dens_type density type to be computed on the lattice
+ * \param[in] par a structure containing testparticles number and gaussian
+ *            smearing parameters.
+ * \param[in] compute_gradient Whether to compute the gradients
+ * \tparam T LatticeType
+ */
+template <typename T>
+void smear_particle(RectangularLattice<T> &lat, const ParticleData &part,
+                    const DensityType dens_type, const DensityParameters &par,
+                    const bool compute_gradient) {
+  if (par.only_participants()) {
+    // if this conditions holds, the hadron is a spectator
+    if (part.get_history().collisions_per_particle == 0) {
+      return;
+    }
+  }
+  const double dens_factor = density_factor(part.type(), dens_type);
+  if (std::abs(dens_factor) < really_small) {
+    return;
+  }
+  const FourVector p_mu = part.momentum();
+  const ThreeVector pos = part.position().threevec();
+
+  // act accordingly to which smearing is used
+  if (par.smearing() == SmearingMode::CovariantGaussian) {
+    const double m = p_mu.abs();
+    if (unlikely(m < really_small)) {
+      logg[LDensity].warn("Gaussian smearing is undefined for momentum ",
+                          p_mu);
+      return;
+    }
+    const double m_inv = 1.0 / m;
+
+    add_covariant_gaussian_smearing(lat, part, m_inv, dens_factor, par,
+                                    compute_gradient);
+  } else if (par.smearing() == SmearingMode::Discrete) {
+    // get the volume of the cell and weights for discrete smearing
+    const double V_cell =
+        lat.cell_sizes()[0] * lat.cell_sizes()[1] * lat.cell_sizes()[2];
+    const double big = par.central_weight();
+    const double small = (1.0 - big) / 6.0;
+    // unweighted contribution to density
+    const double common_weight =
+        dens_factor / (par.ntest() * par.nensembles() * V_cell);
+    lat.iterate_nearest_neighbors(
+        pos, [&](T &node, int iterated_index, int center_index) {
+          node.add_particle(
+              part, common_weight *
+                        // the contribution to density is weighted depending
+                        // on what node it is added to
+                        (iterated_index == center_index ? big : small));
+        });
+  } else if (par.smearing() == SmearingMode::Triangular) {
+    // get the radii for triangular smearing
+    const std::array<double, 3> triangular_radius = {
+        par.triangular_range() * lat.cell_sizes()[0],
+        par.triangular_range() * lat.cell_sizes()[1],
+        par.triangular_range() * lat.cell_sizes()[2]};
+    // unweighted contribution to density
+    const double common_weight =
+        dens_factor /
+        (par.ntest() * par.nensembles() * triangular_radius[0] *
+         triangular_radius[0] * triangular_radius[1] * triangular_radius[1] *
+         triangular_radius[2] * triangular_radius[2]);
+    lat.iterate_in_rectangle(
+        pos, triangular_radius, [&](T &node, int ix, int iy, int iz) {
+          // compute the position of the node
+          const ThreeVector cell_center = lat.cell_center(ix, iy, iz);
+          // compute smearing weight
+          const double weight_x =
+              triangular_radius[0] - std::abs(cell_center[0] - pos[0]);
+          const double weight_y =
+              triangular_radius[1] - std::abs(cell_center[1] - pos[1]);
+          const double weight_z =
+              triangular_radius[2] - std::abs(cell_center[2] - pos[2]);
+          // add the contribution to the node
+          node.add_particle(part,
+                            common_weight * weight_x * weight_y * weight_z);
+        });
+  }
+}
+
+/**
+ * Smears the particles onto the lattice on several threads.
+ *
+ * Every thread smears a contiguous block of the particles onto its own
+ * scratch lattice, the first thread onto the lattice itself. Afterwards the
+ * scratch lattices are added node by node in the order of the blocks. The
+ * scratch lattices are kept by the lattice between the updates. The result
+ * therefore does not depend on the scheduling of the threads, only the
+ * order of the floating-point additions depends on the number of threads.
+ *
+ * \param[in,out] lat The lattice on which the particles are smeared
+ * \param[in] particles The particles to be smeared
+ * \param[in] dens_type density type to be computed on the lattice
+ * \param[in] par a structure containing testparticles number and gaussian
+ *            smearing parameters.
+ * \param[in] compute_gradient Whether to compute the gradients
+ * \tparam T LatticeType
+ * \tparam P Type of the nodes of the scratch lattices, which must hold
+ *           everything that is smeared
+ */
+template <typename T, typename P>
+void smear_particles_in_parallel(
+    RectangularLattice<T> &lat,
+    const std::vector<const ParticleData *> &particles,
+    const DensityType dens_type, const DensityParameters &par,
+    const bool compute_gradient) {
+  const int n_particles = particles.size();
+  const int n_blocks = std::max(1, std::min(par.n_threads(), n_particles));
+  std::vector<RectangularLattice<P>> &partial_lats =
+      lat.template scratch_lattices<P>(n_blocks - 1);
+  parallel_for_blocks(
+      n_particles, n_blocks, [&](int begin, int end, int block) {
+        if (block == 0) {
+          for (int i = begin; i < end; i++) {
+            smear_particle(lat, *particles[i], dens_type, par,
+                           compute_gradient);
+          }
+          return;
+        }
+        RectangularLattice<P> &partial = partial_lats[block - 1];
+        partial.reset();
+        for (int i = begin; i < end; i++) {
+          smear_particle(partial, *particles[i], dens_type, par,
+                         compute_gradient);
+        }
+      });
+  const int n_nodes = lat.size();
+  parallel_for_blocks(n_nodes, par.n_threads(), [&](int begin, int end, int) {
+    for (const RectangularLattice<P> &partial : partial_lats) {
+      for (int i = begin; i < end; i++) {
+        lat[i] += partial[i];
+      }
+    }
+  });
+}
+
 /**
  * Updates the contents on the lattice.
  *
+ * With several threads, the partial sums of the threads are accumulated in
+ * double precision on scratch lattices, see smear_particles_in_parallel().
+ * Their nodes hold only the four-currents (CompactNode) unless the gradients
+ * are smeared, i.e. unless they are computed with covariant Gaussian
+ * smearing and derivatives.
+ *
  * \param[out] lat The lattice on which the content will be updated
  * \param[in] update tells if called for update at printout or at timestep
  * \param[in] dens_type density type to be computed on the lattice
@@ -543,102 +909,86 @@ void update_lattice(RectangularLattice<T> *lat, const LatticeUpdate update,
   }
 
   lat->reset();
-  // get the normalization factor for the covariant Gaussian smearing
-  const double norm_factor_gaus = par.norm_factor_sf();
-  // get the volume of the cell and weights for discrete smearing
-  const double V_cell =
-      (lat->cell_sizes())[0] * (lat->cell_sizes())[1] * (lat->cell_sizes())[2];
-  // weights for coarse smearing
-  const double big = par.central_weight();
-  const double small = (1.0 - big) / 6.0;
-  // get the radii for triangular smearing
-  const std::array<double, 3> triangular_radius = {
-      par.triangular_range() * (lat->cell_sizes())[0],
-      par.triangular_range() * (lat->cell_sizes())[1],
-      par.triangular_range() * (lat->cell_sizes())[2]};
-  const double prefactor_triangular =
-      1.0 /
-      (par.ntest() * par.nensembles() * triangular_radius[0] *
-       triangular_radius[0] * triangular_radius[1] * triangular_radius[1] *
-       triangular_radius[2] * triangular_radius[2]);
+  if (par.n_threads() <= 1) {
+    for (const Particles &particles : ensembles) {
+      for (const ParticleData &part : particles) {
+        smear_particle(*lat, part, dens_type, par, compute_gradient);
+      }
+    }
+    return;
+  }
 
+  std::vector<const ParticleData *> all_particles;
   for (const Particles &particles : ensembles) {
     for (const ParticleData &part : particles) {
-      if (par.only_participants()) {
-        // if this conditions holds, the hadron is a spectator
-        if (part.get_history().collisions_per_particle == 0) {
-          continue;
-        }
-      }
-      const double dens_factor = density_factor(part.type(), dens_type);
-      if (std::abs(dens_factor) < really_small) {
-        continue;
-      }
-      const FourVector p_mu = part.momentum();
-      const ThreeVector pos = part.position().threevec();
-
-      // act accordingly to which smearing is used
-      if (par.smearing() == SmearingMode::CovariantGaussian) {
-        const double m = p_mu.abs();
-        if (unlikely(m < really_small)) {
-          logg[LDensity].warn("Gaussian smearing is undefined for momentum ",
-                              p_mu);
-          continue;
-        }
-        const double m_inv = 1.0 / m;
-
-        // unweighted contribution to density
-        const double common_weight = dens_factor * norm_factor_gaus;
-        lat->iterate_in_cube(
-            pos, par.r_cut(), [&](T &node, int ix, int iy, int iz) {
-              // find the weight for smearing
-              const ThreeVector r = lat->cell_center(ix, iy, iz);
-              const auto sf = unnormalized_smearing_factor(
-                  pos - r, p_mu, m_inv, par, compute_gradient);
-              node.add_particle(part, sf.first * common_weight);
-              if (par.derivatives() == DerivativesMode::CovariantGaussian) {
-                node.add_particle_for_derivatives(part, dens_factor,
-                                                  sf.second * norm_factor_gaus);
-              }
-            });
-      } else if (par.smearing() == SmearingMode::Discrete) {
-        // unweighted contribution to density
-        const double common_weight =
-            dens_factor / (par.ntest() * par.nensembles() * V_cell);
-        lat->iterate_nearest_neighbors(
-            pos, [&](T &node, int iterated_index, int center_index) {
-              node.add_particle(
-                  part, common_weight *
-                            // the contribution to density is weighted depending
-                            // on what node it is added to
-                            (iterated_index == center_index ? big : small));
-            });
-      } else if (par.smearing() == SmearingMode::Triangular) {
-        // unweighted contribution to density
-        const double common_weight = dens_factor * prefactor_triangular;
-        lat->iterate_in_rectangle(
-            pos, triangular_radius, [&](T &node, int ix, int iy, int iz) {
-              // compute the position of the node
-              const ThreeVector cell_center = lat->cell_center(ix, iy, iz);
-              // compute smearing weight
-              const double weight_x =
-                  triangular_radius[0] - std::abs(cell_center[0] - pos[0]);
-              const double weight_y =
-                  triangular_radius[1] - std::abs(cell_center[1] - pos[1]);
-              const double weight_z =
-                  triangular_radius[2] - std::abs(cell_center[2] - pos[2]);
-              // add the contribution to the node
-              node.add_particle(part,
-                                common_weight * weight_x * weight_y * weight_z);
-            });
-      }
-    }  // end of for (const ParticleData &part : particles)
-  }    // end of for (const Particles &particles : ensembles)
+      all_particles.push_back(&part);
+    }
+  }
+  const bool gradients_smeared =
+      compute_gradient && par.smearing() == SmearingMode::CovariantGaussian &&
+      par.derivatives() == DerivativesMode::CovariantGaussian;
+  if (gradients_smeared) {
+    smear_particles_in_parallel<T, T>(*lat, all_particles, dens_type, par,
+                                      compute_gradient);
+  } else {
+    smear_particles_in_parallel<T, typename CompactNode<T>::type>(
+        *lat, all_particles, dens_type, par, compute_gradient);
+  }
 }
 
+/**
+ * Remembers which lattices were updated with which density type at which
+ * time, such that the particles are deposited onto every lattice at most once
+ * per time, even if several potentials or outputs need the lattice.
+ *
+ * The memo has to be cleared whenever the times start again, i.e. at the
+ * beginning of every event. Every lattice is assumed to be updated with the
+ * same choice of gradients each time.
+ */
+class LatticeUpdateMemo {
+ public:
+  /**
+   * Check whether a lattice has to be updated and remember the update.
+   *
+   * \tparam T Type of the values on the lattice
+   * \param[in] lat The lattice, or nullptr
+   * \param[in] update Tells if called for update at printout or at timestep
+   * \param[in] dens_type Density type to be computed on the lattice
+   * \param[in] time Time of the particles in fm
+   * \return False if the lattice does not exist, is not updated at
+   *         \p update, or was already updated with the same density type at
+   *         the same time; true otherwise
+   */
+  template <typename T>
+  bool update_needed(const RectangularLattice<T> *lat,
+                     const LatticeUpdate update, const DensityType dens_type,
+                     const double time) {
+    if (lat == nullptr || lat->when_update() != update) {
+      return false;
+    }
+    const auto key = std::make_pair(dens_type, time);
+    auto it = last_update_.find(lat);
+    if (it != last_update_.end() && it->second == key) {
+      return false;
+    }
+    last_update_[lat] = key;
+    return true;
+  }
+
+  /// Forget all updates
+  void clear() { last_update_.clear(); }
+
+ private:
+  /// Density type and time of the last update of every lattice
+  std::map<const void *, std::pair<DensityType, double>> last_update_;
+};
+
 /**
  * Updates the contents on the lattice of DensityOnLattice type.
  *
+ * The auxiliary lattices are only used for finite difference derivatives and
+ * may be nullptr otherwise.
+ *
  * \param[out] lat The lattice of DensityOnLattice type on which the content
  *             will be updated
  * \param[in] old_jmu Auxiliary lattice, filled with current values at t0,
@@ -654,6 +1004,8 @@ void update_lattice(RectangularLattice<T> *lat, const LatticeUpdate update,
  * \param[in] ensembles The particles vector for each ensemble
  * \param[in] time_step Time step used in the simulation
  * \param[in] compute_gradient Whether to compute the gradients
+ * \throw std::invalid_argument if finite difference derivatives are used
+ *        without the auxiliary lattices
  */
 void update_lattice(
     RectangularLattice<DensityOnLattice> *lat,
@@ -663,6 +1015,30 @@ void update_lattice(
     const LatticeUpdate update, const DensityType dens_type,
     const DensityParameters &par, const std::vector<Particles> &ensembles,
     const double time_step, const bool compute_gradient);
+
+/**
+ * Calculates the Eckart rest frame density at an interaction point.
+ *
+ * The value of the lattice cell that contains the point is taken. Outside
+ * of the lattice, or without a lattice, the density is summed over the
+ * particles of the ensemble in which the interaction took place. If there is
+ * a lattice, that sum is multiplied by the number of ensembles, because the
+ * smearing is normalized to the particles of all ensembles, such that both
+ * give the density averaged over the ensembles. Without a lattice the sum is
+ * returned as it is, as the density of the collision output always was.
+ *
+ * \param[in] r Interaction point [fm]
+ * \param[in] particles Particles of the ensemble of the interaction
+ * \param[in] par Parameters of the smearing
+ * \param[in] dens_type Density type to be computed
+ * \param[in] lat Lattice of the density of all ensembles, or nullptr
+ * \return Eckart rest frame density [fm\f$^{-3}\f$]
+ */
+double density_at_interaction_point(const ThreeVector &r,
+                                    const Particles &particles,
+                                    const DensityParameters &par,
+                                    DensityType dens_type,
+                                    DensityLattice *lat);
 }  // namespace smash
 
 #endif  // SRC_INCLUDE_SMASH_DENSITY_H_
@@ -18,6 +18,7 @@
 #include "actions.h"
 #include "bremsstrahlungaction.h"
 #include "chrono.h"
+#include "coulombsolver.h"
 #include "decayactionsfinder.h"
 #include "decayactionsfinderdilepton.h"
 #include "energymomentumtensor.h"
@@ -26,10 +27,12 @@
 #include "grandcan_thermalizer.h"
 #include "grid.h"
 #include "hypersurfacecrossingaction.h"
+#include "latticewindow.h"
 #include "outputparameters.h"
 #include "pauliblocking.h"
 #include "potential_globals.h"
 #include "potentials.h"
+#include "potentialslattice.h"
 #include "propagation.h"
 #include "quantumnumbers.h"
 #include "scatteractionphoton.h"
@@ -37,7 +40,9 @@
 #include "stringprocess.h"
 #include "thermalizationaction.h"
 // Output
+#include "asyncoutput.h"
 #include "binaryoutput.h"
+#include "columnaroutput.h"
 #ifdef SMASH_USE_HEPMC
 #include "hepmcoutput.h"
 #endif
@@ -46,6 +51,7 @@
 #endif
 #include "icoutput.h"
 #include "oscaroutput.h"
+#include "outputfilter.h"
 #include "thermodynamiclatticeoutput.h"
 #include "thermodynamicoutput.h"
 #ifdef SMASH_USE_ROOT
@@ -290,6 +296,12 @@ class Experiment : public ExperimentBase {
   /// Recompute potentials on lattices if necessary.
   void update_potentials();
 
+  /**
+   * Fit the lattice window to the baryons, moving all lattices used for the
+   * potentials along with it, and update its occupancy bitmap.
+   */
+  void follow_lattice_window();
+
   /**
    * Calculate the minimal size for the grid cells such that the
    * ScatterActionsFinder will find all collisions within the maximal
@@ -402,40 +414,48 @@ class Experiment : public ExperimentBase {
    */
   std::unique_ptr<DensityLattice> jmu_custom_lat_;
 
-  /// Type of density for lattice printout
-  DensityType dens_type_lattice_printout_ = DensityType::None;
-
   /**
-   * Lattices for Skyrme or VDF potentials (evaluated in the local rest frame)
-   * times the baryon flow 4-velocity
+   * Lattice of the density written to the collision output, if none of the
+   * lattices of the potentials provides it.
    */
-  std::unique_ptr<RectangularLattice<FourVector>> UB_lat_ = nullptr;
+  std::unique_ptr<DensityLattice> jmu_interaction_lat_;
 
   /**
-   * Lattices for symmetry potentials (evaluated in the local rest frame) times
-   * the isospin flow 4-velocity
+   * Lattice from which the density at the interaction points is taken, or
+   * nullptr if it is computed from the particles of the ensemble.
    */
-  std::unique_ptr<RectangularLattice<FourVector>> UI3_lat_ = nullptr;
+  DensityLattice *interaction_density_lat_ = nullptr;
 
-  /**
-   * Lattices for the electric and magnetic components of the Skyrme or VDF
-   * force
-   */
-  std::unique_ptr<RectangularLattice<std::pair<ThreeVector, ThreeVector>>>
-      FB_lat_;
-
-  /// Lattices for the electric and magnetic component of the symmetry force
-  std::unique_ptr<RectangularLattice<std::pair<ThreeVector, ThreeVector>>>
-      FI3_lat_;
+  /// Type of density for lattice printout
+  DensityType dens_type_lattice_printout_ = DensityType::None;
 
   /// Lattices for electric and magnetic field in fm^-2
   std::unique_ptr<RectangularLattice<std::pair<ThreeVector, ThreeVector>>>
       EM_lat_;
 
+  /**
+   * Lattice of all potentials and forces, which holds the Skyrme, symmetry
+   * and VDF potentials and forces and a copy of the electric and magnetic
+   * fields, for a single lookup per particle
+   */
+  std::unique_ptr<PotentialsLattice> potentials_lat_;
+
+  /// Fourier transform solver for the electric and magnetic fields
+  std::unique_ptr<CoulombFieldSolver> coulomb_solver_;
+
+  /// Window that the lattices for the potentials follow, if they move
+  std::unique_ptr<LatticeWindow> lattice_window_;
+
+  /// Updates of the density lattices at the current times
+  LatticeUpdateMemo lattice_updates_;
+
   /// Lattices of energy-momentum tensors for printout
   std::unique_ptr<RectangularLattice<EnergyMomentumTensor>> Tmn_;
 
-  /// Auxiliary lattice for values of jmu at a time step t0
+  /**
+   * Auxiliary lattice for values of jmu at a time step t0, only used with
+   * finite difference derivatives like the next two
+   */
   std::unique_ptr<RectangularLattice<FourVector>> old_jmu_auxiliary_;
   /// Auxiliary lattice for values of jmu at a time step t0 + dt
   std::unique_ptr<RectangularLattice<FourVector>> new_jmu_auxiliary_;
@@ -482,10 +502,10 @@ class Experiment : public ExperimentBase {
   std::unique_ptr<GrandCanThermalizer> thermalizer_;
 
   /**
-   * Pointer to the string process class object,
+   * Pointer to the pool of string process objects,
    * which is used to set the random seed for PYTHIA objects in each event.
    */
-  StringProcess *process_string_ptr_;
+  StringProcessPool *process_string_ptr_;
 
   /**
    * Number of events.
@@ -645,9 +665,10 @@ void Experiment<Modus>::create_output(const std::string &format,
   logg[LExperiment].info() << "Adding output " << content << " of format "
                            << format << std::endl;
 
-  if (format == "VTK" && content == "Particles") {
-    outputs_.emplace_back(
-        make_unique<VtkOutput>(output_path, content, out_par));
+  const bool vtk = format == "VTK" || format == "VTK_Binary";
+  if (vtk && content == "Particles") {
+    outputs_.emplace_back(make_unique<VtkOutput>(
+        output_path, content, out_par, format == "VTK_Binary"));
   } else if (format == "Root") {
 #ifdef SMASH_USE_ROOT
     if (content == "Initial_Conditions") {
@@ -673,6 +694,9 @@ void Experiment<Modus>::create_output(const std::string &format,
       outputs_.emplace_back(make_unique<BinaryOutputInitialConditions>(
           output_path, content, out_par));
     }
+  } else if (format == "Columnar" && content == "Particles") {
+    outputs_.emplace_back(
+        make_unique<ColumnarOutput>(output_path, content, out_par));
   } else if (format == "Oscar1999" || format == "Oscar2013") {
     outputs_.emplace_back(
         create_oscar_output(format, content, output_path, out_par));
@@ -691,10 +715,10 @@ void Experiment<Modus>::create_output(const std::string &format,
     outputs_.emplace_back(make_unique<ThermodynamicLatticeOutput>(
         output_path, content, out_par, printout_full_lattice_ascii_td_,
         printout_full_lattice_binary_td_));
-  } else if (content == "Thermodynamics" && format == "VTK") {
+  } else if (content == "Thermodynamics" && vtk) {
     printout_lattice_td_ = true;
-    outputs_.emplace_back(
-        make_unique<VtkOutput>(output_path, content, out_par));
+    outputs_.emplace_back(make_unique<VtkOutput>(
+        output_path, content, out_par, format == "VTK_Binary"));
   } else if (content == "Initial_Conditions" && format == "ASCII") {
     outputs_.emplace_back(
         make_unique<ICOutput>(output_path, "SMASH_IC", out_par));
@@ -716,9 +740,9 @@ void Experiment<Modus>::create_output(const std::string &format,
     logg[LExperiment].error(
         "HepMC output requested, but HepMC support not compiled in");
 #endif
-  } else if (content == "Coulomb" && format == "VTK") {
-    outputs_.emplace_back(
-        make_unique<VtkOutput>(output_path, "Fields", out_par));
+  } else if (content == "Coulomb" && vtk) {
+    outputs_.emplace_back(make_unique<VtkOutput>(
+        output_path, "Fields", out_par, format == "VTK_Binary"));
   } else if (content == "Rivet") {
 #ifdef SMASH_USE_RIVET
     // flag to ensure that the Rivet format has not been already assigned
@@ -991,6 +1015,16 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
   if (photons_switch_ || bremsstrahlung_switch_) {
     n_fractional_photons_ =
         config.take({"Collision_Term", "Photons", "Fractional_Photons"}, 100);
+    /* The tables are created together with the other tabulations, before the
+     * experiment is set up. */
+    const bool tabulated_photon_xs = config.take(
+        {"Collision_Term", "Photons", "Tabulated_Cross_Sections"}, false);
+    if (photons_switch_ && tabulated_photon_xs &&
+        !CrosssectionsPhoton<ComputationMethod::Lookup>::is_tabulated()) {
+      logg[LExperiment].warn(
+          "Photon cross sections were not tabulated, using the analytic "
+          "formulas instead.");
+    }
   }
   if (parameters_.two_to_one) {
     if (parameters_.res_lifetime_factor < 0.) {
@@ -1135,8 +1169,8 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
    * - \b Particles  List of particles at regular time intervals in the
    *                 computational frame or (optionally) only at the event end.
    *   - Available formats: \ref format_oscar_particlelist,
-   *      \ref format_binary_, \ref format_root, \ref format_vtk, \ref
-   * output_hepmc_
+   *      \ref format_binary_, \ref format_columnar_, \ref format_root,
+   *      \ref format_vtk, \ref output_hepmc_
    * - \b Collisions List of interactions: collisions, decays, box wall
    *                 crossings and forced thermalizations. Information about
    *                 incoming, outgoing particles and the interaction itself
@@ -1179,6 +1213,10 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
    *   - Saves coordinates and momenta with the full double precision
    *   - General file structure is similar to \ref oscar_general_
    *   - Detailed description: \subpage format_binary_
+   * - \b "Columnar" - binary output of the particles at event end in columns
+   *   - Has an index of all events, such that single events can be read
+   *     directly
+   *   - Only for "Particles" content, see \subpage format_columnar_
    * - \b "Root" - binary output in the format used by ROOT software
    *     (http://root.cern.ch)
    *   - Even faster to read and write, requires less disk space
@@ -1188,6 +1226,8 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
    *   - This output can be opened by paraview to see the visulalization.
    *   - For "Particles" content \subpage format_vtk
    *   - For "Thermodynamics" content \subpage output_vtk_lattice_
+   * - \b "VTK_Binary" - the same as "VTK", but with the data in binary form
+   *   - Much smaller and faster to write, in particular for large lattices
    * - \b "ASCII" - a human-readable text-format table of values
    *   - Used for "Thermodynamics", "Initial_Conditions" and "HepMC", see
    * \subpage thermodyn_output_user_guide_
@@ -1332,6 +1372,9 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
   logg[LExperiment].debug()
       << "Density type printed to headers: " << dens_type_;
 
+  const bool asynchronous_output =
+      config.take({"Output", "Asynchronous"}, false);
+
   const OutputParameters output_parameters(std::move(output_conf));
 
   std::vector<std::string> output_contents = output_conf.list_upmost_nodes();
@@ -1341,8 +1384,30 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
     if (output_path == "") {
       continue;
     }
+    const OutputFilter *filter = output_parameters.get_filter(content);
     for (const auto &format : formats) {
+      const std::size_t n_outputs = outputs_.size();
       create_output(format, content, output_path, output_parameters);
+      if (filter && filter->selects_particles()) {
+        for (std::size_t i = n_outputs; i < outputs_.size(); i++) {
+          outputs_[i] =
+              make_unique<FilteredOutput>(std::move(outputs_[i]), *filter);
+        }
+      }
+      if (filter && !filter->columns().empty() && format != "Oscar2013") {
+        logg[LExperiment].warn()
+            << "The " << format << " format writes all columns of the "
+            << content << " output.";
+      }
+    }
+  }
+  if (asynchronous_output && !outputs_.empty()) {
+    /* All outputs share one writer, such that they are written in order.
+     * The simulation waits, once this many calls are pending. */
+    constexpr std::size_t queue_capacity = 1024;
+    auto writer = std::make_shared<OutputWriterThread>(queue_capacity);
+    for (auto &output : outputs_) {
+      output = make_unique<AsyncOutput>(std::move(output), writer);
     }
   }
 
@@ -1530,6 +1595,58 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
    * Include potential effects, since mean field potentials change the threshold
    * energies of the actions.
    *
+   * \key Threads (int, optional, default = 1): \n
+   * Number of threads used to deposit the particles onto the density lattices,
+   * to compute the finite difference gradients and to compute the forces of
+   * the potentials on the particles. For the deposition every thread smears
+   * its share of the particles onto a private copy of the lattice, and the
+   * copies are summed up afterwards. The densities are reproducible for a
+   * fixed number of threads, but differ from those of another number of
+   * threads in the order of the floating-point additions.
+   *
+   * \key Trilinear_Interpolation (bool, optional, default = false): \n
+   * Interpolate the potentials and forces trilinearly between the cell
+   * centers, instead of taking the values of the cell that contains the
+   * particle. The forces then change continuously with the position, which
+   * allows for larger time steps.
+   *
+   * \key Interaction_Density (bool, optional, default = false): \n
+   * Take the density at the interaction points, which is written to the
+   * collision output if \key Density_Type is given in the \key Output
+   * section, from the lattice instead of summing over all particles of the
+   * ensemble for every interaction. The value of the cell containing the
+   * interaction point at the beginning of the time step is used, which is
+   * averaged over all ensembles. The lattices of the potentials are reused,
+   * if they hold the requested density type; otherwise an additional lattice
+   * is updated every time step. Interactions outside of the lattice still
+   * use the sum over the particles of their ensemble, multiplied by the
+   * number of ensembles to match the normalization of the lattice.
+   *
+   * \key Moving_Window (section, optional): \n
+   * If this section is given, the lattices for the potentials follow the
+   * baryons instead of covering the fixed box given by \key Origin and
+   * \key Sizes. Every few time steps they are moved and resized to the
+   * bounding box of all baryons and nuclei, enlarged by a margin. The window
+   * moves on the grid of the configured lattice, so the cell sizes do not
+   * change. The potentials are not evaluated in blocks of
+   * \f$ 4 \times 4 \times 4 \f$ cells that are out of the smearing range of
+   * all baryons, now and at the previous time step. The window requires a
+   * non-periodic lattice and cannot be combined with the thermodynamic
+   * lattice output of the baryon or baryonic isospin density, which needs a
+   * fixed lattice.
+   * - \key Update_Interval (int, optional, default = 5): \n
+   *   Number of time steps between two fits of the window.
+   * - \key Margin (double, optional, default = smearing cutoff plus the
+   *   distance light travels within \key Update_Interval time steps): \n
+   *   Distance between the outermost baryons and the edges of the window in
+   *   fm.
+   * - \key Max_Cell_Number (list of 3 ints, optional, default =
+   *   \key Cell_Number): \n
+   *   Maximal number of cells of the window in x, y and z directions. If the
+   *   baryons spread further, the window is centered on their mean position
+   *   and the outermost baryons are left out, such that the memory and time
+   *   spent on the lattices stay bounded.
+   *
    * For information on the format of the lattice output see
    * \ref output_vtk_lattice_ or \ref thermodyn_lattice_output_. To configure
    * the thermodynamic output, see \ref input_output_options_.
@@ -1552,6 +1669,19 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
        Potentials_Affect_Thresholds: True
    \endverbatim
    *\n
+   * A lattice for the potentials of a collision that follows the baryons,
+   * with cells of 1 fm size, is configured by
+   *
+   *\verbatim
+   Lattice:
+       Origin:    [-10.0, -10.0, -10.0]
+       Sizes:    [20.0, 20.0, 20.0]
+       Cell_Number:    [20, 20, 20]
+       Moving_Window:
+           Update_Interval: 5
+           Margin: 4.0
+   \endverbatim
+   *\n
    * In case of Collider, Box, and Sphere modus
    * (see input_general_ for choosing modus)
    * there is also an option to set up lattice automatically.
@@ -1625,6 +1755,10 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
         config.take({"Lattice", "Origin"}, origin_default);
     const bool periodic =
         config.take({"Lattice", "Periodic"}, periodic_default);
+    const bool trilinear =
+        config.take({"Lattice", "Trilinear_Interpolation"}, false);
+    const bool interaction_density =
+        config.take({"Lattice", "Interaction_Density"}, false);
 
     logg[LExperiment].info()
         << "Lattice is ON. Origin = (" << origin[0] << "," << origin[1] << ","
@@ -1651,32 +1785,28 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
        if potentials are on. This is because they allow to compute
        potentials faster */
     if (potentials_) {
-      // Create auxiliary lattices for baryon four-current calculation
-      old_jmu_auxiliary_ = make_unique<RectangularLattice<FourVector>>(
-          l, n, origin, periodic, LatticeUpdate::EveryTimestep);
-      new_jmu_auxiliary_ = make_unique<RectangularLattice<FourVector>>(
-          l, n, origin, periodic, LatticeUpdate::EveryTimestep);
-      four_gradient_auxiliary_ =
-          make_unique<RectangularLattice<std::array<FourVector, 4>>>(
-              l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+      potentials_lat_ =
+          make_unique<PotentialsLattice>(l, n, origin, periodic, trilinear);
+      /* Create auxiliary lattices for baryon four-current calculation. Only
+       * finite difference derivatives need them, which saves almost as much
+       * memory per node as the density lattice itself takes otherwise. */
+      if (density_param_.derivatives() == DerivativesMode::FiniteDifference) {
+        old_jmu_auxiliary_ = make_unique<RectangularLattice<FourVector>>(
+            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+        new_jmu_auxiliary_ = make_unique<RectangularLattice<FourVector>>(
+            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+        four_gradient_auxiliary_ =
+            make_unique<RectangularLattice<std::array<FourVector, 4>>>(
+                l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+      }
 
       if (potentials_->use_skyrme()) {
         jmu_B_lat_ = make_unique<DensityLattice>(l, n, origin, periodic,
                                                  LatticeUpdate::EveryTimestep);
-        UB_lat_ = make_unique<RectangularLattice<FourVector>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
-        FB_lat_ = make_unique<
-            RectangularLattice<std::pair<ThreeVector, ThreeVector>>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
       }
       if (potentials_->use_symmetry()) {
         jmu_I3_lat_ = make_unique<DensityLattice>(l, n, origin, periodic,
                                                   LatticeUpdate::EveryTimestep);
-        UI3_lat_ = make_unique<RectangularLattice<FourVector>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
-        FI3_lat_ = make_unique<
-            RectangularLattice<std::pair<ThreeVector, ThreeVector>>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
       }
       if (potentials_->use_coulomb()) {
         jmu_el_lat_ = make_unique<DensityLattice>(l, n, origin, periodic,
@@ -1684,15 +1814,15 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
         EM_lat_ = make_unique<
             RectangularLattice<std::pair<ThreeVector, ThreeVector>>>(
             l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+        if (potentials_->use_coulomb_fft()) {
+          coulomb_solver_ = make_unique<CoulombFieldSolver>(
+              n, EM_lat_->cell_sizes(), periodic,
+              potentials_->coulomb_r_cut());
+        }
       }
       if (potentials_->use_vdf()) {
         jmu_B_lat_ = make_unique<DensityLattice>(l, n, origin, periodic,
                                                  LatticeUpdate::EveryTimestep);
-        UB_lat_ = make_unique<RectangularLattice<FourVector>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
-        FB_lat_ = make_unique<
-            RectangularLattice<std::pair<ThreeVector, ThreeVector>>>(
-            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
       }
       if (parameters_.field_derivatives_mode == FieldDerivativesMode::Direct) {
         // Create auxiliary lattices for field calculation
@@ -1724,6 +1854,54 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
       jmu_custom_lat_ = make_unique<DensityLattice>(l, n, origin, periodic,
                                                     LatticeUpdate::AtOutput);
     }
+    if (interaction_density && dens_type_ != DensityType::None) {
+      // Lattices of the potentials are updated at every time step anyway.
+      if (potentials_ && dens_type_ == DensityType::Baryon && jmu_B_lat_) {
+        interaction_density_lat_ = jmu_B_lat_.get();
+      } else if (potentials_ && dens_type_ == DensityType::BaryonicIsospin &&
+                 jmu_I3_lat_) {
+        interaction_density_lat_ = jmu_I3_lat_.get();
+      } else {
+        jmu_interaction_lat_ = make_unique<DensityLattice>(
+            l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+        interaction_density_lat_ = jmu_interaction_lat_.get();
+      }
+    }
+    if (config.has_value({"Lattice", "Moving_Window"})) {
+      const int update_interval =
+          config.take({"Lattice", "Moving_Window", "Update_Interval"}, 5);
+      const double margin = config.take(
+          {"Lattice", "Moving_Window", "Margin"},
+          density_param_.r_cut() +
+              update_interval * parameters_.labclock->timestep_duration());
+      const std::array<int, 3> max_n = config.take(
+          {"Lattice", "Moving_Window", "Max_Cell_Number"}, n);
+      if (periodic) {
+        throw std::invalid_argument(
+            "The lattice window cannot move on a periodic lattice.");
+      }
+      if (dens_type_lattice_printout_ == DensityType::Baryon ||
+          dens_type_lattice_printout_ == DensityType::BaryonicIsospin) {
+        throw std::invalid_argument(
+            "The lattice window cannot move with the thermodynamic lattice "
+            "output of the baryon or baryonic isospin density.");
+      }
+      if (potentials_) {
+        const std::array<double, 3> cell_sizes = {l[0] / n[0], l[1] / n[1],
+                                                  l[2] / n[2]};
+        const double max_cell_size =
+            *std::max_element(cell_sizes.begin(), cell_sizes.end());
+        /* Densities reach up to the smearing range from a baryon, and
+         * gradients and interpolation one or two cells further. */
+        const double occupancy_range =
+            std::max(std::max(density_param_.r_cut(), max_cell_size),
+                     parameters_.triangular_range * max_cell_size) +
+            2 * max_cell_size;
+        lattice_window_ =
+            make_unique<LatticeWindow>(origin, cell_sizes, n, max_n, margin,
+                                       update_interval, occupancy_range);
+      }
+    }
   } else if (printout_lattice_td_ || printout_full_lattice_any_td_) {
     logg[LExperiment].error(
         "If you want Therm. VTK or Lattice output, configure a lattice for "
@@ -1742,8 +1920,7 @@ Experiment<Modus>::Experiment(Configuration config, const bf::path &output_path)
 
   // Store pointers to potential and lattice accessible for Action
   if (parameters_.potential_affect_threshold) {
-    UB_lat_pointer = UB_lat_.get();
-    UI3_lat_pointer = UI3_lat_.get();
+    potentials_lat_pointer = potentials_lat_.get();
     pot_pointer = potentials_.get();
   }
 
@@ -1861,6 +2038,7 @@ void Experiment<Modus>::initialize_new_event() {
   for (Particles &particles : ensembles_) {
     particles.reset();
   }
+  lattice_updates_.clear();
 
   // Sample particles according to the initial conditions
   double start_time = -1.0;
@@ -2068,6 +2246,9 @@ bool Experiment<Modus>::perform_action(Action &action, int i_ensemble) {
    * interaction yet". */
   const auto id_process = static_cast<uint32_t>(interactions_total_ + 1);
   action.perform(&particles, id_process);
+  if (pauli_blocker_) {
+    pauli_blocker_->add_to_index(i_ensemble, action.outgoing_particles());
+  }
   interactions_total_++;
   if (action.get_type() == ProcessType::Wall) {
     wall_actions_total_++;
@@ -2079,14 +2260,11 @@ bool Experiment<Modus>::perform_action(Action &action, int i_ensemble) {
   // Calculate Eckart rest frame density at the interaction point
   double rho = 0.0;
   if (dens_type_ != DensityType::None) {
-    const FourVector r_interaction = action.get_interaction_point();
-    constexpr bool compute_grad = false;
-    const bool smearing = true;
-    // todo(oliiny): it's a rough density estimate from a single ensemble.
-    // It might actually be appropriate for output. Discuss.
-    rho = std::get<0>(current_eckart(r_interaction.threevec(), particles,
-                                     density_param_, dens_type_, compute_grad,
-                                     smearing));
+    // todo(oliiny): without the lattice, it's a rough density estimate from
+    // a single ensemble. It might actually be appropriate for output. Discuss.
+    rho = density_at_interaction_point(
+        action.get_interaction_point().threevec(), particles, density_param_,
+        dens_type_, interaction_density_lat_);
   }
   /*!\Userguide
    * \page collisions_output_in_box_modus_ Collision Output in Box Modus
@@ -2209,6 +2387,22 @@ void Experiment<Modus>::run_time_evolution() {
       }
     }
 
+    /* Update the lattice of the density at the interaction points, unless it
+     * is one of the lattices of the potentials, which were updated at the
+     * end of the last time step. */
+    if (lattice_updates_.update_needed(jmu_interaction_lat_.get(),
+                                       LatticeUpdate::EveryTimestep,
+                                       dens_type_, t)) {
+      update_lattice(jmu_interaction_lat_.get(), LatticeUpdate::EveryTimestep,
+                     dens_type_, density_param_, ensembles_, false);
+    }
+
+    /* Index the baryons for Pauli blocking. They move by at most the
+     * duration of the time step until the index is cleared below. */
+    if (pauli_blocker_) {
+      pauli_blocker_->index_particles(ensembles_, dt);
+    }
+
     std::vector<Actions> actions(parameters_.n_ensembles);
     for (int i_ens = 0; i_ens < parameters_.n_ensembles; i_ens++) {
       actions[i_ens].clear();
@@ -2263,14 +2457,17 @@ void Experiment<Modus>::run_time_evolution() {
     for (int i_ens = 0; i_ens < parameters_.n_ensembles; i_ens++) {
       run_time_evolution_timestepless(actions[i_ens], i_ens, end_timestep_time);
     }
+    if (pauli_blocker_) {
+      pauli_blocker_->clear_index();
+    }
 
     /* (3) Update potentials (if computed on the lattice) and
      *     compute new momenta according to equations of motion */
     if (potentials_) {
       update_potentials();
       update_momenta(ensembles_, parameters_.labclock->timestep_duration(),
-                     *potentials_, FB_lat_.get(), FI3_lat_.get(),
-                     EM_lat_.get());
+                     *potentials_, potentials_lat_.get(),
+                     parameters_.lattice_threads);
     }
 
     /* (4) Expand universe if non-minkowskian metric; updates
@@ -2451,6 +2648,7 @@ void Experiment<Modus>::intermediate_output() {
       parameters_.outputclock->current_time(), E_mean_field,
       initial_mean_field_energy_);
   const LatticeUpdate lat_upd = LatticeUpdate::AtOutput;
+  const double output_time = parameters_.outputclock->current_time();
 
   // save evolution data
   if (!(modus_.is_box() && parameters_.outputclock->current_time() <
@@ -2476,17 +2674,25 @@ void Experiment<Modus>::intermediate_output() {
       // Thermodynamic output on the lattice versus time
       switch (dens_type_lattice_printout_) {
         case DensityType::Baryon:
-          update_lattice(jmu_B_lat_.get(), lat_upd, DensityType::Baryon,
-                         density_param_, ensembles_, false);
+          if (lattice_updates_.update_needed(jmu_B_lat_.get(), lat_upd,
+                                             DensityType::Baryon,
+                                             output_time)) {
+            update_lattice(jmu_B_lat_.get(), lat_upd, DensityType::Baryon,
+                           density_param_, ensembles_, false);
+          }
           output->thermodynamics_output(ThermodynamicQuantity::EckartDensity,
                                         DensityType::Baryon, *jmu_B_lat_);
           output->thermodynamics_lattice_output(*jmu_B_lat_,
                                                 computational_frame_time);
           break;
         case DensityType::BaryonicIsospin:
-          update_lattice(jmu_I3_lat_.get(), lat_upd,
-                         DensityType::BaryonicIsospin, density_param_,
-                         ensembles_, false);
+          if (lattice_updates_.update_needed(jmu_I3_lat_.get(), lat_upd,
+                                             DensityType::BaryonicIsospin,
+                                             output_time)) {
+            update_lattice(jmu_I3_lat_.get(), lat_upd,
+                           DensityType::BaryonicIsospin, density_param_,
+                           ensembles_, false);
+          }
           output->thermodynamics_output(ThermodynamicQuantity::EckartDensity,
                                         DensityType::BaryonicIsospin,
                                         *jmu_I3_lat_);
@@ -2496,9 +2702,13 @@ void Experiment<Modus>::intermediate_output() {
         case DensityType::None:
           break;
         default:
-          update_lattice(jmu_custom_lat_.get(), lat_upd,
-                         dens_type_lattice_printout_, density_param_,
-                         ensembles_, false);
+          if (lattice_updates_.update_needed(jmu_custom_lat_.get(), lat_upd,
+                                             dens_type_lattice_printout_,
+                                             output_time)) {
+            update_lattice(jmu_custom_lat_.get(), lat_upd,
+                           dens_type_lattice_printout_, density_param_,
+                           ensembles_, false);
+          }
           output->thermodynamics_output(ThermodynamicQuantity::EckartDensity,
                                         dens_type_lattice_printout_,
                                         *jmu_custom_lat_);
@@ -2506,8 +2716,12 @@ void Experiment<Modus>::intermediate_output() {
                                                 computational_frame_time);
       }
       if (printout_tmn_ || printout_tmn_landau_ || printout_v_landau_) {
-        update_lattice(Tmn_.get(), lat_upd, dens_type_lattice_printout_,
-                       density_param_, ensembles_, false);
+        if (lattice_updates_.update_needed(Tmn_.get(), lat_upd,
+                                           dens_type_lattice_printout_,
+                                           output_time)) {
+          update_lattice(Tmn_.get(), lat_upd, dens_type_lattice_printout_,
+                         density_param_, ensembles_, false);
+        }
         if (printout_tmn_) {
           output->thermodynamics_output(ThermodynamicQuantity::Tmn,
                                         dens_type_lattice_printout_, *Tmn_);
@@ -2544,25 +2758,82 @@ void Experiment<Modus>::intermediate_output() {
   }
 }
 
+template <typename Modus>
+void Experiment<Modus>::follow_lattice_window() {
+  if (lattice_window_->follow(ensembles_)) {
+    const LatticeWindow &window = *lattice_window_;
+    window.move(jmu_B_lat_.get());
+    window.move(jmu_I3_lat_.get());
+    window.move(jmu_el_lat_.get());
+    window.move(jmu_interaction_lat_.get());
+    window.move(fields_lat_.get());
+    window.move(EM_lat_.get());
+    window.move(potentials_lat_.get());
+    window.move(old_jmu_auxiliary_.get());
+    window.move(new_jmu_auxiliary_.get());
+    window.move(four_gradient_auxiliary_.get());
+    window.move(old_fields_auxiliary_.get());
+    window.move(new_fields_auxiliary_.get());
+    window.move(fields_four_gradient_auxiliary_.get());
+    if (coulomb_solver_) {
+      coulomb_solver_ = make_unique<CoulombFieldSolver>(
+          window.n_cells(), EM_lat_->cell_sizes(), false,
+          potentials_->coulomb_r_cut());
+    }
+  }
+  lattice_window_->update_occupancy(ensembles_);
+}
+
 template <typename Modus>
 void Experiment<Modus>::update_potentials() {
   if (potentials_) {
-    if (potentials_->use_symmetry() && jmu_I3_lat_ != nullptr) {
+    if (lattice_window_) {
+      follow_lattice_window();
+    }
+    const LatticeUpdate lat_upd = LatticeUpdate::EveryTimestep;
+    // The particles have been propagated to the end of the time step.
+    const double time = std::min(parameters_.labclock->next_time(), end_time_);
+    /* Deposit the baryon density at most once, also if both the symmetry
+     * and the VDF potentials need it. Otherwise the second update would
+     * see no change in time. */
+    auto update_baryon_lattice = [&]() {
+      if (lattice_updates_.update_needed(jmu_B_lat_.get(), lat_upd,
+                                         DensityType::Baryon, time)) {
+        update_lattice(jmu_B_lat_.get(), old_jmu_auxiliary_.get(),
+                       new_jmu_auxiliary_.get(),
+                       four_gradient_auxiliary_.get(), lat_upd,
+                       DensityType::Baryon, density_param_, ensembles_,
+                       parameters_.labclock->timestep_duration(), true);
+      }
+    };
+    if (potentials_->use_symmetry() &&
+        lattice_updates_.update_needed(jmu_I3_lat_.get(), lat_upd,
+                                       DensityType::BaryonicIsospin, time)) {
       update_lattice(jmu_I3_lat_.get(), old_jmu_auxiliary_.get(),
                      new_jmu_auxiliary_.get(), four_gradient_auxiliary_.get(),
-                     LatticeUpdate::EveryTimestep, DensityType::BaryonicIsospin,
-                     density_param_, ensembles_,
-                     parameters_.labclock->timestep_duration(), true);
+                     lat_upd, DensityType::BaryonicIsospin, density_param_,
+                     ensembles_, parameters_.labclock->timestep_duration(),
+                     true);
     }
     if ((potentials_->use_skyrme() || potentials_->use_symmetry()) &&
         jmu_B_lat_ != nullptr) {
-      update_lattice(jmu_B_lat_.get(), old_jmu_auxiliary_.get(),
-                     new_jmu_auxiliary_.get(), four_gradient_auxiliary_.get(),
-                     LatticeUpdate::EveryTimestep, DensityType::Baryon,
-                     density_param_, ensembles_,
-                     parameters_.labclock->timestep_duration(), true);
-      const size_t UBlattice_size = UB_lat_->size();
-      for (size_t i = 0; i < UBlattice_size; i++) {
+      update_baryon_lattice();
+      const size_t lattice_size = potentials_lat_->size();
+      for (size_t i = 0; i < lattice_size; i++) {
+        PotentialsOnLattice &node = (*potentials_lat_)[i];
+        if (lattice_window_ && !lattice_window_->occupied(i)) {
+          // No baryon is close enough to create a potential at this node.
+          const auto no_force = std::make_pair(ThreeVector(), ThreeVector());
+          if (potentials_->use_skyrme()) {
+            node.UB = FourVector();
+            node.FB = no_force;
+          }
+          if (potentials_->use_symmetry() && jmu_I3_lat_ != nullptr) {
+            node.UI3 = FourVector();
+            node.FI3 = no_force;
+          }
+          continue;
+        }
         auto jB = (*jmu_B_lat_)[i];
         const FourVector flow_four_velocity_B =
             std::abs(jB.rho()) > very_small_double ? jB.jmu_net() / jB.rho()
@@ -2572,9 +2843,9 @@ void Experiment<Modus>::update_potentials() {
         ThreeVector baryon_dvecj_dt = jB.dvecj_dt();
         ThreeVector baryon_curl_vecj = jB.curl_vecj();
         if (potentials_->use_skyrme()) {
-          (*UB_lat_)[i] =
+          node.UB =
               flow_four_velocity_B * potentials_->skyrme_pot(baryon_density);
-          (*FB_lat_)[i] =
+          node.FB =
               potentials_->skyrme_force(baryon_density, baryon_grad_j0,
                                         baryon_dvecj_dt, baryon_curl_vecj);
         }
@@ -2584,37 +2855,41 @@ void Experiment<Modus>::update_potentials() {
               std::abs(jI3.rho()) > very_small_double
                   ? jI3.jmu_net() / jI3.rho()
                   : FourVector();
-          (*UI3_lat_)[i] = flow_four_velocity_I3 *
-                           potentials_->symmetry_pot(jI3.rho(), baryon_density);
-          (*FI3_lat_)[i] = potentials_->symmetry_force(
+          node.UI3 = flow_four_velocity_I3 *
+                     potentials_->symmetry_pot(jI3.rho(), baryon_density);
+          node.FI3 = potentials_->symmetry_force(
               jI3.rho(), jI3.grad_j0(), jI3.dvecj_dt(), jI3.curl_vecj(),
               baryon_density, baryon_grad_j0, baryon_dvecj_dt,
               baryon_curl_vecj);
         }
       }
     }
-    if (potentials_->use_coulomb()) {
-      update_lattice(jmu_el_lat_.get(), LatticeUpdate::EveryTimestep,
-                     DensityType::Charge, density_param_, ensembles_, true);
-      for (size_t i = 0; i < EM_lat_->size(); i++) {
-        ThreeVector electric_field = {0., 0., 0.};
-        ThreeVector position = jmu_el_lat_->cell_center(i);
-        jmu_el_lat_->integrate_volume(electric_field,
-                                      Potentials::E_field_integrand,
-                                      potentials_->coulomb_r_cut(), position);
-        ThreeVector magnetic_field = {0., 0., 0.};
-        jmu_el_lat_->integrate_volume(magnetic_field,
-                                      Potentials::B_field_integrand,
-                                      potentials_->coulomb_r_cut(), position);
-        (*EM_lat_)[i] = std::make_pair(electric_field, magnetic_field);
+    if (potentials_->use_coulomb() &&
+        lattice_updates_.update_needed(jmu_el_lat_.get(), lat_upd,
+                                       DensityType::Charge, time)) {
+      update_lattice(jmu_el_lat_.get(), lat_upd, DensityType::Charge,
+                     density_param_, ensembles_, true);
+      if (coulomb_solver_) {
+        coulomb_solver_->compute_fields(*jmu_el_lat_, *EM_lat_,
+                                        density_param_.n_threads());
+      } else {
+        for (size_t i = 0; i < EM_lat_->size(); i++) {
+          ThreeVector electric_field = {0., 0., 0.};
+          ThreeVector position = jmu_el_lat_->cell_center(i);
+          jmu_el_lat_->integrate_volume(electric_field,
+                                        Potentials::E_field_integrand,
+                                        potentials_->coulomb_r_cut(), position);
+          ThreeVector magnetic_field = {0., 0., 0.};
+          jmu_el_lat_->integrate_volume(magnetic_field,
+                                        Potentials::B_field_integrand,
+                                        potentials_->coulomb_r_cut(), position);
+          (*EM_lat_)[i] = std::make_pair(electric_field, magnetic_field);
+        }
       }
+      potentials_lat_->set_fields(*EM_lat_);
     }  // if ((potentials_->use_skyrme() || ...
     if (potentials_->use_vdf() && jmu_B_lat_ != nullptr) {
-      update_lattice(jmu_B_lat_.get(), old_jmu_auxiliary_.get(),
-                     new_jmu_auxiliary_.get(), four_gradient_auxiliary_.get(),
-                     LatticeUpdate::EveryTimestep, DensityType::Baryon,
-                     density_param_, ensembles_,
-                     parameters_.labclock->timestep_duration(), true);
+      update_baryon_lattice();
       if (parameters_.field_derivatives_mode == FieldDerivativesMode::Direct) {
         update_fields_lattice(
             fields_lat_.get(), old_fields_auxiliary_.get(),
@@ -2622,24 +2897,30 @@ void Experiment<Modus>::update_potentials() {
             jmu_B_lat_.get(), LatticeUpdate::EveryTimestep, *potentials_,
             parameters_.labclock->timestep_duration());
       }
-      const size_t UBlattice_size = UB_lat_->size();
-      for (size_t i = 0; i < UBlattice_size; i++) {
+      const size_t lattice_size = potentials_lat_->size();
+      for (size_t i = 0; i < lattice_size; i++) {
+        PotentialsOnLattice &node = (*potentials_lat_)[i];
+        if (lattice_window_ && !lattice_window_->occupied(i)) {
+          node.UB = FourVector();
+          node.FB = std::make_pair(ThreeVector(), ThreeVector());
+          continue;
+        }
         auto jB = (*jmu_B_lat_)[i];
-        (*UB_lat_)[i] = potentials_->vdf_pot(jB.rho(), jB.jmu_net());
+        node.UB = potentials_->vdf_pot(jB.rho(), jB.jmu_net());
         switch (parameters_.field_derivatives_mode) {
           case FieldDerivativesMode::ChainRule:
-            (*FB_lat_)[i] = potentials_->vdf_force(
+            node.FB = potentials_->vdf_force(
                 jB.rho(), jB.drho_dxnu().x0(), jB.drho_dxnu().threevec(),
                 jB.grad_rho_cross_vecj(), jB.jmu_net().x0(), jB.grad_j0(),
                 jB.jmu_net().threevec(), jB.dvecj_dt(), jB.curl_vecj());
             break;
           case FieldDerivativesMode::Direct:
             auto Amu = (*fields_lat_)[i];
-            (*FB_lat_)[i] = potentials_->vdf_force(
+            node.FB = potentials_->vdf_force(
                 Amu.grad_A0(), Amu.dvecA_dt(), Amu.curl_vecA());
             break;
         }
-      }  // for (size_t i = 0; i < UBlattice_size; i++)
+      }  // for (size_t i = 0; i < lattice_size; i++)
     }    // if potentials_->use_vdf()
   }
 }
@@ -2724,6 +3005,10 @@ void Experiment<Modus>::final_output() {
         logg[LExperiment].info() << hline;
         logg[LExperiment].info()
             << "Time real: " << SystemClock::now() - time_start_;
+        if (process_string_ptr_ != NULL) {
+          logg[LExperiment].info() << "Time in PYTHIA initialization: "
+                                   << process_string_ptr_->pythia_init_time();
+        }
         logg[LExperiment].info()
             << "Interactions before reaching hypersurface: "
             << interactions_total_ - wall_actions_total_ -
@@ -2747,6 +3032,10 @@ void Experiment<Modus>::final_output() {
       logg[LExperiment].info() << hline;
       logg[LExperiment].info()
           << "Time real: " << SystemClock::now() - time_start_;
+      if (process_string_ptr_ != NULL) {
+        logg[LExperiment].info() << "Time in PYTHIA initialization: "
+                                 << process_string_ptr_->pythia_init_time();
+      }
       logg[LExperiment].debug() << msg_discarded.str();
 
       if (parameters_.coll_crit == CollisionCriterion::Stochastic &&
@@ -57,6 +57,9 @@ struct ExperimentParameters {
   /// triangular smearing uses
   double triangular_range;
 
+  /// Number of threads depositing particles onto the density lattices
+  int lattice_threads;
+
   /// Employed collision criterion
   const CollisionCriterion coll_crit;
 
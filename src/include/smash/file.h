@@ -81,14 +81,34 @@ class RenamingFilePtr {
    * \return The constructed object.
    */
   RenamingFilePtr(const bf::path& filename, const std::string& mode);
-  /// Get the underlying `FILE*` pointer.
+  /**
+   * Construct a `RenamingFilePtr` that compresses everything written to it.
+   *
+   * \param[in] filename Path to the file, to which the extension of the codec
+   *                     is appended.
+   * \param[in] mode The mode in which the file should be opened (see
+   *                 `std::fopen`).
+   * \param[in] codec Codec for the compression or nullptr for an
+   *                  uncompressed file.
+   * \return The constructed object.
+   */
+  RenamingFilePtr(const bf::path& filename, const std::string& mode,
+                  std::unique_ptr<CompressionCodec> codec);
+  /// Get the `FILE*` pointer to write to.
   FILE* get();
+  /**
+   * Flush the file. If it is compressed, everything written so far becomes a
+   * frame that can be decompressed independently of the following ones.
+   */
+  void flush();
   /// Close the file and rename it.
   ~RenamingFilePtr();
 
  private:
   /// Internal file pointer.
   FILE* file_;
+  /// Compressor in front of the file, if it is compressed.
+  std::unique_ptr<FrameCompressor> compressor_;
   /// Path of the finished file.
   bf::path filename_;
   /// Path of the unfinished file.
@@ -68,6 +68,8 @@ class FourVector;
 class ThreeVector;
 class ModusDefault;
 class OutputInterface;
+class CompressionCodec;
+class FrameCompressor;
 class ParticleData;
 class Particles;
 class ParticleType;
@@ -0,0 +1,233 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_FORWARDINGOUTPUT_H_
+#define SRC_INCLUDE_SMASH_FORWARDINGOUTPUT_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "outputinterface.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Base of the outputs that wrap another output and pass the calls on to it.
+ *
+ * Every call is passed on unchanged, after before_forwarding() was called.
+ * Derived classes override the calls that they treat differently.
+ */
+class ForwardingOutput : public OutputInterface {
+ public:
+  /**
+   * Wrap an output.
+   *
+   * \param[in] output Output to which the calls are passed on. The wrapper
+   *            is of the same kind, e.g. a dilepton output, as this output.
+   */
+  explicit ForwardingOutput(std::unique_ptr<OutputInterface> output);
+
+  /**
+   * Pass on the particles at event start.
+   * \param[in] particles List of particles
+   * \param[in] event_number Number of the current event
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventstart(const Particles &particles, const int event_number,
+                     const EventInfo &info) override;
+
+  /**
+   * Pass on the ensembles at event start.
+   * \param[in] ensembles List of particles
+   * \param[in] event_number Number of the current event
+   */
+  void at_eventstart(const std::vector<Particles> &ensembles,
+                     int event_number) override;
+
+  /**
+   * Pass on the lattice at event start.
+   * \param[in] event_number Number of the current event
+   * \param[in] tq Thermodynamic quantity to deal with
+   * \param[in] dens_type Density type for the reference frame
+   * \param[in] lattice Lattice of tabulated values
+   */
+  void at_eventstart(const int event_number, const ThermodynamicQuantity tq,
+                     const DensityType dens_type,
+                     RectangularLattice<DensityOnLattice> lattice) override;
+
+  /**
+   * Pass on the lattice at event start.
+   * \param[in] event_number Number of the current event
+   * \param[in] tq Thermodynamic quantity to deal with
+   * \param[in] dens_type Density type for the reference frame
+   * \param[in] lattice Lattice of tabulated values
+   */
+  void at_eventstart(const int event_number, const ThermodynamicQuantity tq,
+                     const DensityType dens_type,
+                     RectangularLattice<EnergyMomentumTensor> lattice) override;
+
+  /**
+   * Pass on the end of an event.
+   * \param[in] event_number Number of the current event
+   * \param[in] tq Thermodynamic quantity to deal with
+   * \param[in] dens_type Density type for the evaluation of thermodynamic
+   *            quantities
+   */
+  void at_eventend(const int event_number, const ThermodynamicQuantity tq,
+                   const DensityType dens_type) override;
+
+  /**
+   * Pass on the end of an event.
+   * \param[in] tq Thermodynamic quantity to deal with
+   */
+  void at_eventend(const ThermodynamicQuantity tq) override;
+
+  /**
+   * Pass on the particles at the end of an event.
+   * \param[in] particles List of particles
+   * \param[in] event_number Number of the current event
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventend(const Particles &particles, const int event_number,
+                   const EventInfo &info) override;
+
+  /**
+   * Pass on the ensembles at the end of an event.
+   * \param[in] ensembles List of particles
+   * \param[in] event_number Number of the current event
+   */
+  void at_eventend(const std::vector<Particles> &ensembles,
+                   const int event_number) override;
+
+  /**
+   * Pass on an action.
+   * \param[in] action The action object, containing the initial and final
+   *            state etc.
+   * \param[in] density The density at the interaction point
+   */
+  void at_interaction(const Action &action, const double density) override;
+
+  /**
+   * Pass on dilepton decays.
+   * \param[in] decays Dilepton decays found by the shining method
+   */
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override;
+
+  /**
+   * Pass on the particles at an intermediate time.
+   * \param[in] particles List of particles
+   * \param[in] clock System clock
+   * \param[in] dens_param Parameters for density calculation
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_intermediate_time(const Particles &particles,
+                            const std::unique_ptr<Clock> &clock,
+                            const DensityParameters &dens_param,
+                            const EventInfo &info) override;
+
+  /**
+   * Pass on the ensembles at an intermediate time.
+   * \param[in] ensembles List of particles
+   * \param[in] clock System clock
+   * \param[in] dens_param Parameters for density calculation
+   */
+  void at_intermediate_time(const std::vector<Particles> &ensembles,
+                            const std::unique_ptr<Clock> &clock,
+                            const DensityParameters &dens_param) override;
+
+  /**
+   * Pass on thermodynamics from the lattice.
+   * \param[in] tq Thermodynamic quantity to be written
+   * \param[in] dt Type of density
+   * \param[in] lattice Lattice of tabulated values
+   */
+  void thermodynamics_output(
+      const ThermodynamicQuantity tq, const DensityType dt,
+      RectangularLattice<DensityOnLattice> &lattice) override;
+
+  /**
+   * Pass on the energy-momentum tensor from the lattice.
+   * \param[in] tq Thermodynamic quantity to be written
+   * \param[in] dt Type of density
+   * \param[in] lattice Lattice of tabulated values
+   */
+  void thermodynamics_output(
+      const ThermodynamicQuantity tq, const DensityType dt,
+      RectangularLattice<EnergyMomentumTensor> &lattice) override;
+
+  /**
+   * Pass on thermodynamics from the lattice.
+   * \param[in] lattice Lattice of tabulated values
+   * \param[in] current_time Time of the simulation in the computational frame
+   */
+  void thermodynamics_lattice_output(
+      RectangularLattice<DensityOnLattice> &lattice,
+      const double current_time) override;
+
+  /**
+   * Pass on thermodynamics from the lattice.
+   * \param[in] lattice Lattice of tabulated values
+   * \param[in] current_time Time of the simulation in the computational frame
+   * \param[in] ensembles Particles, from which the 4-currents are computed
+   * \param[in] dens_param Parameters defining the smearing
+   */
+  void thermodynamics_lattice_output(
+      RectangularLattice<DensityOnLattice> &lattice, const double current_time,
+      const std::vector<Particles> &ensembles,
+      const DensityParameters &dens_param) override;
+
+  /**
+   * Pass on the energy-momentum tensor from the lattice.
+   * \param[in] tq Thermodynamic quantity to be written
+   * \param[in] lattice Lattice of tabulated values
+   * \param[in] current_time Time of the simulation in the computational frame
+   */
+  void thermodynamics_lattice_output(
+      const ThermodynamicQuantity tq,
+      RectangularLattice<EnergyMomentumTensor> &lattice,
+      const double current_time) override;
+
+  /**
+   * Pass on the thermalizer.
+   * \param[in] gct Thermalizer
+   */
+  void thermodynamics_output(const GrandCanThermalizer &gct) override;
+
+  /**
+   * Pass on fields.
+   * \param[in] name1 Name of the first field
+   * \param[in] name2 Name of the second field
+   * \param[in] lat Lattice storing both fields
+   */
+  void fields_output(
+      const std::string name1, const std::string name2,
+      RectangularLattice<std::pair<ThreeVector, ThreeVector>> &lat) override;
+
+ protected:
+  /// Called before a call is passed on by this class; does nothing by default
+  virtual void before_forwarding() {}
+
+  /// Output to which the calls are passed on
+  std::unique_ptr<OutputInterface> output_;
+
+ private:
+  /**
+   * \param[in] output Wrapped output
+   * \return Name, which gives the wrapper the same kind as the output
+   */
+  static std::string kind_of(const OutputInterface &output);
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_FORWARDINGOUTPUT_H_
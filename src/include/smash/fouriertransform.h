@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_FOURIERTRANSFORM_H_
+#define SRC_INCLUDE_SMASH_FOURIERTRANSFORM_H_
+
+#include <array>
+#include <complex>
+#include <vector>
+
+namespace smash {
+
+/**
+ * \ingroup data
+ *
+ * Fast Fourier transform of complex data of a fixed length.
+ *
+ * The forward transform is \f$ X_k = \sum_j x_j e^{-2 \pi i j k / n} \f$, the
+ * inverse transform includes the factor \f$ 1/n \f$, such that it restores
+ * the original data. Lengths that are powers of two are transformed with an
+ * iterative radix-2 algorithm; all other lengths are reduced to a convolution
+ * of power-of-two length by Bluestein's algorithm, so that every length takes
+ * \f$ O(n \log n) \f$ operations.
+ */
+class FourierTransform {
+ public:
+  /**
+   * Precompute the twiddle factors for the given length.
+   *
+   * \param[in] n Length of the transformed data
+   * \throw std::invalid_argument if n is not positive
+   */
+  explicit FourierTransform(int n);
+
+  /// \return Length of the transformed data
+  int size() const { return n_; }
+
+  /**
+   * Transform the data in place.
+   *
+   * \param[in,out] data Pointer to size() contiguous values
+   */
+  void forward(std::complex<double> *data) const;
+
+  /**
+   * Transform the data back in place, including the normalization.
+   *
+   * \param[in,out] data Pointer to size() contiguous values
+   */
+  void inverse(std::complex<double> *data) const;
+
+ private:
+  /**
+   * Radix-2 transform of m_ values without normalization.
+   *
+   * \param[in,out] data Pointer to m_ contiguous values
+   * \param[in] inverse Whether to use the positive sign in the exponent
+   */
+  void radix2(std::complex<double> *data, bool inverse) const;
+
+  /**
+   * Forward transform of arbitrary length using Bluestein's algorithm.
+   *
+   * \param[in,out] data Pointer to n_ contiguous values
+   */
+  void bluestein(std::complex<double> *data) const;
+
+  /// Length of the transformed data
+  int n_;
+  /// Length of the radix-2 transform, n_ or the padded Bluestein length
+  int m_;
+  /// \f$ e^{-2 \pi i k / m} \f$ for \f$ k < m / 2 \f$
+  std::vector<std::complex<double>> twiddles_;
+  /// Bluestein chirp \f$ e^{-i \pi k^2 / n} \f$, empty for powers of two
+  std::vector<std::complex<double>> chirp_;
+  /// Transform of the padded conjugate chirp used in the convolution
+  std::vector<std::complex<double>> chirp_spectrum_;
+};
+
+/**
+ * \ingroup data
+ *
+ * Fast Fourier transform of complex data on a 3D grid.
+ *
+ * The data is ordered like the nodes of a RectangularLattice, with the index
+ * \f$ i_x + n_x (i_y + n_y i_z) \f$. The transform is carried out as 1D
+ * transforms along every axis, which can be shared between several threads.
+ */
+class FourierTransform3D {
+ public:
+  /**
+   * Precompute the 1D transforms along the axes.
+   *
+   * \param[in] dims Number of grid points in x, y and z direction
+   */
+  explicit FourierTransform3D(const std::array<int, 3> &dims);
+
+  /// \return Number of grid points in x, y and z direction
+  const std::array<int, 3> &dims() const { return dims_; }
+
+  /// \return Total number of grid points
+  int size() const { return dims_[0] * dims_[1] * dims_[2]; }
+
+  /**
+   * Transform the data in place.
+   *
+   * \param[in,out] data Values at all size() grid points
+   * \param[in] n_threads Number of threads sharing the 1D transforms
+   */
+  void forward(std::vector<std::complex<double>> &data,
+               int n_threads = 1) const;
+
+  /**
+   * Transform the data back in place, including the normalization.
+   *
+   * \param[in,out] data Values at all size() grid points
+   * \param[in] n_threads Number of threads sharing the 1D transforms
+   */
+  void inverse(std::vector<std::complex<double>> &data,
+               int n_threads = 1) const;
+
+ private:
+  /**
+   * Carry out the 1D transforms along all axes.
+   *
+   * \param[in,out] data Values at all size() grid points
+   * \param[in] inverse Whether to transform back
+   * \param[in] n_threads Number of threads sharing the 1D transforms
+   */
+  void transform(std::vector<std::complex<double>> &data, bool inverse,
+                 int n_threads) const;
+
+  /// Number of grid points in x, y and z direction
+  std::array<int, 3> dims_;
+  /// 1D transforms along x, y and z
+  std::vector<FourierTransform> axes_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_FOURIERTRANSFORM_H_
@@ -66,6 +66,13 @@ class ThermLatticeNode {
   void add_particle(const ParticleData& p, double factor);
   /// dummy function for update_lattice
   void add_particle_for_derivatives(const ParticleData&, double, ThreeVector) {}
+  /**
+   * Add the particle contributions of another node to Tmu0, nb, ns and nq.
+   * Used by update_lattice to sum up partial lattices.
+   * \param[in] node Node filled with other particles
+   * \return This node
+   */
+  ThermLatticeNode& operator+=(const ThermLatticeNode& node);
   /**
    * Temperature, chemical potentials and rest frame velocity are
    * calculated given the hadron gas equation of state object
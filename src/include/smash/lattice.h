@@ -10,16 +10,22 @@
 #ifndef SRC_INCLUDE_SMASH_LATTICE_H_
 #define SRC_INCLUDE_SMASH_LATTICE_H_
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include "cxx14compat.h"
 #include "forwarddeclarations.h"
 #include "fourvector.h"
 #include "logging.h"
 #include "numerics.h"
+#include "parallel.h"
 
 namespace smash {
 static constexpr int LLattice = LogArea::Lattice::id;
@@ -103,6 +109,51 @@ class RectangularLattice {
   /// Sets all values on lattice to zeros.
   void reset() { std::fill(lattice_.begin(), lattice_.end(), T()); }
 
+  /**
+   * Moves and resizes the lattice by whole cells, keeping the cell sizes.
+   * Values at nodes that lie within both the old and the new lattice are
+   * kept, all other nodes are set to zero.
+   *
+   * \param[in] shift Number of cells by which the origin moves in x, y, z
+   *            directions.
+   * \param[in] n New number of cells in x, y, z directions.
+   * \throw std::logic_error if the lattice is periodic.
+   * \throw std::invalid_argument if a number of cells is not positive.
+   */
+  void move_window(const std::array<int, 3>& shift,
+                   const std::array<int, 3>& n) {
+    if (periodic_) {
+      throw std::logic_error("A periodic lattice cannot be moved.");
+    }
+    if (n[0] < 1 || n[1] < 1 || n[2] < 1) {
+      throw std::invalid_argument("Number of lattice cells should be > 0.");
+    }
+    std::vector<T> moved(static_cast<std::size_t>(n[0]) * n[1] * n[2]);
+    // Range of the new indices that were already part of the old lattice
+    std::array<int, 3> begin, end;
+    for (int i = 0; i < 3; i++) {
+      begin[i] = std::max(0, -shift[i]);
+      end[i] = std::min(n[i], n_cells_[i] - shift[i]);
+    }
+    for (int iz = begin[2]; iz < end[2]; iz++) {
+      for (int iy = begin[1]; iy < end[1]; iy++) {
+        for (int ix = begin[0]; ix < end[0]; ix++) {
+          moved[ix + n[0] * (iy + n[1] * iz)] = lattice_[index1d(
+              ix + shift[0], iy + shift[1], iz + shift[2])];
+        }
+      }
+    }
+    lattice_.swap(moved);
+    for (int i = 0; i < 3; i++) {
+      origin_[i] += shift[i] * cell_sizes_[i];
+      n_cells_[i] = n[i];
+      lattice_sizes_[i] = n[i] * cell_sizes_[i];
+    }
+    logg[LLattice].debug("Rectangular lattice moved: dims = (", n_cells_[0],
+                         ",", n_cells_[1], ",", n_cells_[2], "), origin = (",
+                         origin_[0], ",", origin_[1], ",", origin_[2], ")");
+  }
+
   /**
    * Checks if 3D index is out of lattice bounds.
    *
@@ -316,9 +367,13 @@ class RectangularLattice {
    *
    * return a lattice of ThreeVectors which are gradients of the values on the
    * original lattice
+   *
+   * \param[out] grad_lat Lattice of the gradients
+   * \param[in] n_threads Number of threads sharing the work, each of them
+   *            handling a slab of cells along z
    */
-  void compute_gradient_lattice(
-      RectangularLattice<ThreeVector>& grad_lat) const {
+  void compute_gradient_lattice(RectangularLattice<ThreeVector>& grad_lat,
+                                int n_threads = 1) const {
     if (n_cells_[0] < 2 || n_cells_[1] < 2 || n_cells_[2] < 2) {
       // Gradient calculation is impossible
       throw std::runtime_error(
@@ -331,79 +386,10 @@ class RectangularLattice {
           "Lattice for gradient should have the"
           " same origin/dims/periodicity as the original one.");
     }
-    const double inv_2dx = 0.5 / cell_sizes_[0];
-    const double inv_2dy = 0.5 / cell_sizes_[1];
-    const double inv_2dz = 0.5 / cell_sizes_[2];
-    const int dix = 1;
-    const int diy = n_cells_[0];
-    const int diz = n_cells_[0] * n_cells_[1];
-    const int d = diz * n_cells_[2];
-
-    for (int iz = 0; iz < n_cells_[2]; iz++) {
-      const int z_offset = diz * iz;
-      for (int iy = 0; iy < n_cells_[1]; iy++) {
-        const int y_offset = diy * iy + z_offset;
-        for (int ix = 0; ix < n_cells_[0]; ix++) {
-          const int index = ix + y_offset;
-          if (unlikely(ix == 0)) {
-            (grad_lat)[index].set_x1(
-                periodic_
-                    ? (lattice_[index + dix] - lattice_[index + diy - dix]) *
-                          inv_2dx
-                    : (lattice_[index + dix] - lattice_[index]) * 2.0 *
-                          inv_2dx);
-          } else if (unlikely(ix == n_cells_[0] - 1)) {
-            (grad_lat)[index].set_x1(
-                periodic_
-                    ? (lattice_[index - diy + dix] - lattice_[index - dix]) *
-                          inv_2dx
-                    : (lattice_[index] - lattice_[index - dix]) * 2.0 *
-                          inv_2dx);
-          } else {
-            (grad_lat)[index].set_x1(
-                (lattice_[index + dix] - lattice_[index - dix]) * inv_2dx);
-          }
-
-          if (unlikely(iy == 0)) {
-            (grad_lat)[index].set_x2(
-                periodic_
-                    ? (lattice_[index + diy] - lattice_[index + diz - diy]) *
-                          inv_2dy
-                    : (lattice_[index + diy] - lattice_[index]) * 2.0 *
-                          inv_2dy);
-          } else if (unlikely(iy == n_cells_[1] - 1)) {
-            (grad_lat)[index].set_x2(
-                periodic_
-                    ? (lattice_[index - diz + diy] - lattice_[index - diy]) *
-                          inv_2dy
-                    : (lattice_[index] - lattice_[index - diy]) * 2.0 *
-                          inv_2dy);
-          } else {
-            (grad_lat)[index].set_x2(
-                (lattice_[index + diy] - lattice_[index - diy]) * inv_2dy);
-          }
-
-          if (unlikely(iz == 0)) {
-            (grad_lat)[index].set_x3(
-                periodic_
-                    ? (lattice_[index + diz] - lattice_[index + d - diz]) *
-                          inv_2dz
-                    : (lattice_[index + diz] - lattice_[index]) * 2.0 *
-                          inv_2dz);
-          } else if (unlikely(iz == n_cells_[2] - 1)) {
-            (grad_lat)[index].set_x3(
-                periodic_
-                    ? (lattice_[index - d + diz] - lattice_[index - diz]) *
-                          inv_2dz
-                    : (lattice_[index] - lattice_[index - diz]) * 2.0 *
-                          inv_2dz);
-          } else {
-            (grad_lat)[index].set_x3(
-                (lattice_[index + diz] - lattice_[index - diz]) * inv_2dz);
-          }
-        }
-      }
-    }
+    parallel_for_blocks(n_cells_[2], n_threads,
+                        [&](int iz_begin, int iz_end, int) {
+                          compute_gradient_slab(grad_lat, iz_begin, iz_end);
+                        });
   }
 
   /**
@@ -414,10 +400,13 @@ class RectangularLattice {
    * \param[in] time_step the used time step, needed for the time derivative
    * \param[out] grad_lat a lattice of 4-arrays of 4-vectors with the following
    * structure: [djmu_dt, djmu_dx, djmu_dy, djmu_dz]
+   * \param[in] n_threads Number of threads sharing the work, each of them
+   *            handling a slab of cells along z
    */
   void compute_four_gradient_lattice(
       RectangularLattice<FourVector>& old_lat, double time_step,
-      RectangularLattice<std::array<FourVector, 4>>& grad_lat) const {
+      RectangularLattice<std::array<FourVector, 4>>& grad_lat,
+      int n_threads = 1) const {
     if (n_cells_[0] < 2 || n_cells_[1] < 2 || n_cells_[2] < 2) {
       // Gradient calculation is impossible
       throw std::runtime_error(
@@ -430,87 +419,11 @@ class RectangularLattice {
           "Lattice for gradient should have the"
           " same origin/dims/periodicity as the original one.");
     }
-    const double inv_2dx = 0.5 / cell_sizes_[0];
-    const double inv_2dy = 0.5 / cell_sizes_[1];
-    const double inv_2dz = 0.5 / cell_sizes_[2];
-    const int dix = 1;
-    const int diy = n_cells_[0];
-    const int diz = n_cells_[0] * n_cells_[1];
-    const int d = diz * n_cells_[2];
-
-    for (int iz = 0; iz < n_cells_[2]; iz++) {
-      const int z_offset = diz * iz;
-      for (int iy = 0; iy < n_cells_[1]; iy++) {
-        const int y_offset = diy * iy + z_offset;
-        for (int ix = 0; ix < n_cells_[0]; ix++) {
-          const int index = ix + y_offset;
-
-          // auxiliary vectors used for the calculation of gradients
-          FourVector grad_t_jmu(0.0, 0.0, 0.0, 0.0);
-          FourVector grad_x_jmu(0.0, 0.0, 0.0, 0.0);
-          FourVector grad_y_jmu(0.0, 0.0, 0.0, 0.0);
-          FourVector grad_z_jmu(0.0, 0.0, 0.0, 0.0);
-          // t direction
-          grad_t_jmu = (lattice_[index] - (old_lat)[index]) * (1.0 / time_step);
-          // x direction
-          if (unlikely(ix == 0)) {
-            grad_x_jmu =
-                periodic_
-                    ? (lattice_[index + dix] - lattice_[index + diy - dix]) *
-                          inv_2dx
-                    : (lattice_[index + dix] - lattice_[index]) * 2.0 * inv_2dx;
-          } else if (unlikely(ix == n_cells_[0] - 1)) {
-            grad_x_jmu =
-                periodic_
-                    ? (lattice_[index - diy + dix] - lattice_[index - dix]) *
-                          inv_2dx
-                    : (lattice_[index] - lattice_[index - dix]) * 2.0 * inv_2dx;
-          } else {
-            grad_x_jmu =
-                (lattice_[index + dix] - lattice_[index - dix]) * inv_2dx;
-          }
-          // y direction
-          if (unlikely(iy == 0)) {
-            grad_y_jmu =
-                periodic_
-                    ? (lattice_[index + diy] - lattice_[index + diz - diy]) *
-                          inv_2dy
-                    : (lattice_[index + diy] - lattice_[index]) * 2.0 * inv_2dy;
-          } else if (unlikely(iy == n_cells_[1] - 1)) {
-            grad_y_jmu =
-                periodic_
-                    ? (lattice_[index - diz + diy] - lattice_[index - diy]) *
-                          inv_2dy
-                    : (lattice_[index] - lattice_[index - diy]) * 2.0 * inv_2dy;
-          } else {
-            grad_y_jmu =
-                (lattice_[index + diy] - lattice_[index - diy]) * inv_2dy;
-          }
-          // z direction
-          if (unlikely(iz == 0)) {
-            grad_z_jmu =
-                periodic_
-                    ? (lattice_[index + diz] - lattice_[index + d - diz]) *
-                          inv_2dz
-                    : (lattice_[index + diz] - lattice_[index]) * 2.0 * inv_2dz;
-          } else if (unlikely(iz == n_cells_[2] - 1)) {
-            grad_z_jmu =
-                periodic_
-                    ? (lattice_[index - d + diz] - lattice_[index - diz]) *
-                          inv_2dz
-                    : (lattice_[index] - lattice_[index - diz]) * 2.0 * inv_2dz;
-          } else {
-            grad_z_jmu =
-                (lattice_[index + diz] - lattice_[index - diz]) * inv_2dz;
-          }
-          // fill
-          (grad_lat)[index][0] = grad_t_jmu;
-          (grad_lat)[index][1] = grad_x_jmu;
-          (grad_lat)[index][2] = grad_y_jmu;
-          (grad_lat)[index][3] = grad_z_jmu;
-        }
-      }
-    }
+    parallel_for_blocks(
+        n_cells_[2], n_threads, [&](int iz_begin, int iz_end, int) {
+          compute_four_gradient_slab(old_lat, time_step, grad_lat, iz_begin,
+                                     iz_end);
+        });
   }
 
   /**
@@ -541,8 +454,6 @@ class RectangularLattice {
    *             to the given position.
    * \return Boolean indicates whether the position r is located inside
    *         the lattice.
-   *
-   * \todo (oliiny): maybe 1-order interpolation instead of 0-order?
    */
   bool value_at(const ThreeVector& r, T& value) {
     const int ix = std::floor((r.x1() - origin_[0]) / cell_sizes_[0]);
@@ -557,6 +468,66 @@ class RectangularLattice {
     }
   }
 
+  /**
+   * Interpolates lattice quantity to coordinate r trilinearly between the
+   * centers of the eight surrounding cells. Within half a cell of the edges
+   * of a non-periodic lattice, the values of the outermost cells are used.
+   * Like value_at(), false is returned and the value is set to the default
+   * value if r is out of the lattice.
+   *
+   * The type T has to support addition with += and multiplication by a
+   * double.
+   *
+   * \param[in] r Position where the physical quantity would be evaluated.
+   * \param[out] value Physical quantity interpolated to the given position.
+   * \return Boolean indicates whether the position r is located inside
+   *         the lattice.
+   */
+  bool interpolate_at(const ThreeVector& r, T& value) {
+    std::array<int, 3> lower;
+    std::array<double, 3> weight_upper;
+    for (int i = 0; i < 3; i++) {
+      const double s = (r[i] - origin_[i]) / cell_sizes_[i];
+      if (!periodic_ && (s < 0. || s >= n_cells_[i])) {
+        value = T();
+        return false;
+      }
+      // Position in units of the cells relative to the first cell center
+      const double t = s - 0.5;
+      lower[i] = std::floor(t);
+      weight_upper[i] = t - lower[i];
+      if (!periodic_ && lower[i] < 0) {
+        lower[i] = 0;
+        weight_upper[i] = 0.;
+      } else if (!periodic_ && lower[i] >= n_cells_[i] - 1) {
+        lower[i] = n_cells_[i] - 1;
+        weight_upper[i] = 0.;
+      }
+    }
+    bool first = true;
+    for (int dz = 0; dz < 2; dz++) {
+      const double wz = dz ? weight_upper[2] : 1. - weight_upper[2];
+      for (int dy = 0; dy < 2; dy++) {
+        const double wy = dy ? weight_upper[1] : 1. - weight_upper[1];
+        for (int dx = 0; dx < 2; dx++) {
+          const double wx = dx ? weight_upper[0] : 1. - weight_upper[0];
+          const double w = wx * wy * wz;
+          if (w == 0.) {
+            continue;
+          }
+          const T term = node(lower[0] + dx, lower[1] + dy, lower[2] + dz) * w;
+          if (first) {
+            value = term;
+            first = false;
+          } else {
+            value += term;
+          }
+        }
+      }
+    }
+    return true;
+  }
+
   /**
    * A sub-lattice iterator, which iterates in a 3D-structured manner and
    * calls a function on every cell.
@@ -643,6 +614,77 @@ class RectangularLattice {
     iterate_sublattice(l_bounds, u_bounds, std::forward<F>(func));
   }
 
+  /**
+   * Iterates over the nodes within a cube of side length 2*r_cut around the
+   * given point like iterate_in_cube, but visits in every row along x only
+   * the nodes whose cell centers lie within an interval given for that row.
+   * Useful if the region of interest is known analytically, e.g. an
+   * ellipsoid, so that the nodes outside of it are not visited at all. The
+   * nodes of a row are visited in the order of increasing ix.
+   *
+   * \tparam R Type of the function giving the interval. Arguments are the
+   * y and z indices of the row, it returns the lower and upper bound of the
+   * x coordinate [fm] as a pair. An empty interval skips the row.
+   * \tparam F Type of the function. Arguments are the current node and the 3
+   * integer indices of the cell.
+   * \param[in] point Position, usually the position of particle [fm].
+   * \param[in] r_cut Maximum distance from the cell center to the
+   *            given position. [fm]
+   * \param[in] x_range Function giving the interval of x for every row.
+   * \param[in] func Function acting on the cells (such as taking value).
+   */
+  template <typename R, typename F>
+  void iterate_in_cube_rows(const ThreeVector& point, const double r_cut,
+                            R&& x_range, F&& func) {
+    std::array<int, 3> l_bounds, u_bounds;
+    for (int i = 0; i < 3; i++) {
+      l_bounds[i] =
+          std::ceil((point[i] - origin_[i] - r_cut) / cell_sizes_[i] - 0.5);
+      u_bounds[i] =
+          std::ceil((point[i] - origin_[i] + r_cut) / cell_sizes_[i] - 0.5);
+    }
+
+    if (!periodic_) {
+      for (int i = 0; i < 3; i++) {
+        if (l_bounds[i] < 0) {
+          l_bounds[i] = 0;
+        }
+        if (u_bounds[i] > n_cells_[i]) {
+          u_bounds[i] = n_cells_[i];
+        }
+        if (l_bounds[i] > n_cells_[i] || u_bounds[i] < 0) {
+          return;
+        }
+      }
+    }
+
+    for (int iz = l_bounds[2]; iz < u_bounds[2]; iz++) {
+      for (int iy = l_bounds[1]; iy < u_bounds[1]; iy++) {
+        const std::pair<double, double> x = x_range(iy, iz);
+        // index of the first and one past the last cell center in the range
+        const double lower =
+            std::ceil((x.first - origin_[0]) / cell_sizes_[0] - 0.5);
+        const double upper =
+            std::floor((x.second - origin_[0]) / cell_sizes_[0] - 0.5) + 1;
+        if (!(lower < u_bounds[0] && upper > l_bounds[0] && lower < upper)) {
+          continue;
+        }
+        const int ix_begin = std::max(l_bounds[0], static_cast<int>(lower));
+        const int ix_end = std::min(u_bounds[0], static_cast<int>(upper));
+        const int row_offset =
+            periodic_ ? n_cells_[0] * (positive_modulo(iy, n_cells_[1]) +
+                                       n_cells_[1] *
+                                           positive_modulo(iz, n_cells_[2]))
+                      : n_cells_[0] * (iy + n_cells_[1] * iz);
+        for (int ix = ix_begin; ix < ix_end; ix++) {
+          const int index =
+              (periodic_ ? positive_modulo(ix, n_cells_[0]) : ix) + row_offset;
+          func(lattice_[index], ix, iy, iz);
+        }
+      }
+    }
+  }
+
   /**
    * Calculate a volume integral with given integrand
    *
@@ -783,25 +825,255 @@ class RectangularLattice {
            periodic_ == lat->periodic();
   }
 
+  /**
+   * Provides lattices with the same structure as this one, e.g. for partial
+   * sums computed on several threads. They are kept between the calls and only
+   * recreated if the type, the number or the structure changes, so that
+   * repeated calls do not allocate memory. They are not copied with the
+   * lattice.
+   *
+   * \tparam U Type of the values on the scratch lattices
+   * \param[in] n Number of scratch lattices
+   * \return The scratch lattices with unspecified values on the nodes. They
+   *         are valid until the next call.
+   */
+  template <typename U>
+  std::vector<RectangularLattice<U>>& scratch_lattices(std::size_t n) {
+    auto* scratch = dynamic_cast<ScratchLattices<U>*>(scratch_.get());
+    if (scratch == nullptr) {
+      scratch_ = make_unique<ScratchLattices<U>>();
+      scratch = static_cast<ScratchLattices<U>*>(scratch_.get());
+    }
+    std::vector<RectangularLattice<U>>& lats = scratch->lattices;
+    if (!lats.empty() && !identical_to_lattice(&lats.front())) {
+      lats.clear();
+    }
+    while (lats.size() > n) {
+      lats.pop_back();
+    }
+    while (lats.size() < n) {
+      lats.emplace_back(lattice_sizes_, n_cells_, origin_, periodic_,
+                        when_update_);
+    }
+    return lats;
+  }
+
  protected:
   /// The lattice itself, array containing physical quantities.
   std::vector<T> lattice_;
   /// Lattice sizes in x, y, z directions.
-  const std::array<double, 3> lattice_sizes_;
+  std::array<double, 3> lattice_sizes_;
   /// Number of cells in x,y,z directions.
-  const std::array<int, 3> n_cells_;
+  std::array<int, 3> n_cells_;
   /// Cell sizes in x, y, z directions.
   const std::array<double, 3> cell_sizes_;
   /// Volume of a cell.
   const double cell_volume_;
   /// Coordinates of the left down nearer corner.
-  const std::array<double, 3> origin_;
+  std::array<double, 3> origin_;
   /// Whether the lattice is periodic.
   const bool periodic_;
   /// When the lattice should be recalculated.
   const LatticeUpdate when_update_;
 
  private:
+  /// Type-independent owner of scratch lattices
+  struct ScratchLatticesBase {
+    virtual ~ScratchLatticesBase() = default;
+  };
+  /// Scratch lattices of values of type U, see scratch_lattices()
+  template <typename U>
+  struct ScratchLattices : ScratchLatticesBase {
+    /// The scratch lattices
+    std::vector<RectangularLattice<U>> lattices;
+  };
+  /// Scratch lattices, see scratch_lattices()
+  std::unique_ptr<ScratchLatticesBase> scratch_;
+
+  /**
+   * Compute the finite difference gradient for the cells with
+   * iz_begin <= iz < iz_end.
+   *
+   * \see compute_gradient_lattice
+   * \param[out] grad_lat Lattice of the gradients
+   * \param[in] iz_begin First z index of the slab
+   * \param[in] iz_end One past the last z index of the slab
+   */
+  void compute_gradient_slab(RectangularLattice<ThreeVector>& grad_lat,
+                             int iz_begin, int iz_end) const {
+    const double inv_2dx = 0.5 / cell_sizes_[0];
+    const double inv_2dy = 0.5 / cell_sizes_[1];
+    const double inv_2dz = 0.5 / cell_sizes_[2];
+    const int dix = 1;
+    const int diy = n_cells_[0];
+    const int diz = n_cells_[0] * n_cells_[1];
+    const int d = diz * n_cells_[2];
+
+    for (int iz = iz_begin; iz < iz_end; iz++) {
+      const int z_offset = diz * iz;
+      for (int iy = 0; iy < n_cells_[1]; iy++) {
+        const int y_offset = diy * iy + z_offset;
+        for (int ix = 0; ix < n_cells_[0]; ix++) {
+          const int index = ix + y_offset;
+          if (unlikely(ix == 0)) {
+            (grad_lat)[index].set_x1(
+                periodic_
+                    ? (lattice_[index + dix] - lattice_[index + diy - dix]) *
+                          inv_2dx
+                    : (lattice_[index + dix] - lattice_[index]) * 2.0 *
+                          inv_2dx);
+          } else if (unlikely(ix == n_cells_[0] - 1)) {
+            (grad_lat)[index].set_x1(
+                periodic_
+                    ? (lattice_[index - diy + dix] - lattice_[index - dix]) *
+                          inv_2dx
+                    : (lattice_[index] - lattice_[index - dix]) * 2.0 *
+                          inv_2dx);
+          } else {
+            (grad_lat)[index].set_x1(
+                (lattice_[index + dix] - lattice_[index - dix]) * inv_2dx);
+          }
+
+          if (unlikely(iy == 0)) {
+            (grad_lat)[index].set_x2(
+                periodic_
+                    ? (lattice_[index + diy] - lattice_[index + diz - diy]) *
+                          inv_2dy
+                    : (lattice_[index + diy] - lattice_[index]) * 2.0 *
+                          inv_2dy);
+          } else if (unlikely(iy == n_cells_[1] - 1)) {
+            (grad_lat)[index].set_x2(
+                periodic_
+                    ? (lattice_[index - diz + diy] - lattice_[index - diy]) *
+                          inv_2dy
+                    : (lattice_[index] - lattice_[index - diy]) * 2.0 *
+                          inv_2dy);
+          } else {
+            (grad_lat)[index].set_x2(
+                (lattice_[index + diy] - lattice_[index - diy]) * inv_2dy);
+          }
+
+          if (unlikely(iz == 0)) {
+            (grad_lat)[index].set_x3(
+                periodic_
+                    ? (lattice_[index + diz] - lattice_[index + d - diz]) *
+                          inv_2dz
+                    : (lattice_[index + diz] - lattice_[index]) * 2.0 *
+                          inv_2dz);
+          } else if (unlikely(iz == n_cells_[2] - 1)) {
+            (grad_lat)[index].set_x3(
+                periodic_
+                    ? (lattice_[index - d + diz] - lattice_[index - diz]) *
+                          inv_2dz
+                    : (lattice_[index] - lattice_[index - diz]) * 2.0 *
+                          inv_2dz);
+          } else {
+            (grad_lat)[index].set_x3(
+                (lattice_[index + diz] - lattice_[index - diz]) * inv_2dz);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Compute the finite difference four-gradient for the cells with
+   * iz_begin <= iz < iz_end.
+   *
+   * \see compute_four_gradient_lattice
+   * \param[in] old_lat the lattice of FourVectors jmu at a previous time step
+   * \param[in] time_step the used time step, needed for the time derivative
+   * \param[out] grad_lat Lattice of the four-gradients
+   * \param[in] iz_begin First z index of the slab
+   * \param[in] iz_end One past the last z index of the slab
+   */
+  void compute_four_gradient_slab(
+      RectangularLattice<FourVector>& old_lat, double time_step,
+      RectangularLattice<std::array<FourVector, 4>>& grad_lat, int iz_begin,
+      int iz_end) const {
+    const double inv_2dx = 0.5 / cell_sizes_[0];
+    const double inv_2dy = 0.5 / cell_sizes_[1];
+    const double inv_2dz = 0.5 / cell_sizes_[2];
+    const int dix = 1;
+    const int diy = n_cells_[0];
+    const int diz = n_cells_[0] * n_cells_[1];
+    const int d = diz * n_cells_[2];
+
+    for (int iz = iz_begin; iz < iz_end; iz++) {
+      const int z_offset = diz * iz;
+      for (int iy = 0; iy < n_cells_[1]; iy++) {
+        const int y_offset = diy * iy + z_offset;
+        for (int ix = 0; ix < n_cells_[0]; ix++) {
+          const int index = ix + y_offset;
+
+          // auxiliary vectors used for the calculation of gradients
+          FourVector grad_t_jmu(0.0, 0.0, 0.0, 0.0);
+          FourVector grad_x_jmu(0.0, 0.0, 0.0, 0.0);
+          FourVector grad_y_jmu(0.0, 0.0, 0.0, 0.0);
+          FourVector grad_z_jmu(0.0, 0.0, 0.0, 0.0);
+          // t direction
+          grad_t_jmu = (lattice_[index] - (old_lat)[index]) * (1.0 / time_step);
+          // x direction
+          if (unlikely(ix == 0)) {
+            grad_x_jmu =
+                periodic_
+                    ? (lattice_[index + dix] - lattice_[index + diy - dix]) *
+                          inv_2dx
+                    : (lattice_[index + dix] - lattice_[index]) * 2.0 * inv_2dx;
+          } else if (unlikely(ix == n_cells_[0] - 1)) {
+            grad_x_jmu =
+                periodic_
+                    ? (lattice_[index - diy + dix] - lattice_[index - dix]) *
+                          inv_2dx
+                    : (lattice_[index] - lattice_[index - dix]) * 2.0 * inv_2dx;
+          } else {
+            grad_x_jmu =
+                (lattice_[index + dix] - lattice_[index - dix]) * inv_2dx;
+          }
+          // y direction
+          if (unlikely(iy == 0)) {
+            grad_y_jmu =
+                periodic_
+                    ? (lattice_[index + diy] - lattice_[index + diz - diy]) *
+                          inv_2dy
+                    : (lattice_[index + diy] - lattice_[index]) * 2.0 * inv_2dy;
+          } else if (unlikely(iy == n_cells_[1] - 1)) {
+            grad_y_jmu =
+                periodic_
+                    ? (lattice_[index - diz + diy] - lattice_[index - diy]) *
+                          inv_2dy
+                    : (lattice_[index] - lattice_[index - diy]) * 2.0 * inv_2dy;
+          } else {
+            grad_y_jmu =
+                (lattice_[index + diy] - lattice_[index - diy]) * inv_2dy;
+          }
+          // z direction
+          if (unlikely(iz == 0)) {
+            grad_z_jmu =
+                periodic_
+                    ? (lattice_[index + diz] - lattice_[index + d - diz]) *
+                          inv_2dz
+                    : (lattice_[index + diz] - lattice_[index]) * 2.0 * inv_2dz;
+          } else if (unlikely(iz == n_cells_[2] - 1)) {
+            grad_z_jmu =
+                periodic_
+                    ? (lattice_[index - d + diz] - lattice_[index - diz]) *
+                          inv_2dz
+                    : (lattice_[index] - lattice_[index - diz]) * 2.0 * inv_2dz;
+          } else {
+            grad_z_jmu =
+                (lattice_[index + diz] - lattice_[index - diz]) * inv_2dz;
+          }
+          // fill
+          (grad_lat)[index][0] = grad_t_jmu;
+          (grad_lat)[index][1] = grad_x_jmu;
+          (grad_lat)[index][2] = grad_y_jmu;
+          (grad_lat)[index][3] = grad_z_jmu;
+        }
+      }
+    }
+  }
+
   /**
    * Returns division modulo, which is always between 0 and n-1
    * i%n is not suitable, because it returns results from -(n-1) to n-1
@@ -0,0 +1,156 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_LATTICEWINDOW_H_
+#define SRC_INCLUDE_SMASH_LATTICEWINDOW_H_
+
+#include <array>
+#include <vector>
+
+#include "forwarddeclarations.h"
+#include "lattice.h"
+
+namespace smash {
+
+/**
+ * Geometry of a non-periodic lattice that follows the baryons of the
+ * simulation.
+ *
+ * Every few time steps the window is fitted to the bounding box of all
+ * baryons and nuclei, enlarged by a margin. It is moved by whole cells on the
+ * grid of the initial lattice, such that the cell sizes never change and
+ * values on the lattices only have to be shifted (see
+ * RectangularLattice::move_window). The window never exceeds a maximal
+ * number of cells. If the bounding box is larger, the window is centered on
+ * the mean position of the baryons instead, leaving out the outermost ones.
+ *
+ * In addition the window keeps a bitmap of the tiles of
+ * \f$ 4 \times 4 \times 4 \f$ nodes that are within a given range of a baryon
+ * at the current or at the previous update. Nodes of all other tiles carry
+ * neither density nor gradients, so that evaluating potentials there can be
+ * skipped.
+ */
+class LatticeWindow {
+ public:
+  /**
+   * Start the window at the initial lattice.
+   *
+   * \param[in] origin Origin of the initial lattice in fm
+   * \param[in] cell_sizes Sizes of the lattice cells in fm
+   * \param[in] n_cells Number of cells of the initial lattice
+   * \param[in] max_n_cells Maximal number of cells of the window
+   * \param[in] margin Distance between the outermost baryons and the edges
+   *            of the window in fm
+   * \param[in] update_interval Number of calls of follow() between two fits
+   * \param[in] occupancy_range Distance from a baryon up to which the
+   *            nodes are considered occupied in fm
+   * \throw std::invalid_argument if the margin is negative, or the maximal
+   *        numbers of cells or the update interval are not positive
+   */
+  LatticeWindow(const std::array<double, 3> &origin,
+                const std::array<double, 3> &cell_sizes,
+                const std::array<int, 3> &n_cells,
+                const std::array<int, 3> &max_n_cells, double margin,
+                int update_interval, double occupancy_range);
+
+  /**
+   * Fit the window to the baryons of all ensembles, if the update interval
+   * has passed since the last fit. The window is kept if there are no
+   * baryons.
+   *
+   * \param[in] ensembles Particles of all ensembles
+   * \return Whether the window was moved or resized
+   */
+  bool follow(const std::vector<Particles> &ensembles);
+
+  /**
+   * Move a lattice along with the last change of the window.
+   *
+   * \tparam T Type of the values on the lattice
+   * \param[in,out] lattice Lattice covering the window before the change, or
+   *                nullptr if there is no such lattice
+   */
+  template <typename T>
+  void move(RectangularLattice<T> *lattice) const {
+    if (lattice != nullptr) {
+      lattice->move_window(shift_, n_cells_);
+    }
+  }
+
+  /// \return Number of cells by which the origin moved in the last change
+  const std::array<int, 3> &shift() const { return shift_; }
+
+  /// \return Number of cells of the window
+  const std::array<int, 3> &n_cells() const { return n_cells_; }
+
+  /// \return Origin of the window in fm
+  std::array<double, 3> origin() const;
+
+  /**
+   * Mark the tiles within the occupancy range of the baryons of all
+   * ensembles. Tiles that were occupied at the previous call stay marked as
+   * well, because time derivatives are nonzero there.
+   *
+   * \param[in] ensembles Particles of all ensembles
+   */
+  void update_occupancy(const std::vector<Particles> &ensembles);
+
+  /**
+   * \param[in] index 1-dimensional index of a node of the window
+   * \return Whether the node belongs to an occupied tile
+   */
+  bool occupied(int index) const {
+    const int ix = index % n_cells_[0];
+    index /= n_cells_[0];
+    const int iy = index % n_cells_[1];
+    const int iz = index / n_cells_[1];
+    const int tile =
+        ix / tile_size +
+        n_tiles_[0] * (iy / tile_size + n_tiles_[1] * (iz / tile_size));
+    return occupied_[tile];
+  }
+
+  /// Number of nodes along every edge of a tile of the occupancy bitmap
+  static constexpr int tile_size = 4;
+
+ private:
+  /// Resize the occupancy bitmaps to the window, marking all tiles occupied
+  void reset_occupancy();
+
+  /// Origin of the grid on which the window moves in fm
+  const std::array<double, 3> grid_origin_;
+  /// Sizes of the lattice cells in fm
+  const std::array<double, 3> cell_sizes_;
+  /// Maximal number of cells of the window
+  const std::array<int, 3> max_n_cells_;
+  /// Distance between the outermost baryons and the window edges in fm
+  const double margin_;
+  /// Number of calls of follow() between two fits
+  const int update_interval_;
+  /// Distance from a baryon up to which nodes are occupied in fm
+  const double occupancy_range_;
+  /// Number of calls of follow() so far
+  int n_calls_ = 0;
+  /// Index of the first cell of the window on the grid
+  std::array<int, 3> offset_ = {{0, 0, 0}};
+  /// Number of cells of the window
+  std::array<int, 3> n_cells_;
+  /// Number of cells by which the origin moved in the last change
+  std::array<int, 3> shift_ = {{0, 0, 0}};
+  /// Number of tiles of the occupancy bitmap in x, y, z directions
+  std::array<int, 3> n_tiles_;
+  /// Occupied tiles at the current and the previous update
+  std::vector<bool> occupied_;
+  /// Tiles occupied by baryons at the previous update
+  std::vector<bool> previous_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_LATTICEWINDOW_H_
@@ -9,10 +9,14 @@
 
 #include <cmath>
 #include <cstdint>
+#include <istream>
 #include <list>
+#include <memory>
 #include <string>
 #include <utility>
 
+#include "columnarfile.h"
+#include "compression.h"
 #include "forwarddeclarations.h"
 #include "modusdefault.h"
 
@@ -195,6 +199,27 @@ class ListModus : public ModusDefault {
    */
   std::string next_event_();
 
+  /**
+   * Open a particle list for reading. A compressed file is decompressed while
+   * it is read, one frame at a time. The position in it is kept until another
+   * compressed file is opened, such that the events are not decompressed
+   * again.
+   *
+   * \param[in] filepath Path to the file
+   * \return Stream of the uncompressed content of the file
+   * \throws runtime_error if a compressed file cannot be decompressed
+   */
+  std::unique_ptr<std::istream> open_particle_list_(const bf::path &filepath);
+
+  /**
+   * Create the particles of the next event in the columnar file, which is
+   * found through the index of the file.
+   *
+   * \param[out] particles Particles to which the event is added
+   * \throws runtime_error if the file has no further event
+   */
+  void read_columnar_event_(Particles &particles);
+
   /// File directory of the particle list
   std::string particle_list_file_directory_;
 
@@ -221,6 +246,18 @@ class ListModus : public ModusDefault {
   /// last read position in current file
   std::streampos last_read_position_;
 
+  /**
+   * Columnar file from which the events are read instead of the particle
+   * lists, or nullptr. Then file_id_ is the position of the next event in it.
+   */
+  std::unique_ptr<ColumnarFileReader> columnar_file_;
+
+  /// Path of the compressed particle list in decompressed_list_
+  bf::path decompressed_path_;
+
+  /// Decompresses the last compressed particle list
+  std::unique_ptr<FrameDecompressor> decompressed_list_;
+
   /**\ingroup logging
    * Writes the initial state for the List to the output stream.
    *
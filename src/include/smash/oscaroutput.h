@@ -10,8 +10,10 @@
 #ifndef SRC_INCLUDE_SMASH_OSCAROUTPUT_H_
 #define SRC_INCLUDE_SMASH_OSCAROUTPUT_H_
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "file.h"
 #include "forwarddeclarations.h"
@@ -69,8 +71,10 @@ class OscarOutput : public OutputInterface {
    *
    * \param[in] path Output path.
    * \param[in] name Name of the ouput.
+   * \param[in] out_par Output parameters, of which the compression is used.
    */
-  OscarOutput(const bf::path &path, const std::string &name);
+  OscarOutput(const bf::path &path, const std::string &name,
+              const OutputParameters &out_par);
 
   /**
    * Writes the initial particle information of an event to the oscar output.
@@ -98,6 +102,13 @@ class OscarOutput : public OutputInterface {
    */
   void at_interaction(const Action &action, const double density) override;
 
+  /**
+   * Writes an interaction block for every dilepton decay, like for a decay
+   * action at zero density.
+   * \param[in] decays Dilepton decays found by the shining method.
+   */
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override;
+
   /**
    * Writes a prefix line then write out all current particles.
    *
@@ -112,6 +123,19 @@ class OscarOutput : public OutputInterface {
                             const EventInfo &event) override;
 
  private:
+  /**
+   * Write the prefix line of an interaction block.
+   * \param[in] n_in Number of incoming particles.
+   * \param[in] n_out Number of outgoing particles.
+   * \param[in] density Density at the interaction point.
+   * \param[in] weight Total weight of the interaction.
+   * \param[in] partial_weight Partial weight of the interaction.
+   * \param[in] type Process type of the interaction.
+   */
+  void write_interaction_header(std::size_t n_in, std::size_t n_out,
+                                double density, double weight,
+                                double partial_weight, ProcessType type);
+
   /**
    * Write single particle information line to output.
    * \param[in] data Data of particle.
@@ -128,6 +152,21 @@ class OscarOutput : public OutputInterface {
   /// Keep track of event number.
   int current_event_ = 0;
 
+  /**
+   * Indices of the columns selected by the output filter, in the order in
+   * which they are written, or empty to write all columns.
+   */
+  std::vector<int> columns_;
+
+  /// Size of the buffer of the output file
+  static constexpr std::size_t buffer_size_ = 1 << 20;
+
+  /**
+   * Buffer of the output file, such that the particle lines are written to
+   * disk in large blocks. It has to outlive the file.
+   */
+  std::unique_ptr<char[]> buffer_;
+
   /// Full filepath of the output file.
   RenamingFilePtr file_;
 };
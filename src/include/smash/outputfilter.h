@@ -0,0 +1,186 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_OUTPUTFILTER_H_
+#define SRC_INCLUDE_SMASH_OUTPUTFILTER_H_
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "configuration.h"
+#include "forwardingoutput.h"
+#include "outputinterface.h"
+#include "particledata.h"
+#include "pdgcode.h"
+
+namespace smash {
+
+/**
+ * \ingroup output
+ *
+ * Selection of the particles and columns that an output writes, as given
+ * by the \key Filter section of the output content. By default, everything
+ * is written.
+ */
+class OutputFilter {
+ public:
+  /// Create a filter that accepts all particles and columns.
+  OutputFilter() = default;
+
+  /**
+   * Create a filter from the \key Filter section of an output content.
+   *
+   * \param[in] conf The \key Filter section
+   * \throw std::invalid_argument if a cut is not meaningful
+   */
+  explicit OutputFilter(Configuration conf);
+
+  /**
+   * \param[in] p Particle to be written
+   * \return Whether the particle passes all cuts
+   */
+  bool accepts(const ParticleData &p) const;
+
+  /// \return Whether some particles may not pass the cuts
+  bool selects_particles() const { return selects_particles_; }
+
+  /// \return Names of the columns to be written or empty for all columns
+  const std::vector<std::string> &columns() const { return columns_; }
+
+ private:
+  /// Whether some particles may not pass the cuts
+  bool selects_particles_ = false;
+  /// Accepted PDG codes, sorted, or empty if all are accepted
+  std::vector<PdgCode> pdg_codes_;
+  /// Whether only charged particles are accepted
+  bool only_charged_ = false;
+  /// Whether only hadrons are accepted
+  bool only_hadrons_ = false;
+  /// Largest accepted absolute rapidity, if positive
+  double rapidity_cut_ = 0.;
+  /// Smallest and largest accepted transverse momentum [GeV]
+  std::array<double, 2> pt_range_ = {{0., 0.}};
+  /// Whether the transverse momentum is cut
+  bool cut_pt_ = false;
+  /// Names of the columns to be written or empty for all columns
+  std::vector<std::string> columns_;
+};
+
+/**
+ * \ingroup output
+ *
+ * Passes only the particles accepted by a filter on to another output, such
+ * that the other particles are never formatted, compressed or written.
+ *
+ * Particle lists are copied without the rejected particles, keeping the ids
+ * and the order of the accepted ones. Actions are passed on with only their
+ * accepted incoming and outgoing particles, and are dropped if none of their
+ * particles is accepted. Nothing is copied if all particles are accepted.
+ * Calls with lattices, ensembles or the thermalizer are passed on unchanged
+ * by ForwardingOutput.
+ */
+class FilteredOutput : public ForwardingOutput {
+ public:
+  /**
+   * Wrap an output.
+   *
+   * \param[in] output Output of the particles or collisions content
+   * \param[in] filter Filter of the output content
+   */
+  FilteredOutput(std::unique_ptr<OutputInterface> output, OutputFilter filter);
+
+  using ForwardingOutput::at_eventend;
+  using ForwardingOutput::at_eventstart;
+  using ForwardingOutput::at_intermediate_time;
+
+  /**
+   * Write the accepted particles at event start.
+   * \param[in] particles List of particles
+   * \param[in] event_number Number of the current event
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventstart(const Particles &particles, const int event_number,
+                     const EventInfo &info) override;
+
+  /**
+   * Write the accepted particles at the end of an event.
+   * \param[in] particles List of particles
+   * \param[in] event_number Number of the current event
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_eventend(const Particles &particles, const int event_number,
+                   const EventInfo &info) override;
+
+  /**
+   * Write an action with its accepted particles.
+   * \param[in] action The action object, containing the initial and final
+   *            state etc.
+   * \param[in] density The density at the interaction point
+   */
+  void at_interaction(const Action &action, const double density) override;
+
+  /**
+   * Write the dilepton decays with their accepted particles, one by one.
+   * \param[in] decays Dilepton decays found by the shining method
+   */
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override;
+
+  /**
+   * Write the accepted particles at an intermediate time.
+   * \param[in] particles List of particles
+   * \param[in] clock System clock
+   * \param[in] dens_param Parameters for density calculation
+   * \param[in] info Event info, see \ref event_info
+   */
+  void at_intermediate_time(const Particles &particles,
+                            const std::unique_ptr<Clock> &clock,
+                            const DensityParameters &dens_param,
+                            const EventInfo &info) override;
+
+ private:
+  /**
+   * \param[in] particles List of particles
+   * \return The particles themselves, if all are accepted, or a copy of the
+   *         accepted ones, which is valid until the next call
+   */
+  const Particles &filter(const Particles &particles);
+
+  /**
+   * Apply the filter to the incoming and then the outgoing particles of an
+   * action, storing the results in is_accepted_.
+   *
+   * \param[in] action Performed action
+   * \return Number of accepted particles
+   */
+  std::size_t mark_accepted(const Action &action);
+
+  /**
+   * \param[in] action Performed action, with its particles marked by
+   *            mark_accepted()
+   * \return A record of the action with its accepted particles
+   */
+  std::unique_ptr<Action> record_accepted(const Action &action) const;
+
+  /// Filter of the output content
+  const OutputFilter filter_;
+  /// Copy of the accepted particles
+  std::unique_ptr<Particles> accepted_;
+  /**
+   * Whether the particles of the last call of filter() or mark_accepted()
+   * are accepted
+   */
+  std::vector<bool> is_accepted_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_OUTPUTFILTER_H_
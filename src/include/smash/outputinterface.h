@@ -21,6 +21,7 @@
 #include "grandcan_thermalizer.h"
 #include "lattice.h"
 #include "macros.h"
+#include "particledata.h"
 
 namespace smash {
 static constexpr int LOutput = LogArea::Output::id;
@@ -56,6 +57,26 @@ struct EventInfo {
   bool empty_event;
 };
 
+/**
+ * \ingroup output
+ *
+ * \brief Compact record of a dilepton decay
+ *
+ * Dilepton decays found with the shining method are never performed, they
+ * are only written to the dilepton output. This keeps what the output needs
+ * from them without the overhead of an action.
+ */
+struct DileptonDecay {
+  /// Decaying particle
+  ParticleData parent;
+  /// Decay products: the lepton pair and, for Dalitz decays, the hadron
+  ParticleList products;
+  /// Shining weight of the decay
+  double weight;
+  /// Partial width of the decay mode [GeV]
+  double partial_width;
+};
+
 /**
  * \ingroup output
  *
@@ -66,6 +87,7 @@ struct EventInfo {
  * 1) At event start and event end: at_eventstart, at_eventend
  * 2) After every fixed time period: at_intermediate_time, thermodynamics_output
  * 3) At each interaction: at_interaction
+ * 4) For all dilepton decays found in one search: at_dilepton_decays
  */
 class OutputInterface {
  public:
@@ -200,6 +222,15 @@ class OutputInterface {
     SMASH_UNUSED(density);
   }
 
+  /**
+   * Called with all dilepton decays found by the shining method in one search
+   * of the particle list. By default, every decay is written as an
+   * interaction at zero density.
+   *
+   * \param decays The dilepton decays in the order they were found.
+   */
+  virtual void at_dilepton_decays(const std::vector<DileptonDecay> &decays);
+
   /**
    * Output launched after every N'th timestep. N is controlled by an option.
    * \param particles List of particles.
@@ -14,6 +14,7 @@
 #include "density.h"
 #include "forwarddeclarations.h"
 #include "logging.h"
+#include "outputfilter.h"
 
 namespace smash {
 static constexpr int LExperiment = LogArea::Experiment::id;
@@ -41,12 +42,15 @@ struct OutputParameters {
         dil_extended(false),
         photons_extended(false),
         ic_extended(false),
-        subcon_for_rivet(0) {}
+        subcon_for_rivet(0),
+        compression("None") {}
 
   /// Constructor from configuration
   explicit OutputParameters(Configuration&& conf) : OutputParameters() {
     logg[LExperiment].trace(SMASH_SOURCE_LOCATION);
 
+    compression = conf.take({"Compression"}, compression);
+
     if (conf.has_value({"Thermodynamics"})) {
       auto subcon = conf["Thermodynamics"];
       if (subcon.has_value({"Position"})) {
@@ -74,11 +78,17 @@ struct OutputParameters {
       part_extended = conf.take({"Particles", "Extended"}, false);
       part_only_final =
           conf.take({"Particles", "Only_Final"}, OutputOnlyFinal::Yes);
+      if (conf.has_value({"Particles", "Filter"})) {
+        part_filter = OutputFilter(conf["Particles"]["Filter"]);
+      }
     }
 
     if (conf.has_value({"Collisions"})) {
       coll_extended = conf.take({"Collisions", "Extended"}, false);
       coll_printstartend = conf.take({"Collisions", "Print_Start_End"}, false);
+      if (conf.has_value({"Collisions", "Filter"})) {
+        coll_filter = OutputFilter(conf["Collisions"]["Filter"]);
+      }
     }
 
     if (conf.has_value({"Dileptons"})) {
@@ -115,6 +125,21 @@ struct OutputParameters {
     }
   }
 
+  /**
+   * Pass the filter of an output content to its outputs
+   * \param[in] content Output content
+   * \return Filter of the particles or collisions output, or nullptr for the
+   *         other contents, which cannot be filtered.
+   */
+  const OutputFilter *get_filter(const std::string &content) const {
+    if (content == "Particles") {
+      return &part_filter;
+    } else if (content == "Collisions") {
+      return &coll_filter;
+    }
+    return nullptr;
+  }
+
   /// Point, where thermodynamic quantities are calculated
   ThreeVector td_position;
 
@@ -157,12 +182,18 @@ struct OutputParameters {
   /// Print only final particles in event
   OutputOnlyFinal part_only_final;
 
+  /// Particles and columns written by the particles output
+  OutputFilter part_filter;
+
   /// Extended format for collisions output
   bool coll_extended;
 
   /// Print initial and final particles in event into collision output
   bool coll_printstartend;
 
+  /// Particles and columns written by the collisions output
+  OutputFilter coll_filter;
+
   /// Extended format for dilepton output
   bool dil_extended;
 
@@ -174,6 +205,9 @@ struct OutputParameters {
 
   /// Rivet specfic setup configurations
   Configuration subcon_for_rivet;
+
+  /// Compression of the binary and OSCAR outputs ("None" or "Zlib")
+  std::string compression;
 };
 
 }  // namespace smash
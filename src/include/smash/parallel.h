@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_PARALLEL_H_
+#define SRC_INCLUDE_SMASH_PARALLEL_H_
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace smash {
+
+/**
+ * Split the index range [0, n) into contiguous blocks and process every block
+ * on its own thread.
+ *
+ * The blocks are ordered, block k covering smaller indices than block k + 1,
+ * and have sizes differing by at most one. Block 0 is processed by the calling
+ * thread, so that no thread is started at all if only one block is requested.
+ * If a block throws, the exception is rethrown on the calling thread after all
+ * blocks have finished. If a thread cannot be started, the threads started
+ * before are joined and the exception is rethrown without processing block 0.
+ *
+ * \tparam F Type of the function, callable as func(begin, end, block)
+ * \param[in] n Number of indices
+ * \param[in] n_blocks Requested number of blocks; it is reduced to n if it is
+ *            larger and increased to 1 if it is smaller.
+ * \param[in] func Function processing the indices [begin, end) of the given
+ *            block
+ * \return Number of blocks that were actually used
+ */
+template <typename F>
+int parallel_for_blocks(int n, int n_blocks, F &&func) {
+  n_blocks = std::max(1, std::min(n_blocks, n));
+  if (n_blocks == 1) {
+    func(0, n, 0);
+    return 1;
+  }
+  const int block_size = n / n_blocks;
+  const int remainder = n % n_blocks;
+  auto block_begin = [&](int block) {
+    return block * block_size + std::min(block, remainder);
+  };
+
+  std::vector<std::exception_ptr> errors(n_blocks);
+  std::vector<std::thread> workers;
+  workers.reserve(n_blocks - 1);
+  try {
+    for (int block = 1; block < n_blocks; block++) {
+      workers.emplace_back([&, block]() {
+        try {
+          func(block_begin(block), block_begin(block + 1), block);
+        } catch (...) {
+          errors[block] = std::current_exception();
+        }
+      });
+    }
+  } catch (...) {
+    // a thread could not be started, the running ones must not be destroyed
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+    throw;
+  }
+  try {
+    func(0, block_begin(1), 0);
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  for (const std::exception_ptr &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return n_blocks;
+}
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_PARALLEL_H_
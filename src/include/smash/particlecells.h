@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_PARTICLECELLS_H_
+#define SRC_INCLUDE_SMASH_PARTICLECELLS_H_
+
+#include <array>
+#include <vector>
+
+#include "forwarddeclarations.h"
+#include "particledata.h"
+#include "particles.h"
+#include "threevector.h"
+
+namespace smash {
+
+/**
+ * Sorts a list of particles into cubic cells to look up the particles near a
+ * point of interest.
+ *
+ * Unlike the Grid, which is built to find pairs of particles, this class
+ * answers queries for single points: neighbors() returns all particles that
+ * may be within the cell length of the point. It is used to evaluate the
+ * smeared densities off the lattice, where only particles within the cutoff
+ * radius of the Gaussian contribute.
+ *
+ * The particles are not copied, so the list or the ensembles have to outlive
+ * the cells and must not be modified in the meantime.
+ */
+class ParticleCells {
+ public:
+  /**
+   * Sort the particles into cells.
+   *
+   * The cells are at least as large as \p min_cell_length. They are enlarged
+   * if the particles are spread out so far that there would be more cells than
+   * particles.
+   *
+   * \param[in] particles List of the particles to sort into cells
+   * \param[in] min_cell_length Minimal edge length of the cells in fm
+   * \throw std::invalid_argument if the cell length is not positive
+   */
+  ParticleCells(const ParticleList &particles, double min_cell_length);
+
+  /**
+   * Sort the particles of all ensembles into cells, ensemble after ensemble.
+   *
+   * \param[in] ensembles Particles of all ensembles
+   * \param[in] min_cell_length Minimal edge length of the cells in fm
+   * \throw std::invalid_argument if the cell length is not positive
+   */
+  ParticleCells(const std::vector<Particles> &ensembles,
+                double min_cell_length);
+
+  /**
+   * Collect the particles in the cell of the point \p r and in its 26
+   * neighboring cells.
+   *
+   * This includes every particle whose distance to \p r is smaller than the
+   * minimal cell length, and maybe some more. The particles are returned in
+   * the order of the original list, such that sums over them are identical
+   * to sums over the whole list, if the other particles give no contribution.
+   *
+   * \param[in] r Point of interest in fm
+   * \return Pointers to the particles near \p r
+   */
+  std::vector<const ParticleData *> neighbors(const ThreeVector &r) const;
+
+  /// \return All particles, in the order of the list or the ensembles
+  const std::vector<const ParticleData *> &particles() const {
+    return particles_;
+  }
+
+  /// \return Number of cells in x, y and z direction
+  const std::array<int, 3> &n_cells() const { return n_cells_; }
+
+ private:
+  /// Sort the particles into cells of at least the given length
+  void sort_into_cells(double min_cell_length);
+
+  /// All particles
+  std::vector<const ParticleData *> particles_;
+  /// Lower corner of the first cell in fm
+  std::array<double, 3> min_position_;
+  /// Edge length of the cells in fm
+  double cell_length_ = 0.;
+  /// Number of cells in x, y and z direction
+  std::array<int, 3> n_cells_ = {{1, 1, 1}};
+  /**
+   * Position of the first particle of every cell in indices_. The particles
+   * of cell i are indices_[cell_begin_[i]] to indices_[cell_begin_[i + 1]].
+   */
+  std::vector<int> cell_begin_;
+  /// Indices of the particles in the list, ordered by cell
+  std::vector<int> indices_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_PARTICLECELLS_H_
@@ -40,6 +40,15 @@ class Particles {
   /// Cannot be copied
   Particles &operator=(const Particles &) = delete;
 
+  /**
+   * Copy all particles into a new object, keeping their ids and indexes. In
+   * contrast to inserting them, the copy is indistinguishable from the
+   * original, e.g. for a snapshot to be written out later.
+   *
+   * \return The copy
+   */
+  std::unique_ptr<Particles> clone() const;
+
   /// \return a copy of all particles as a std::vector<ParticleData>.
   ParticleList copy_to_vector() const {
     if (dirty_.empty()) {
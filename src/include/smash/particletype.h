@@ -317,6 +317,36 @@ class ParticleType {
   DecayBranchList get_partial_widths(const FourVector p, const ThreeVector x,
                                      WhichDecaymodes wh) const;
 
+  /**
+   * Evaluate the mass-dependent partial decay widths of a particle without
+   * creating any DecayBranch objects. Together with get_decay_branches this
+   * splits get_partial_widths into two steps, such that the (comparatively
+   * expensive) list of branches only needs to be built for particles that
+   * actually decay.
+   *
+   * \param[in] p 4-momentum of the decaying particle.
+   * \param[in] x position of the decaying particle.
+   * \param[in] wh enum that decides which decaymodes are taken into account.
+   * \param[out] partial_widths Buffer with room for at least
+   *             decay_modes().decay_mode_list().size() entries. On return it
+   *             holds the partial width of each decay mode, in the order of
+   *             the decay mode list; modes not selected by \p wh are zero.
+   * \return the total width, i.e. the sum of all entries in \p
+   *         partial_widths.
+   */
+  double get_total_width(const FourVector p, const ThreeVector x,
+                         WhichDecaymodes wh, double *partial_widths) const;
+
+  /**
+   * Create the decay branches from partial widths previously evaluated with
+   * get_total_width.
+   *
+   * \param[in] partial_widths The partial widths as returned by
+   *             get_total_width.
+   * \return a list of process branches for all modes with non-zero width.
+   */
+  DecayBranchList get_decay_branches(const double *partial_widths) const;
+
   /**
    * Get the mass-dependent partial width of a resonance with mass m,
    * decaying into two given daughter particles.
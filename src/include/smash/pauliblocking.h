@@ -10,6 +10,10 @@
 #ifndef SRC_INCLUDE_SMASH_PAULIBLOCKING_H_
 #define SRC_INCLUDE_SMASH_PAULIBLOCKING_H_
 
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "configuration.h"
@@ -62,13 +66,90 @@ class PauliBlocker {
    *                       particles when the phase-space density for outgoing
    *                       ones is estimated.
    * \return Phase-space density
+   *
+   * If the particles are indexed, only the particles of the neighboring
+   * cells of the index are considered. The result is the same as without
+   * the index, also in the order of summation.
    */
   double phasespace_dens(const ThreeVector &r, const ThreeVector &p,
                          const std::vector<Particles> &ensembles,
                          const PdgCode pdg,
                          const ParticleList &disregard) const;
 
+  /**
+   * Sort all baryons into spatial cells per species, such that
+   * phasespace_dens() does not have to loop over all particles. The cells
+   * are large enough for particles that move by up to \p max_drift after
+   * indexing them. The index stays valid while the particles only propagate
+   * by at most that distance and all performed actions are added with
+   * add_to_index().
+   *
+   * \param[in] ensembles Current list of particles in all ensembles.
+   * \param[in] max_drift Maximal distance by which the particles move until
+   *            the index is cleared [fm].
+   * \throw std::invalid_argument if max_drift is negative
+   */
+  void index_particles(const std::vector<Particles> &ensembles,
+                       double max_drift);
+
+  /**
+   * Add the outgoing particles of a performed action to the index. The
+   * incoming particles do not have to be removed, because they are no valid
+   * copies of the particles in the ensemble anymore and are skipped.
+   *
+   * \param[in] i_ensemble Ensemble of the action
+   * \param[in] particles Outgoing particles of the action, as they were
+   *            inserted into the ensemble
+   */
+  void add_to_index(int i_ensemble, const ParticleList &particles);
+
+  /// Stop using the index, e.g. before the particles move further.
+  void clear_index();
+
+  /// \return Whether the particles are indexed
+  bool indexed() const { return indexed_; }
+
  private:
+  /// Particles of one species in one cell of the index, with their ensembles
+  using IndexCell = std::vector<std::pair<int, ParticleData>>;
+
+  /**
+   * Contribution of one particle to the phase-space density, before the
+   * normalization to the number of testparticles and ensembles.
+   *
+   * \param[in] part Particle which might contribute
+   * \param[in] r Position at which the density is evaluated
+   * \param[in] p Momentum at which the density is evaluated
+   * \param[in] disregard Particles that do not contribute
+   * \return Weight of the particle, or 0 if it is out of range
+   */
+  double weight(const ParticleData &part, const ThreeVector &r,
+                const ThreeVector &p, const ParticleList &disregard) const;
+
+  /**
+   * \param[in] ix Index of the cell in x direction
+   * \param[in] iy Index of the cell in y direction
+   * \param[in] iz Index of the cell in z direction
+   * \return Key of the cell in the index
+   */
+  static std::int64_t cell_key(std::int64_t ix, std::int64_t iy,
+                               std::int64_t iz);
+
+  /**
+   * \param[in] r Position [fm]
+   * \param[in] i Direction
+   * \return Index of the cell containing r in direction i
+   */
+  std::int64_t cell_coordinate(const ThreeVector &r, int i) const;
+
+  /**
+   * Add a particle to the index.
+   *
+   * \param[in] i_ensemble Ensemble of the particle
+   * \param[in] part Valid copy of the particle in the ensemble
+   */
+  void add_particle_to_index(int i_ensemble, const ParticleData &part);
+
   /// Tabulate integrals for weights
   void init_weights();
 
@@ -95,6 +176,15 @@ class PauliBlocker {
 
   /// Weights: tabulated results of numerical integration
   std::array<double, 30> weights_;
+
+  /// Whether the particles are indexed
+  bool indexed_ = false;
+
+  /// Length of the cells of the index, fm
+  double index_cell_length_ = 0.;
+
+  /// Cells of the index for every species
+  std::map<PdgCode, std::unordered_map<std::int64_t, IndexCell>> index_;
 };
 }  // namespace smash
 
@@ -12,14 +12,12 @@
 
 #include "lattice.h"
 #include "potentials.h"
+#include "potentialslattice.h"
 
 namespace smash {
 
-/// Pointer to the skyrme potential on the lattice
-extern RectangularLattice<FourVector> *UB_lat_pointer;
-
-/// Pointer to the symmmetry potential on the lattice
-extern RectangularLattice<FourVector> *UI3_lat_pointer;
+/// Pointer to the lattice of all potentials and forces
+extern PotentialsLattice *potentials_lat_pointer;
 
 /// Pointer to a Potential class
 extern Potentials *pot_pointer;
@@ -17,6 +17,7 @@
 #include "configuration.h"
 #include "density.h"
 #include "forwarddeclarations.h"
+#include "particlecells.h"
 #include "particledata.h"
 #include "threevector.h"
 
@@ -288,10 +289,11 @@ class Potentials {
    * Point r is in the computational frame.
    *
    * \param[in] r Arbitrary space point where potential gradient is calculated
-   * \param[in] plist List of all particles to be used in \f$j^{\mu}\f$
-   *            calculation. If the distance between particle and calculation
-   *            point r, \f$ |r-r_i| > r_{cut} \f$ then particle input
-   *            to density will be ignored.
+   * \param[in] cells All particles to be used in \f$j^{\mu}\f$
+   *            calculation, sorted into cells at least as large as
+   *            \f$ r_{cut} \f$. Only the particles in the cells around r
+   *            are summed over, since particles with
+   *            \f$ |r-r_i| > r_{cut} \f$ do not contribute to the density.
    * \return (\f$E_B, B_B, E_{I3}, B_{I3}\f$) [GeV/fm], where
    *          \f$E_B\f$: the electric component of the Skyrme or VDF force,
    *          \f$B_B\f$: the magnetic component of the Skyrme or VDF force,
@@ -299,7 +301,23 @@ class Potentials {
    *          \f$B_{I3}\f$: the magnetic component of the symmetry force
    */
   virtual std::tuple<ThreeVector, ThreeVector, ThreeVector, ThreeVector>
-  all_forces(const ThreeVector &r, const ParticleList &plist) const;
+  all_forces(const ThreeVector &r, const ParticleCells &cells) const;
+
+  /**
+   * Convenience overload of the above, which sorts the particles into cells
+   * first. To evaluate the forces at many points, the cells should be
+   * constructed only once instead.
+   *
+   * \param[in] r Arbitrary space point where potential gradient is calculated
+   * \param[in] plist List of all particles to be used in \f$j^{\mu}\f$
+   *            calculation
+   * \return The forces as above
+   */
+  std::tuple<ThreeVector, ThreeVector, ThreeVector, ThreeVector> all_forces(
+      const ThreeVector &r, const ParticleList &plist) const;
+
+  /// \return Cutoff radius of the smearing kernel of the densities in fm
+  double smearing_cutoff() const { return param_.r_cut(); }
 
   /// \return Is Skyrme potential on?
   virtual bool use_skyrme() const { return use_skyrme_; }
@@ -330,6 +348,8 @@ class Potentials {
 
   /// \return cutoff radius in ntegration for coulomb potential in fm
   double coulomb_r_cut() const { return coulomb_r_cut_; }
+  /// \return Whether the Coulomb fields are computed with Fourier transforms
+  bool use_coulomb_fft() const { return coulomb_fft_; }
 
  private:
   /**
@@ -388,6 +408,9 @@ class Potentials {
   /// Cutoff in integration for coulomb potential
   double coulomb_r_cut_;
 
+  /// Whether the Coulomb fields are computed with Fourier transforms
+  bool coulomb_fft_ = false;
+
   /**
    * Saturation density of nuclear matter used in the VDF potential; it may
    * vary between different parameterizations.
@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#ifndef SRC_INCLUDE_SMASH_POTENTIALSLATTICE_H_
+#define SRC_INCLUDE_SMASH_POTENTIALSLATTICE_H_
+
+#include <array>
+#include <utility>
+
+#include "fourvector.h"
+#include "lattice.h"
+#include "threevector.h"
+
+namespace smash {
+
+/**
+ * All potentials and forces at a lattice node, which a particle needs for its
+ * equations of motion and for the energies of its interactions.
+ *
+ * Storing them together means a single lookup per particle, instead of one
+ * lookup into each of the separate lattices of potentials and forces.
+ */
+struct PotentialsOnLattice {
+  /// Skyrme or VDF potential \f$U_B^\mu\f$ in GeV
+  FourVector UB;
+  /// Symmetry potential \f$U_{I_3}^\mu\f$ in GeV
+  FourVector UI3;
+  /// Electric and magnetic components of the Skyrme or VDF force in GeV/fm
+  std::pair<ThreeVector, ThreeVector> FB;
+  /// Electric and magnetic components of the symmetry force in GeV/fm
+  std::pair<ThreeVector, ThreeVector> FI3;
+  /// Electric and magnetic fields in fm\f$^{-2}\f$
+  std::pair<ThreeVector, ThreeVector> EM;
+
+  /**
+   * Add the values of another node, as needed for the interpolation.
+   *
+   * \param[in] other Values to add
+   * \return Reference to the sum
+   */
+  PotentialsOnLattice &operator+=(const PotentialsOnLattice &other) {
+    UB += other.UB;
+    UI3 += other.UI3;
+    FB.first += other.FB.first;
+    FB.second += other.FB.second;
+    FI3.first += other.FI3.first;
+    FI3.second += other.FI3.second;
+    EM.first += other.EM.first;
+    EM.second += other.EM.second;
+    return *this;
+  }
+};
+
+/**
+ * Multiply all values of a node by a weight.
+ *
+ * \param[in] a Values at the node
+ * \param[in] w Weight
+ * \return The weighted values
+ */
+inline PotentialsOnLattice operator*(PotentialsOnLattice a, double w) {
+  a.UB *= w;
+  a.UI3 *= w;
+  a.FB.first *= w;
+  a.FB.second *= w;
+  a.FI3.first *= w;
+  a.FI3.second *= w;
+  a.EM.first *= w;
+  a.EM.second *= w;
+  return a;
+}
+
+/**
+ * Lattice of all potentials and forces with a fused lookup.
+ *
+ * The potentials and forces of the Skyrme, symmetry and VDF potentials are
+ * written directly into the nodes of this lattice. The electric and magnetic
+ * fields are computed on a separate lattice, which the Coulomb solver, the
+ * mean field energy and the fields output need in their own layout. Only
+ * they are copied here, whenever they are updated, which costs one more pair
+ * of three-vectors per node. Particles then look up everything they need with
+ * a single call of at(), either from the cell containing them or
+ * interpolated trilinearly between the cell centers. The latter gives forces
+ * that are continuous in space.
+ */
+class PotentialsLattice : public RectangularLattice<PotentialsOnLattice> {
+ public:
+  /**
+   * Constructs a lattice of potentials.
+   *
+   * \param[in] l 3-dimensional array (lx,ly,lz) indicates the size of
+   *            the lattice in x, y, z directions respectively [fm].
+   * \param[in] n 3-dimensional array (nx,ny,nz) indicates the number of
+   *            cells of the lattice in x, y, z directions respectively.
+   * \param[in] origin A 3-dimensional array indicating the coordinates of the
+   *            origin [fm].
+   * \param[in] periodic Whether the lattice has periodic boundary conditions
+   * \param[in] trilinear Whether at() interpolates trilinearly
+   */
+  PotentialsLattice(const std::array<double, 3> &l,
+                    const std::array<int, 3> &n,
+                    const std::array<double, 3> &origin, bool periodic,
+                    bool trilinear)
+      : RectangularLattice<PotentialsOnLattice>(l, n, origin, periodic,
+                                                LatticeUpdate::EveryTimestep),
+        trilinear_(trilinear) {}
+
+  /**
+   * Look up all potentials and forces at a point.
+   *
+   * \param[in] r Position in fm
+   * \param[out] value Potentials and forces at r, or zeros if r is out of
+   *             the lattice
+   * \return Whether r is on the lattice
+   */
+  bool at(const ThreeVector &r, PotentialsOnLattice &value) {
+    return trilinear_ ? interpolate_at(r, value) : value_at(r, value);
+  }
+
+  /// \return Whether at() interpolates trilinearly
+  bool trilinear() const { return trilinear_; }
+
+  /**
+   * Copy the electric and magnetic fields from their own lattice, which has
+   * to consist of the same nodes as this lattice.
+   *
+   * \param[in] EM_lat Lattice of the electric and magnetic fields
+   * \throw std::invalid_argument if the lattice has a different number of
+   *        nodes
+   */
+  void set_fields(
+      const RectangularLattice<std::pair<ThreeVector, ThreeVector>> &EM_lat);
+
+ private:
+  /// Whether at() interpolates trilinearly
+  bool trilinear_;
+};
+
+}  // namespace smash
+
+#endif  // SRC_INCLUDE_SMASH_POTENTIALSLATTICE_H_
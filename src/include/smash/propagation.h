@@ -14,6 +14,7 @@
 #include "lattice.h"
 #include "particles.h"
 #include "potentials.h"
+#include "potentialslattice.h"
 
 namespace smash {
 
@@ -92,6 +93,10 @@ void expand_space_time(Particles *particles,
  *
  * \f[ \frac{dp}{dt} = \vec E + \vec v \times \vec B \f]
  *
+ * The forces on all particles are computed before any momentum is changed.
+ * For particles outside of the lattices, the densities are summed over the
+ * nearby particles of all ensembles (see ParticleCells).
+ *
  * \param[out] particles The particle list in the event
  * \param[in] dt timestep
  * \param[in] pot The potentials in the system
@@ -100,12 +105,30 @@ void expand_space_time(Particles *particles,
  * \param[in] FI3_lat Lattice for the electric and magnetic
  *            components of the symmetry force
  * \param[in] EM_lat Lattice for the electric and magnetic field
+ * \param[in] n_threads Number of threads computing the forces
  */
 void update_momenta(
     std::vector<Particles> &particles, double dt, const Potentials &pot,
     RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FB_lat,
     RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FI3_lat,
-    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *EM_lat);
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *EM_lat,
+    int n_threads = 1);
+
+/**
+ * Updates the momenta of all particles like the above, but reads the forces
+ * and fields with a single lookup per particle from the lattice of all
+ * potentials. Depending on the lattice, the forces are interpolated
+ * trilinearly.
+ *
+ * \param[out] particles The particle list in the event
+ * \param[in] dt timestep
+ * \param[in] pot The potentials in the system
+ * \param[in] pot_lat Lattice of all potentials and forces, or nullptr
+ * \param[in] n_threads Number of threads computing the forces
+ */
+void update_momenta(std::vector<Particles> &particles, double dt,
+                    const Potentials &pot, PotentialsLattice *pot_lat,
+                    int n_threads = 1);
 
 }  // namespace smash
 #endif  // SRC_INCLUDE_SMASH_PROPAGATION_H_
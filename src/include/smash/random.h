@@ -26,8 +26,11 @@ namespace random {
 /// The random number engine used is the Mersenne Twister.
 using Engine = std::mt19937_64;
 
-/// The engine that is used commonly by all distributions.
-extern /*thread_local (see #3075)*/ Engine engine;
+/**
+ * The engine that is used commonly by all distributions. Every thread has its
+ * own engine, a new thread starts with a default-seeded one.
+ */
+extern thread_local Engine engine;
 
 /** Provides uniform random numbers on a fixed interval.
  *
@@ -157,6 +157,28 @@ class ScatterAction : public Action {
                            NNbarTreatment nnbar_treatment, double scale_xs,
                            double additional_el_xs);
 
+  /**
+   * Add the elastic and 2->1 scattering subprocesses for this action object.
+   *
+   * This is equivalent to add_all_scatterings, if no other binary reactions
+   * are enabled, but only takes a precomputed list of resonances into
+   * account.
+   *
+   * \param[in] elastic_parameter If non-zero, given global
+   *            elastic cross section.
+   * \param[in] include_elastic Are elastic reactions enabled?
+   * \param[in] low_snn_cut Elastic collisions with CME below are forbidden.
+   * \param[in] use_AQM use elastic cross sections via AQM?
+   * \param[in] resonances Resonances that can be formed by the incoming
+   *            particles, see CrossSections::resonance_formation_table.
+   * \param[in] scale_xs Factor by which all (partial) cross sections are scaled
+   * \param[in] additional_el_xs Additional constant elastic cross section
+   */
+  void add_elastic_and_resonance_scatterings(
+      double elastic_parameter, bool include_elastic, double low_snn_cut,
+      bool use_AQM, const ParticleTypePtrList& resonances, double scale_xs,
+      double additional_el_xs);
+
   /**
    * Get list of possible collision channels.
    *
@@ -12,6 +12,7 @@
 
 #include <utility>
 
+#include "crosssectionsphoton.h"
 #include "scatteraction.h"
 
 namespace smash {
@@ -261,6 +262,23 @@ class ScatterActionPhoton : public ScatterAction {
    */
   double total_cross_section(MediatorType mediator = default_mediator_) const;
 
+  /**
+   * Evaluate the total cross section of the photon process with the given
+   * computation method. The tabulated cross sections are used whenever they
+   * were created, see CrosssectionsPhoton<ComputationMethod::Lookup>.
+   *
+   * \tparam method Whether to evaluate the analytic formulas or to look up
+   *                the tabulated values.
+   * \param[in] mediator Switch for determing which mediating particle to use
+   * \param[in] s Mandelstam-s [GeV^2]
+   * \param[in] m_rho Mass of the incoming or outgoing rho-particle [GeV]
+   *
+   * \return Total cross section. [mb]
+   */
+  template <ComputationMethod method>
+  double total_cross_section_from(MediatorType mediator, const double s,
+                                  const double m_rho) const;
+
   /**
    * Compute the total cross corrected for form factors.
    *
@@ -286,6 +304,23 @@ class ScatterActionPhoton : public ScatterAction {
   double diff_cross_section(const double t, const double m_rho,
                             MediatorType mediator = default_mediator_) const;
 
+  /**
+   * Evaluate the differential cross section of the photon process with the
+   * given computation method, see total_cross_section_from().
+   *
+   * \tparam method Whether to evaluate the analytic formulas or to look up
+   *                the tabulated values.
+   * \param[in] mediator Switch for determing which mediating particle to use
+   * \param[in] s Mandelstam-s [GeV^2]
+   * \param[in] t Mandelstam-t [GeV^2]
+   * \param[in] m_rho Mass of the incoming or outgoing rho-particle [GeV]
+   *
+   * \return Differential cross section. [mb/\f$GeV^2\f$]
+   */
+  template <ComputationMethod method>
+  double diff_cross_section_from(MediatorType mediator, const double s,
+                                 const double t, const double m_rho) const;
+
   /**
    * Compute the differential cross section corrected for form factors
    *
@@ -256,12 +256,12 @@ class ScatterActionsFinder : public ActionFinderInterface {
                            std::vector<double> &plab) const;
 
   /**
-   * \return Pointer to the string process class object.
+   * \return Pointer to the pool of string process objects.
    *         If string is turned off, the null pointer is returned.
    */
-  StringProcess *get_process_string_ptr() {
+  StringProcessPool *get_process_string_ptr() {
     if (strings_switch_) {
-      return string_process_interface_.get();
+      return string_process_pool_.get();
     } else {
       return NULL;
     }
@@ -313,8 +313,17 @@ class ScatterActionsFinder : public ActionFinderInterface {
   ActionPtr check_collision_multi_part(const ParticleList &plist, double dt,
                                        const double gcell_vol) const;
 
-  /// Class that deals with strings, interfacing Pythia.
-  std::unique_ptr<StringProcess> string_process_interface_;
+  /**
+   * \param[in] a Type of the first incoming particle
+   * \param[in] b Type of the second incoming particle
+   * \return The resonances that can be formed by a and b in a 2->1 reaction,
+   *         an empty list if 2->1 reactions are disabled.
+   */
+  const ParticleTypePtrList &formable_resonances(const ParticleType &a,
+                                                 const ParticleType &b) const;
+
+  /// Classes that deal with strings, interfacing Pythia, one per worker.
+  std::unique_ptr<StringProcessPool> string_process_pool_;
   /// Specifies which collision criterion is used
   const CollisionCriterion coll_crit_;
   /// Elastic cross section parameter (in mb).
@@ -364,6 +373,18 @@ class ScatterActionsFinder : public ActionFinderInterface {
    * over 1.
    */
   const bool only_warn_for_high_prob_;
+  /**
+   * Whether elastic and 2->1 reactions are the only enabled binary
+   * reactions, in which case the cross sections are computed by a reduced
+   * kernel that only considers the resonances in resonance_table_.
+   */
+  const bool elastic_and_resonances_only_;
+  /**
+   * Resonances that can be formed by each pair of particle types, see
+   * CrossSections::resonance_formation_table. Only filled if
+   * elastic_and_resonances_only_ and 2->1 reactions are enabled.
+   */
+  std::vector<ParticleTypePtrList> resonance_table_;
 };
 
 }  // namespace smash
@@ -10,6 +10,7 @@
 #ifndef SRC_INCLUDE_SMASH_STRINGPROCESS_H_
 #define SRC_INCLUDE_SMASH_STRINGPROCESS_H_
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,9 +19,11 @@
 
 #include "Pythia8/Pythia.h"
 
+#include "chrono.h"
 #include "constants.h"
 #include "logging.h"
 #include "particledata.h"
+#include "random.h"
 
 namespace smash {
 static constexpr int LPythia = LogArea::Pythia::id;
@@ -28,7 +31,9 @@ static constexpr int LPythia = LogArea::Pythia::id;
 /**
  * \brief String excitation processes used in SMASH
  *
- * Only one instance of this class should be created.
+ * An instance must not be used by several threads at the same time. Threads
+ * performing string processes in parallel each get their own instance from a
+ * StringProcessPool.
  *
  * This class implements string excitation processes based on the UrQMD model
  * \iref{Bass:1998ca}, \iref{Bleicher:1999xi} and subsequent fragmentation
@@ -180,6 +185,9 @@ class StringProcess {
   /// Map object to contain the different pythia objects
   pythia_map hard_map_;
 
+  /// Real time spent in initializing PYTHIA objects
+  SystemTimeSpan pythia_init_time_ = SystemTimeSpan::zero();
+
   /// PYTHIA object used in fragmentation
   std::unique_ptr<Pythia8::Pythia> pythia_hadron_;
 
@@ -289,14 +297,39 @@ class StringProcess {
   void init_pythia_hadron_rndm() {
     const int seed_new =
         random::uniform_int(1, maximum_rndm_seed_in_pythia);
+    init_pythia_hadron_rndm(seed_new);
+  }
 
-    pythia_hadron_->rndm.init(seed_new);
+  /**
+   * Set the PYTHIA random seed to the given value.
+   *
+   * \param[in] seed Random seed, between 1 and maximum_rndm_seed_in_pythia
+   */
+  void init_pythia_hadron_rndm(int seed) {
+    pythia_hadron_->rndm.init(seed);
     logg[LPythia].debug("pythia_hadron_ : rndm is initialized with seed ",
-                        seed_new);
+                        seed);
   }
 
   // clang-format on
 
+  /**
+   * Initialize the PYTHIA objects of the hard string routine for the given
+   * hadron pairs in advance, instead of on their first use in a collision.
+   * Both orderings of each pair are initialized, since either particle can
+   * come first in a collision. The hadrons are mapped as in the hard string
+   * routine, see pdg_map_for_pythia, so pairs that map onto the same PYTHIA
+   * beams share one object.
+   *
+   * \param[in] pairs Hadron pairs, for which PYTHIA is initialized
+   * \param[in] sqrts Center-of-mass energy used for the initialization [GeV]
+   */
+  void preinitialize_hard_pythia(
+      const std::vector<std::pair<PdgCode, PdgCode>> &pairs, double sqrts);
+
+  /// \return Real time spent so far in initializing PYTHIA objects
+  SystemTimeSpan pythia_init_time() const { return pythia_init_time_; }
+
   /**
    * Interface to pythia_sigmatot_ to compute cross-sections of A+B->
    * different final states \iref{Schuler:1993wr}.
@@ -475,6 +508,18 @@ class StringProcess {
    * \return whether the process is successfully implemented.
    */
   bool next_NDiffHard();
+
+  /**
+   * Get the PYTHIA object of the hard string routine for the given beams,
+   * and create and initialize it, if it does not exist yet.
+   *
+   * \param[in] idAB PDG ids of the beams, as mapped by pdg_map_for_pythia
+   * \param[in] sqrts Center-of-mass energy used for the initialization [GeV]
+   * \return PYTHIA object for the hard string routine
+   *
+   * \throw std::runtime_error if PYTHIA fails to initialize
+   */
+  Pythia8::Pythia *hard_pythia(std::pair<int, int> idAB, double sqrts);
   /**
    * Baryon-antibaryon annihilation process
    * Based on what UrQMD \iref{Bass:1998ca}, \iref{Bleicher:1999xi} does,
@@ -1234,6 +1279,133 @@ class StringProcess {
   // clang-format on
 };
 
+/**
+ * \brief StringProcess objects and random engines for the workers of a
+ * parallel loop.
+ *
+ * A StringProcess object holds PYTHIA instances and the state of the current
+ * string process, so it cannot be shared between threads. The pool keeps one
+ * object for every worker index, which is created by the given factory when
+ * the worker first asks for it. The objects belong to the pool and not to
+ * threads, so a loop that starts new threads every time reuses them, and at
+ * most one object per worker is ever created.
+ *
+ * Worker 0 is the thread that starts the parallel loop. It keeps its own
+ * random engine, so that a single-threaded run is not affected by the pool.
+ * Every further worker has its own random engine, which replaces the one of
+ * the executing thread within a WorkerScope. All engines and PYTHIA seeds of
+ * the workers are derived from a common seed drawn at the start of each
+ * event.
+ *
+ * Outside of a WorkerScope, a thread acts as worker 0. Every worker index may
+ * only be used by one thread at a time, and an action has to be performed by
+ * the worker that found it, since it keeps a pointer to the object of that
+ * worker.
+ */
+class StringProcessPool {
+ public:
+  /// Function creating a new, fully set up StringProcess object
+  using Factory = std::function<std::unique_ptr<StringProcess>()>;
+
+  /**
+   * Construct the pool and the object of worker 0.
+   *
+   * \param[in] factory Function creating a new StringProcess object
+   * \param[in] n_workers Largest number of workers
+   * \throw std::invalid_argument if n_workers is smaller than 1
+   */
+  StringProcessPool(Factory factory, int n_workers);
+
+  /**
+   * Lets the calling thread act as a worker of the pool until the scope is
+   * left.
+   */
+  class WorkerScope {
+   public:
+    /**
+     * Enter the scope of a worker.
+     *
+     * \param[in] pool Pool of the worker
+     * \param[in] worker Index of the worker
+     * \throw std::out_of_range if the pool has no such worker
+     */
+    WorkerScope(StringProcessPool &pool, int worker);
+    /// Leave the scope and restore the random engine of the thread.
+    ~WorkerScope();
+    /// Cannot be copied
+    WorkerScope(const WorkerScope &) = delete;
+    /// Cannot be copied
+    WorkerScope &operator=(const WorkerScope &) = delete;
+
+   private:
+    /// Pool of the worker
+    StringProcessPool &pool_;
+    /// Index of the worker
+    int worker_;
+    /// Worker index of the thread before entering the scope
+    int previous_worker_;
+  };
+
+  /**
+   * \return The StringProcess object of the worker of the calling thread,
+   *         which is created if the worker did not request one before.
+   */
+  StringProcess *get();
+
+  /// \return Largest number of workers
+  int n_workers() const { return static_cast<int>(workers_.size()); }
+
+  /**
+   * \return Number of StringProcess objects created so far. Must not be
+   *         called during a parallel loop.
+   */
+  int size() const;
+
+  /**
+   * Draw a new common seed from the random engine of the calling thread and
+   * reseed the PYTHIA objects and random engines of all workers. Must not be
+   * called during a parallel loop.
+   *
+   * \see StringProcess::init_pythia_hadron_rndm
+   */
+  void init_pythia_hadron_rndm();
+
+  /**
+   * \return Real time spent in initializing the PYTHIA objects of all
+   *         workers. Must not be called during a parallel loop.
+   */
+  SystemTimeSpan pythia_init_time() const;
+
+ private:
+  /// Everything a worker keeps between parallel loops
+  struct Worker {
+    /// String process object, created on first use
+    std::unique_ptr<StringProcess> process;
+    /// Random engine, unused for worker 0
+    random::Engine engine;
+  };
+
+  /**
+   * Reseed the PYTHIA object of a worker with a seed derived from the common
+   * seed.
+   *
+   * \param[in] worker Index of the worker
+   */
+  void seed_process(int worker);
+
+  /// Function creating new StringProcess objects
+  Factory factory_;
+
+  /// Objects and engines of the workers
+  std::vector<Worker> workers_;
+
+  /// Common seed of the current event
+  int common_seed_ = 1;
+
+  /// Worker index of the calling thread
+  static thread_local int current_worker_;
+};
+
 }  // namespace smash
 
 #endif  // SRC_INCLUDE_SMASH_STRINGPROCESS_H_
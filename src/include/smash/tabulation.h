@@ -8,10 +8,12 @@
 #ifndef SRC_INCLUDE_SMASH_TABULATION_H_
 #define SRC_INCLUDE_SMASH_TABULATION_H_
 
+#include <array>
 #include <fstream>
 #include <functional>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "forwarddeclarations.h"
@@ -63,8 +65,9 @@ class Tabulation {
    *
    * \param stream Stream containing the binary representation of the
    * tabulation. \param hash Hash corresponding to the particle properties for
-   * which the tabulation was created. \returns (true, tabulation) if the given
-   * hash matches the one given by the stream, (false, empty) otherwise.
+   * which the tabulation was created. \returns The tabulation if the given
+   * hash matches the one given by the stream and the stream holds a complete
+   * tabulation with at least two intervals, an empty tabulation otherwise.
    */
   static Tabulation from_file(std::ifstream& stream, sha256::Hash hash);
 
@@ -119,6 +122,179 @@ class Tabulation {
   double inv_dx_;
 };
 
+/**
+ * A class for storing a two- or three-dimensional lookup table of
+ * floating-point values on a uniform grid.
+ *
+ * The values are interpolated bi- or trilinearly. Arguments outside of the
+ * tabulated domain are clamped to its boundary, callers that need a different
+ * behavior can check the domain with contains().
+ *
+ * \tparam T Type in which the tabulated values are stored (double or float).
+ * The interpolation itself is always done in double precision.
+ */
+template <typename T>
+class BasicGridTabulation {
+ public:
+  /// A uniformly spaced axis of the grid.
+  struct Axis {
+    /// lower bound of the axis
+    double min;
+    /// upper bound of the axis
+    double max;
+    /// number of intervals (the number of tabulated points is num+1)
+    size_t num;
+  };
+
+  /**
+   * Construct an empty tabulation object.
+   */
+  BasicGridTabulation() : dims_(0), min_{}, max_{}, inv_d_{}, n_{} {}
+
+  /**
+   * Construct a new two-dimensional tabulation object.
+   *
+   * \param x first axis of the tabulation domain
+   * \param y second axis of the tabulation domain
+   * \param f two-dimensional function f(x, y) which is supposed to be
+   * tabulated
+   * \throws if less than two intervals are tabulated along any axis.
+   */
+  BasicGridTabulation(const Axis& x, const Axis& y,
+                      std::function<double(double, double)> f);
+
+  /**
+   * Construct a new three-dimensional tabulation object.
+   *
+   * \param x first axis of the tabulation domain
+   * \param y second axis of the tabulation domain
+   * \param z third axis of the tabulation domain
+   * \param f three-dimensional function f(x, y, z) which is supposed to be
+   * tabulated
+   * \throws if less than two intervals are tabulated along any axis.
+   */
+  BasicGridTabulation(const Axis& x, const Axis& y, const Axis& z,
+                      std::function<double(double, double, double)> f);
+
+  /**
+   * \returns whether the tabulation is empty.
+   */
+  bool is_empty() const { return values_.empty(); }
+
+  /// \returns whether (x, y) lies within a two-dimensional tabulation.
+  bool contains(double x, double y) const {
+    return x >= min_[0] && x <= max_[0] && y >= min_[1] && y <= max_[1];
+  }
+
+  /// \returns whether (x, y, z) lies within a three-dimensional tabulation.
+  bool contains(double x, double y, double z) const {
+    return contains(x, y) && z >= min_[2] && z <= max_[2];
+  }
+
+  /**
+   * Look up a value from a two-dimensional tabulation using bilinear
+   * interpolation.
+   *
+   * \param x First argument to the tabulated function.
+   * \param y Second argument to the tabulated function.
+   * \return Tabulated value using bilinear interpolation.
+   */
+  double get_value_linear(double x, double y) const;
+
+  /**
+   * Look up a value from a three-dimensional tabulation using trilinear
+   * interpolation.
+   *
+   * \param x First argument to the tabulated function.
+   * \param y Second argument to the tabulated function.
+   * \param z Third argument to the tabulated function.
+   * \return Tabulated value using trilinear interpolation.
+   */
+  double get_value_linear(double x, double y, double z) const;
+
+  /**
+   * Write a binary representation of the tabulation to a stream.
+   *
+   * \param stream Stream to which the binary representation is written.
+   * \param hash Hash corresponding to the properties for which the tabulation
+   *             was created.
+   */
+  void write(std::ofstream& stream, sha256::Hash hash) const;
+
+  /**
+   * Construct a tabulation object by reading binary data from a stream.
+   *
+   * \param stream Stream containing the binary representation of the
+   * tabulation.
+   * \param hash Hash corresponding to the properties for which the tabulation
+   * was created.
+   * \returns The tabulation if the given hash matches the one given by the
+   * stream and the stream holds a complete tabulation with at least two
+   * intervals along each axis, an empty tabulation otherwise.
+   */
+  static BasicGridTabulation from_file(std::ifstream& stream,
+                                       sha256::Hash hash);
+
+ private:
+  /**
+   * Find the lower grid index along an axis and the relative position of the
+   * argument within the grid cell.
+   *
+   * \param[in] axis Index of the axis.
+   * \param[in] x Argument along the axis, clamped to the tabulated domain.
+   * \param[out] r Relative position within the cell, between 0 and 1.
+   * \return Lower index of the cell.
+   */
+  size_t locate(size_t axis, double x, double& r) const;
+
+  /// Fill the axis properties, throws if an axis is too short.
+  void set_axis(size_t axis, const Axis& a);
+
+  /// number of dimensions (2 or 3), 0 for an empty tabulation
+  size_t dims_;
+
+  /// lower bounds of the axes
+  std::array<double, 3> min_;
+
+  /// upper bounds of the axes
+  std::array<double, 3> max_;
+
+  /// inverse step sizes of the axes
+  std::array<double, 3> inv_d_;
+
+  /// number of tabulated points along the axes (1 for unused axes)
+  std::array<size_t, 3> n_;
+
+  /// tabulated values, with the last axis running fastest
+  std::vector<T> values_;
+};
+
+/// Grid tabulation storing its values in double precision.
+using GridTabulation = BasicGridTabulation<double>;
+
+/// Grid tabulation storing its values in single precision, for large tables.
+using FloatGridTabulation = BasicGridTabulation<float>;
+
+/**
+ * Read a tabulation from a cache directory or create it, if there is no valid
+ * one there. A created tabulation is stored in the directory, replacing an
+ * outdated, truncated or corrupt one.
+ *
+ * \tparam T Type of the tabulation (Tabulation or GridTabulation).
+ * \param[in] dir Directory of the cached tabulations. If it is empty, the
+ *            tabulation is always created and not stored.
+ * \param[in] file_name Name of the cached tabulation within the directory.
+ * \param[in] hash Hash to validate the cached tabulation.
+ * \param[in] create Function creating the tabulation.
+ * \param[out] created Set to true if the tabulation had to be created, left
+ *             unchanged otherwise. May be nullptr.
+ * \return The tabulation.
+ */
+template <typename T>
+T cache_tabulation(const boost::filesystem::path& dir,
+                   const std::string& file_name, sha256::Hash hash,
+                   const std::function<T()>& create, bool* created = nullptr);
+
 /**
  * Spectral function integrand for GSL integration, with one resonance in the
  * final state (the second particle is stable).
@@ -10,9 +10,12 @@
 #ifndef SRC_INCLUDE_SMASH_VTKOUTPUT_H_
 #define SRC_INCLUDE_SMASH_VTKOUTPUT_H_
 
+#include <cstdio>
+#include <ios>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 
@@ -26,6 +29,9 @@ namespace smash {
 /**
  * \ingroup output
  * SMASH output in a paraview format, intended for simple visualization.
+ *
+ * The legacy VTK files are either written as text or, for large lattices,
+ * with the data in binary form, see \ref format_vtk.
  */
 class VtkOutput : public OutputInterface {
  public:
@@ -35,9 +41,10 @@ class VtkOutput : public OutputInterface {
    * \param path Path to the output file.
    * \param name Name of the output.
    * \param out_par Additional information on the configured output.
+   * \param binary Write the data in binary instead of text form.
    */
   VtkOutput(const bf::path &path, const std::string &name,
-            const OutputParameters &out_par);
+            const OutputParameters &out_par, bool binary = false);
   ~VtkOutput();
 
   /**
@@ -121,6 +128,19 @@ class VtkOutput : public OutputInterface {
    */
   void write(const Particles &particles);
 
+  /**
+   * Write one section of binary data for the given particles, followed by a
+   * newline.
+   *
+   * \param file Output file.
+   * \param particles The particles.
+   * \param append_values Function that appends the values of a particle to
+   *                      buffer_.
+   */
+  template <typename F>
+  void write_binary_section(std::FILE *file, const Particles &particles,
+                            F &&append_values);
+
   /**
    * Make a file name given a description and a counter.
    *
@@ -138,6 +158,11 @@ class VtkOutput : public OutputInterface {
   std::string make_varname(const ThermodynamicQuantity tq,
                            const DensityType dens_type);
 
+  /// \return Mode in which the lattice files are opened
+  std::ios::openmode file_mode() const {
+    return binary_ ? std::ios::out | std::ios::binary : std::ios::out;
+  }
+
   /**
    * Write the VTK header.
    *
@@ -197,6 +222,10 @@ class VtkOutput : public OutputInterface {
   bool is_thermodynamics_output_;
   /// Is the VTK output an output for fields
   bool is_fields_output_;
+  /// Is the data written in binary form
+  const bool binary_;
+  /// Binary data of the current section, reused between sections
+  std::vector<char> buffer_;
 };
 
 }  // namespace smash
@@ -217,47 +217,23 @@ static std::unordered_map<std::string, Tabulation> DeltaR_tabulations;
  */
 static std::unordered_map<std::string, Tabulation> rhoR_tabulations;
 
-static bf::path generate_tabulation_path(const bf::path &dir,
-                                         const std::string &prefix,
-                                         const std::string &res_name) {
-  return dir / (prefix + res_name + ".bin");
-}
-
 inline void cache_integral(
     std::unordered_map<std::string, Tabulation> &tabulations,
     const bf::path &dir, sha256::Hash hash, const IsoParticleType &part,
     const IsoParticleType &res, const IsoParticleType *antires, bool unstable) {
   constexpr double spacing = 2.0;
   constexpr double spacing2d = 3.0;
-  const auto path = generate_tabulation_path(dir, part.name_filtered_prime(),
-                                             res.name_filtered_prime());
-  Tabulation integral;
-  if (!dir.empty() && bf::exists(path)) {
-    std::ifstream file(path.string());
-    integral = Tabulation::from_file(file, hash);
-    if (!integral.is_empty()) {
-      // Only print message if the found tabulation was valid.
-      std::cout << "Tabulation found at " << path.filename() << '\r'
-                << std::flush;
-    }
-  }
-  if (integral.is_empty()) {
-    if (!dir.empty()) {
-      std::cout << "Caching tabulation to " << path.filename() << '\r'
-                << std::flush;
-    }
-    if (!unstable) {
-      integral = spectral_integral_semistable(integrate, *res.get_states()[0],
-                                              *part.get_states()[0], spacing);
-    } else {
-      integral = spectral_integral_unstable(integrate2d, *res.get_states()[0],
+  const Tabulation integral = cache_tabulation<Tabulation>(
+      dir, part.name_filtered_prime() + res.name_filtered_prime() + ".bin",
+      hash, [&]() {
+        if (!unstable) {
+          return spectral_integral_semistable(
+              integrate, *res.get_states()[0], *part.get_states()[0], spacing);
+        } else {
+          return spectral_integral_unstable(integrate2d, *res.get_states()[0],
                                             *part.get_states()[0], spacing2d);
-    }
-    if (!dir.empty()) {
-      std::ofstream file(path.string());
-      integral.write(file, hash);
-    }
-  }
+        }
+      });
   tabulations.emplace(std::make_pair(res.name(), integral));
   if (antires != nullptr) {
     tabulations.emplace(std::make_pair(antires->name(), integral));
@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/latticewindow.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "smash/lattice.h"
+#include "smash/particles.h"
+
+namespace smash {
+
+namespace {
+/// \return Whether the potentials act on the particle
+bool feels_potentials(const ParticleData &data) {
+  return data.is_baryon() || data.is_nucleus();
+}
+}  // unnamed namespace
+
+LatticeWindow::LatticeWindow(const std::array<double, 3> &origin,
+                             const std::array<double, 3> &cell_sizes,
+                             const std::array<int, 3> &n_cells,
+                             const std::array<int, 3> &max_n_cells,
+                             double margin, int update_interval,
+                             double occupancy_range)
+    : grid_origin_(origin),
+      cell_sizes_(cell_sizes),
+      max_n_cells_(max_n_cells),
+      margin_(margin),
+      update_interval_(update_interval),
+      occupancy_range_(occupancy_range),
+      n_cells_(n_cells) {
+  if (margin < 0.) {
+    throw std::invalid_argument(
+        "The margin of the lattice window must not be negative.");
+  }
+  if (max_n_cells[0] < 1 || max_n_cells[1] < 1 || max_n_cells[2] < 1) {
+    throw std::invalid_argument(
+        "The maximal number of cells of the lattice window must be positive.");
+  }
+  if (update_interval < 1) {
+    throw std::invalid_argument(
+        "The update interval of the lattice window must be positive.");
+  }
+  reset_occupancy();
+}
+
+bool LatticeWindow::follow(const std::vector<Particles> &ensembles) {
+  if (n_calls_++ % update_interval_ != 0) {
+    return false;
+  }
+  std::array<double, 3> lower, upper, sum = {{0., 0., 0.}};
+  lower.fill(std::numeric_limits<double>::infinity());
+  upper.fill(-std::numeric_limits<double>::infinity());
+  int n_found = 0;
+  for (const Particles &particles : ensembles) {
+    for (const ParticleData &data : particles) {
+      if (!feels_potentials(data)) {
+        continue;
+      }
+      const ThreeVector r = data.position().threevec();
+      for (int i = 0; i < 3; i++) {
+        lower[i] = std::min(lower[i], r[i]);
+        upper[i] = std::max(upper[i], r[i]);
+        sum[i] += r[i];
+      }
+      n_found++;
+    }
+  }
+  if (n_found == 0) {
+    return false;
+  }
+
+  std::array<int, 3> first, n;
+  for (int i = 0; i < 3; i++) {
+    const double lowest = std::floor(
+        (lower[i] - margin_ - grid_origin_[i]) / cell_sizes_[i]);
+    const double highest =
+        std::ceil((upper[i] + margin_ - grid_origin_[i]) / cell_sizes_[i]);
+    if (highest - lowest <= max_n_cells_[i]) {
+      first[i] = static_cast<int>(lowest);
+      n[i] = std::max(1, static_cast<int>(highest - lowest));
+    } else {
+      const int center = static_cast<int>(std::floor(
+          (sum[i] / n_found - grid_origin_[i]) / cell_sizes_[i]));
+      first[i] = center - max_n_cells_[i] / 2;
+      n[i] = max_n_cells_[i];
+      logg[LLattice].debug("Lattice window clamped to ", n[i],
+                           " cells in direction ", i);
+    }
+  }
+  if (first == offset_ && n == n_cells_) {
+    return false;
+  }
+  for (int i = 0; i < 3; i++) {
+    shift_[i] = first[i] - offset_[i];
+  }
+  offset_ = first;
+  n_cells_ = n;
+  reset_occupancy();
+  const std::array<double, 3> o = origin();
+  logg[LLattice].debug("Lattice window moved: dims = (", n_cells_[0], ",",
+                       n_cells_[1], ",", n_cells_[2], "), origin = (", o[0],
+                       ",", o[1], ",", o[2], ")");
+  return true;
+}
+
+std::array<double, 3> LatticeWindow::origin() const {
+  return {grid_origin_[0] + offset_[0] * cell_sizes_[0],
+          grid_origin_[1] + offset_[1] * cell_sizes_[1],
+          grid_origin_[2] + offset_[2] * cell_sizes_[2]};
+}
+
+void LatticeWindow::update_occupancy(const std::vector<Particles> &ensembles) {
+  const std::array<double, 3> o = origin();
+  std::vector<bool> current(occupied_.size(), false);
+  for (const Particles &particles : ensembles) {
+    for (const ParticleData &data : particles) {
+      if (!feels_potentials(data)) {
+        continue;
+      }
+      const ThreeVector r = data.position().threevec();
+      // Range of tiles containing cells within the occupancy range
+      std::array<int, 3> begin, end;
+      bool inside = true;
+      for (int i = 0; i < 3; i++) {
+        const int lowest_cell = static_cast<int>(
+            std::floor((r[i] - occupancy_range_ - o[i]) / cell_sizes_[i]));
+        const int highest_cell = static_cast<int>(
+            std::floor((r[i] + occupancy_range_ - o[i]) / cell_sizes_[i]));
+        if (highest_cell < 0 || lowest_cell >= n_cells_[i]) {
+          inside = false;
+          break;
+        }
+        begin[i] = std::max(lowest_cell, 0) / tile_size;
+        end[i] = std::min(highest_cell, n_cells_[i] - 1) / tile_size + 1;
+      }
+      if (!inside) {
+        continue;
+      }
+      for (int tz = begin[2]; tz < end[2]; tz++) {
+        for (int ty = begin[1]; ty < end[1]; ty++) {
+          for (int tx = begin[0]; tx < end[0]; tx++) {
+            current[tx + n_tiles_[0] * (ty + n_tiles_[1] * tz)] = true;
+          }
+        }
+      }
+    }
+  }
+  for (size_t tile = 0; tile < occupied_.size(); tile++) {
+    occupied_[tile] = current[tile] || previous_[tile];
+  }
+  previous_.swap(current);
+}
+
+void LatticeWindow::reset_occupancy() {
+  for (int i = 0; i < 3; i++) {
+    n_tiles_[i] = (n_cells_[i] + tile_size - 1) / tile_size;
+  }
+  const size_t n_tiles =
+      static_cast<size_t>(n_tiles_[0]) * n_tiles_[1] * n_tiles_[2];
+  occupied_.assign(n_tiles, true);
+  previous_.assign(n_tiles, true);
+}
+
+}  // namespace smash
@@ -16,6 +16,7 @@
 #include <list>
 #include <map>
 #include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -24,8 +25,10 @@
 
 #include "smash/algorithms.h"
 #include "smash/boxmodus.h"
+#include "smash/compression.h"
 #include "smash/configuration.h"
 #include "smash/constants.h"
+#include "smash/cxx14compat.h"
 #include "smash/experimentparameters.h"
 #include "smash/fourvector.h"
 #include "smash/inputfunctions.h"
@@ -42,7 +45,8 @@ static constexpr int LList = LogArea::List::id;
  * The list modus provides a modus for hydro afterburner calculations. It takes
  * files with a list of particles in \ref oscar2013_format "Oscar 2013 format"
  * as an input. These particles are treated as a starting setup. Multiple events
- * per file are supported. The input
+ * per file are supported. The files may also be compressed, as written with the
+ * \ref output_compression_ "compressed output". The input
  * parameters are:
  *
  * \key File_Directory (string, required):\n
@@ -54,6 +58,13 @@ static constexpr int LList = LogArea::List::id;
  * \key Shift_Id (int, required):\n
  * Starting id for file_id_, i.e. the first file which is read.
  *
+ * \key Columnar_File (string, optional):\n
+ * Path of a file written by the \ref format_columnar_ "columnar output", from
+ * which the events are read instead of the external particle lists. Then
+ * \key File_Directory and \key File_Prefix are not needed, and \key Shift_Id
+ * is the position of the first event in the file (starting at 0). The event
+ * is found through the index of the file, without reading the events before.
+ *
  * \n
  * **Example: Configuring an Afterburner Simulation**\n
  * The following example sets up an afterburner simulation for a set of particle
@@ -138,11 +149,18 @@ static constexpr int LList = LogArea::List::id;
 ListModus::ListModus(Configuration modus_config,
                      const ExperimentParameters &param)
     : shift_id_(modus_config.take({"List", "Shift_Id"})) {
-  std::string fd = modus_config.take({"List", "File_Directory"});
-  particle_list_file_directory_ = fd;
+  if (modus_config.has_value({"List", "Columnar_File"})) {
+    const std::string file = modus_config.take({"List", "Columnar_File"});
+    columnar_file_ = make_unique<ColumnarFileReader>(file);
+    logg[LList].info() << "Reading " << columnar_file_->n_events()
+                       << " events from " << file;
+  } else {
+    std::string fd = modus_config.take({"List", "File_Directory"});
+    particle_list_file_directory_ = fd;
 
-  std::string fp = modus_config.take({"List", "File_Prefix"});
-  particle_list_file_prefix_ = fp;
+    std::string fp = modus_config.take({"List", "File_Prefix"});
+    particle_list_file_prefix_ = fp;
+  }
 
   event_id_ = 0;
   file_id_ = shift_id_;
@@ -153,6 +171,22 @@ ListModus::ListModus(Configuration modus_config,
 }
 
 /* console output on startup of List specific parameters */
+namespace {
+/**
+ * Check that the charge given in a particle list matches the PDG code.
+ *
+ * \param[in] pdgcode PDG code of the particle
+ * \param[in] charge Charge given in the particle list
+ * \throw std::invalid_argument if the charges differ
+ */
+void check_charge(PdgCode pdgcode, int charge) {
+  if (pdgcode.charge() != charge) {
+    logg[LList].error() << "Charge of pdg = " << pdgcode << " != " << charge;
+    throw std::invalid_argument("Inconsistent input (charge).");
+  }
+}
+}  // unnamed namespace
+
 std::ostream &operator<<(std::ostream &out, const ListModus &m) {
   out << "-- List Modus\nInput directory for external particle lists:\n"
       << m.particle_list_file_directory_ << "\n";
@@ -253,7 +287,12 @@ void ListModus::try_create_particle(Particles &particles, PdgCode pdgcode,
 /* initial_conditions - sets particle data for @particles */
 double ListModus::initial_conditions(Particles *particles,
                                      const ExperimentParameters &) {
-  std::string particle_list = next_event_();
+  std::string particle_list;
+  if (columnar_file_) {
+    read_columnar_event_(*particles);
+  } else {
+    particle_list = next_event_();
+  }
   for (const Line &line : line_parser(particle_list)) {
     std::istringstream lineinput(line.text);
     double t, x, y, z, mass, E, px, py, pz;
@@ -272,11 +311,7 @@ double ListModus::initial_conditions(Particles *particles,
     logg[LList].debug("Particle ", pdgcode, " (x,y,z)= (", x, ", ", y, ", ", z,
                       ")");
 
-    // Charge consistency check
-    if (pdgcode.charge() != charge) {
-      logg[LList].error() << "Charge of pdg = " << pdgcode << " != " << charge;
-      throw std::invalid_argument("Inconsistent input (charge).");
-    }
+    check_charge(pdgcode, charge);
     try_create_particle(*particles, pdgcode, t, x, y, z, mass, E, px, py, pz);
   }
   if (particles->size() > 0) {
@@ -317,17 +352,16 @@ bf::path ListModus::file_path_(const int file_id) {
 
 std::string ListModus::next_event_() {
   const bf::path fpath = file_path_(file_id_);
-  bf::ifstream ifs{fpath};
-  ifs.seekg(last_read_position_);
-
   if (!file_has_events_(fpath, last_read_position_)) {
     // current file out of events. get next file and call this function
     // recursively.
     file_id_++;
     last_read_position_ = 0;
-    ifs.close();
     return next_event_();
   }
+  std::unique_ptr<std::istream> file = open_particle_list_(fpath);
+  std::istream &ifs = *file;
+  ifs.seekg(last_read_position_);
 
   // read one event. events marked by line # event end i in case of Oscar
   // output. Assume one event per file for all other output formats
@@ -348,14 +382,54 @@ std::string ListModus::next_event_() {
   }
   // save position for next event read
   last_read_position_ = ifs.tellg();
-  ifs.close();
 
   return event_string;
 }
 
+std::unique_ptr<std::istream> ListModus::open_particle_list_(
+    const bf::path &filepath) {
+  std::unique_ptr<CompressionCodec> codec = detect_compression_codec(filepath);
+  if (!codec) {
+    return make_unique<bf::ifstream>(filepath);
+  }
+  if (filepath != decompressed_path_) {
+    decompressed_list_ =
+        make_unique<FrameDecompressor>(filepath, std::move(codec));
+    decompressed_path_ = filepath;
+  }
+  return make_unique<std::istream>(decompressed_list_.get());
+}
+
+void ListModus::read_columnar_event_(Particles &particles) {
+  if (file_id_ < 0 ||
+      static_cast<std::size_t>(file_id_) >= columnar_file_->n_events()) {
+    throw std::runtime_error("The columnar file has no event at position " +
+                             std::to_string(file_id_) + ".");
+  }
+  const std::size_t i_event = file_id_++;
+  const ConstSpan<double> r =
+      columnar_file_->double_column(i_event, ColumnarColumn::Position);
+  const ConstSpan<double> p =
+      columnar_file_->double_column(i_event, ColumnarColumn::Momentum);
+  const ConstSpan<double> mass =
+      columnar_file_->double_column(i_event, ColumnarColumn::Mass);
+  const ConstSpan<std::int32_t> pdg =
+      columnar_file_->int_column(i_event, ColumnarColumn::Pdg);
+  const ConstSpan<std::int32_t> charge =
+      columnar_file_->int_column(i_event, ColumnarColumn::Charge);
+  for (std::size_t i = 0; i < pdg.size(); i++) {
+    const PdgCode pdgcode = PdgCode::from_decimal(pdg[i]);
+    check_charge(pdgcode, charge[i]);
+    try_create_particle(particles, pdgcode, r[4 * i], r[4 * i + 1],
+                        r[4 * i + 2], r[4 * i + 3], mass[i], p[4 * i],
+                        p[4 * i + 1], p[4 * i + 2], p[4 * i + 3]);
+  }
+}
+
 bool ListModus::file_has_events_(bf::path filepath,
                                  std::streampos last_position) {
-  bf::ifstream ifs{filepath};
+  std::unique_ptr<std::istream> file = open_particle_list_(filepath);
+  std::istream &ifs = *file;
   std::string line;
 
   // last event read read at end of file. we know this because errors are
@@ -382,7 +456,6 @@ bool ListModus::file_has_events_(bf::path filepath,
     throw std::runtime_error("Error while reading external particle list");
   }
 
-  ifs.close();
   return true;
 }
 
@@ -9,12 +9,16 @@
 
 #include "smash/oscaroutput.h"
 
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 
 #include "smash/action.h"
+#include "smash/asciiformat.h"
 #include "smash/clock.h"
+#include "smash/compression.h"
 #include "smash/config.h"
 #include "smash/cxx14compat.h"
 #include "smash/forwarddeclarations.h"
@@ -22,13 +26,144 @@
 namespace smash {
 static constexpr int LHyperSurfaceCrossing = LogArea::HyperSurfaceCrossing::id;
 
+namespace {
+/// Name and unit of a column of the OSCAR2013 formats
+struct OscarColumn {
+  /// Name in the header
+  const char *name;
+  /// Unit in the header
+  const char *unit;
+};
+
+/// Columns of the OSCAR2013 format, followed by those of the extended format
+constexpr OscarColumn oscar2013_columns[] = {
+    {"t", "fm"},
+    {"x", "fm"},
+    {"y", "fm"},
+    {"z", "fm"},
+    {"mass", "GeV"},
+    {"p0", "GeV"},
+    {"px", "GeV"},
+    {"py", "GeV"},
+    {"pz", "GeV"},
+    {"pdg", "none"},
+    {"ID", "none"},
+    {"charge", "e"},
+    {"ncoll", "none"},
+    {"form_time", "fm"},
+    {"xsecfac", "none"},
+    {"proc_id_origin", "none"},
+    {"proc_type_origin", "none"},
+    {"time_last_coll", "fm"},
+    {"pdg_mother1", "none"},
+    {"pdg_mother2", "none"}};
+
+/// Number of columns of the OSCAR2013 format, which are not extended
+constexpr int n_oscar2013_columns = 12;
+
+/// Number of columns of the extended OSCAR2013 format
+constexpr int n_oscar2013_extended_columns =
+    sizeof(oscar2013_columns) / sizeof(oscar2013_columns[0]);
+
+/**
+ * Find the columns selected by the output filter.
+ *
+ * \param[in] names Names of the selected columns
+ * \param[in] extended Whether the format is extended
+ * \return Indices of the columns in oscar2013_columns
+ * \throw std::invalid_argument if a column does not exist in the format
+ */
+std::vector<int> find_oscar2013_columns(const std::vector<std::string> &names,
+                                        bool extended) {
+  const int n_columns =
+      extended ? n_oscar2013_extended_columns : n_oscar2013_columns;
+  std::vector<int> columns;
+  for (const std::string &name : names) {
+    int c = 0;
+    while (c < n_columns && name != oscar2013_columns[c].name) {
+      c++;
+    }
+    if (c == n_columns) {
+      throw std::invalid_argument(
+          "The Oscar2013 " + std::string(extended ? "extended " : "") +
+          "format has no column \"" + name + "\" to be written.");
+    }
+    columns.push_back(c);
+  }
+  return columns;
+}
+
+/**
+ * Append one column of a particle to its line.
+ *
+ * \param[in] line Line of the particle
+ * \param[in] column Index of the column in oscar2013_columns
+ * \param[in] data Data of the particle
+ */
+void write_oscar2013_column(AsciiLine &line, int column,
+                            const ParticleData &data) {
+  switch (column) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      line.general(data.position()[column]);
+      break;
+    case 4:
+      line.general(data.effective_mass());
+      break;
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+      line.general(data.momentum()[column - 5], 9);
+      break;
+    case 9:
+      line.string(data.pdgcode().string().c_str());
+      break;
+    case 10:
+      line.integer(data.id());
+      break;
+    case 11:
+      line.integer(data.type().charge());
+      break;
+    case 12:
+      line.integer(data.get_history().collisions_per_particle);
+      break;
+    case 13:
+      line.general(data.formation_time());
+      break;
+    case 14:
+      line.general(data.xsec_scaling_factor());
+      break;
+    case 15:
+      line.integer(data.get_history().id_process);
+      break;
+    case 16:
+      line.integer(static_cast<int>(data.get_history().process_type));
+      break;
+    case 17:
+      line.general(data.get_history().time_last_collision);
+      break;
+    case 18:
+      line.string(data.get_history().p1.string().c_str());
+      break;
+    case 19:
+      line.string(data.get_history().p2.string().c_str());
+      break;
+  }
+}
+}  // unnamed namespace
+
 template <OscarOutputFormat Format, int Contents>
 OscarOutput<Format, Contents>::OscarOutput(const bf::path &path,
-                                           const std::string &name)
+                                           const std::string &name,
+                                           const OutputParameters &out_par)
     : OutputInterface(name),
+      buffer_(new char[buffer_size_]),
       file_{path /
                 (name + ".oscar" + ((Format == OscarFormat1999) ? "1999" : "")),
-            "w"} {
+            "w", create_compression_codec(out_par.compression)} {
   /*!\Userguide
    * \page oscar_general_ OSCAR Block Structure
    * OSCAR outputs are a family of ASCII and binary formats that follow
@@ -78,7 +213,29 @@ OscarOutput<Format, Contents>::OscarOutput(const bf::path &path,
    * The collisions output contains all collisions / decays / box wall crossings
    * and optionally the initial and final configuration.
    */
-  if (Format == OscarFormat2013) {
+  std::setvbuf(file_.get(), buffer_.get(), _IOFBF, buffer_size_);
+  const OutputFilter *filter =
+      name == "particle_lists"
+          ? out_par.get_filter("Particles")
+          : name == "full_event_history" ? out_par.get_filter("Collisions")
+                                         : nullptr;
+  if (Format != OscarFormat1999 && filter && !filter->columns().empty()) {
+    columns_ = find_oscar2013_columns(filter->columns(),
+                                      Format == OscarFormat2013Extended);
+  }
+  if (!columns_.empty()) {
+    std::fprintf(file_.get(), "#!OSCAR2013%s %s",
+                 Format == OscarFormat2013Extended ? "Extended" : "",
+                 name.c_str());
+    for (int c : columns_) {
+      std::fprintf(file_.get(), " %s", oscar2013_columns[c].name);
+    }
+    std::fprintf(file_.get(), "\n# Units:");
+    for (int c : columns_) {
+      std::fprintf(file_.get(), " %s", oscar2013_columns[c].unit);
+    }
+    std::fprintf(file_.get(), "\n# %s\n", VERSION_MAJOR);
+  } else if (Format == OscarFormat2013) {
     std::fprintf(file_.get(),
                  "#!OSCAR2013 %s t x y z mass "
                  "p0 px py pz pdg ID charge\n",
@@ -180,7 +337,7 @@ void OscarOutput<Format, Contents>::at_eventend(const Particles &particles,
                  event.impact_parameter);
   }
   // Flush to disk
-  std::fflush(file_.get());
+  file_.flush();
 
   if (Contents & OscarParticlesIC) {
     // If the runtime is too short some particles might not yet have
@@ -194,31 +351,37 @@ void OscarOutput<Format, Contents>::at_eventend(const Particles &particles,
   }
 }
 
+template <OscarOutputFormat Format, int Contents>
+void OscarOutput<Format, Contents>::write_interaction_header(
+    std::size_t n_in, std::size_t n_out, double density, double weight,
+    double partial_weight, ProcessType type) {
+  if (Format == OscarFormat2013 || Format == OscarFormat2013Extended) {
+    std::fprintf(file_.get(),
+                 "# interaction in %zu out %zu rho %12.7f weight %12.7g"
+                 " partial %12.7f type %5i\n",
+                 n_in, n_out, density, weight, partial_weight,
+                 static_cast<int>(type));
+  } else {
+    /* OSCAR line prefix : initial final
+     * particle creation: 0 1
+     * particle 2<->2 collision: 2 2
+     * resonance formation: 2 1
+     * resonance decay: 1 2
+     * etc.*/
+    std::fprintf(file_.get(), "%zu %zu %12.7f %12.7f %12.7f %5i\n", n_in,
+                 n_out, density, weight, partial_weight,
+                 static_cast<int>(type));
+  }
+}
+
 template <OscarOutputFormat Format, int Contents>
 void OscarOutput<Format, Contents>::at_interaction(const Action &action,
                                                    const double density) {
   if (Contents & OscarInteractions) {
-    if (Format == OscarFormat2013 || Format == OscarFormat2013Extended) {
-      std::fprintf(file_.get(),
-                   "# interaction in %zu out %zu rho %12.7f weight %12.7g"
-                   " partial %12.7f type %5i\n",
-                   action.incoming_particles().size(),
-                   action.outgoing_particles().size(), density,
-                   action.get_total_weight(), action.get_partial_weight(),
-                   static_cast<int>(action.get_type()));
-    } else {
-      /* OSCAR line prefix : initial final
-       * particle creation: 0 1
-       * particle 2<->2 collision: 2 2
-       * resonance formation: 2 1
-       * resonance decay: 1 2
-       * etc.*/
-      std::fprintf(file_.get(), "%zu %zu %12.7f %12.7f %12.7f %5i\n",
-                   action.incoming_particles().size(),
-                   action.outgoing_particles().size(), density,
-                   action.get_total_weight(), action.get_partial_weight(),
-                   static_cast<int>(action.get_type()));
-    }
+    write_interaction_header(action.incoming_particles().size(),
+                             action.outgoing_particles().size(), density,
+                             action.get_total_weight(),
+                             action.get_partial_weight(), action.get_type());
     for (const auto &p : action.incoming_particles()) {
       write_particledata(p);
     }
@@ -232,6 +395,22 @@ void OscarOutput<Format, Contents>::at_interaction(const Action &action,
   }
 }
 
+template <OscarOutputFormat Format, int Contents>
+void OscarOutput<Format, Contents>::at_dilepton_decays(
+    const std::vector<DileptonDecay> &decays) {
+  if (!(Contents & OscarInteractions)) {
+    return;
+  }
+  for (const DileptonDecay &decay : decays) {
+    write_interaction_header(1, decay.products.size(), 0., decay.weight,
+                             decay.partial_width, ProcessType::Decay);
+    write_particledata(decay.parent);
+    for (const auto &p : decay.products) {
+      write_particledata(p);
+    }
+  }
+}
+
 template <OscarOutputFormat Format, int Contents>
 void OscarOutput<Format, Contents>::at_intermediate_time(
     const Particles &particles, const std::unique_ptr<Clock> &,
@@ -706,30 +885,53 @@ void OscarOutput<Format, Contents>::write_particledata(
     const ParticleData &data) {
   const FourVector pos = data.position();
   const FourVector mom = data.momentum();
-  if (Format == OscarFormat2013) {
-    std::fprintf(file_.get(), "%g %g %g %g %g %.9g %.9g %.9g %.9g %s %i %i\n",
-                 pos.x0(), pos.x1(), pos.x2(), pos.x3(), data.effective_mass(),
-                 mom.x0(), mom.x1(), mom.x2(), mom.x3(),
-                 data.pdgcode().string().c_str(), data.id(),
-                 data.type().charge());
-  } else if (Format == OscarFormat2013Extended) {
-    const auto h = data.get_history();
-    std::fprintf(
-        file_.get(),
-        "%g %g %g %g %g %.9g %.9g %.9g"
-        " %.9g %s %i %i %i %g %g %i %i %g %s %s\n",
-        pos.x0(), pos.x1(), pos.x2(), pos.x3(), data.effective_mass(), mom.x0(),
-        mom.x1(), mom.x2(), mom.x3(), data.pdgcode().string().c_str(),
-        data.id(), data.type().charge(), h.collisions_per_particle,
-        data.formation_time(), data.xsec_scaling_factor(), h.id_process,
-        static_cast<int>(h.process_type), h.time_last_collision,
-        h.p1.string().c_str(), h.p2.string().c_str());
+  AsciiLine line;
+  if (!columns_.empty()) {
+    for (int c : columns_) {
+      write_oscar2013_column(line, c, data);
+    }
+  } else if (Format == OscarFormat2013 || Format == OscarFormat2013Extended) {
+    // "%g %g %g %g %g %.9g %.9g %.9g %.9g %s %i %i"
+    line.general(pos.x0())
+        .general(pos.x1())
+        .general(pos.x2())
+        .general(pos.x3())
+        .general(data.effective_mass())
+        .general(mom.x0(), 9)
+        .general(mom.x1(), 9)
+        .general(mom.x2(), 9)
+        .general(mom.x3(), 9)
+        .string(data.pdgcode().string().c_str())
+        .integer(data.id())
+        .integer(data.type().charge());
+    if (Format == OscarFormat2013Extended) {
+      // " %i %g %g %i %i %g %s %s"
+      const auto h = data.get_history();
+      line.integer(h.collisions_per_particle)
+          .general(data.formation_time())
+          .general(data.xsec_scaling_factor())
+          .integer(h.id_process)
+          .integer(static_cast<int>(h.process_type))
+          .general(h.time_last_collision)
+          .string(h.p1.string().c_str())
+          .string(h.p2.string().c_str());
+    }
   } else {
-    std::fprintf(file_.get(), "%i %s %i %g %g %g %g %g %g %g %g %g\n",
-                 data.id(), data.pdgcode().string().c_str(), 0, mom.x1(),
-                 mom.x2(), mom.x3(), mom.x0(), data.effective_mass(), pos.x1(),
-                 pos.x2(), pos.x3(), pos.x0());
+    // "%i %s %i %g %g %g %g %g %g %g %g %g"
+    line.integer(data.id())
+        .string(data.pdgcode().string().c_str())
+        .integer(0)
+        .general(mom.x1())
+        .general(mom.x2())
+        .general(mom.x3())
+        .general(mom.x0())
+        .general(data.effective_mass())
+        .general(pos.x1())
+        .general(pos.x2())
+        .general(pos.x3())
+        .general(pos.x0());
   }
+  line.write(file_.get());
 }
 
 namespace {
@@ -751,17 +953,20 @@ std::unique_ptr<OutputInterface> create_select_format(
   bool extended_format = (Contents & OscarInteractions) ? out_par.coll_extended
                                                         : out_par.part_extended;
   if (modern_format && extended_format) {
-    return make_unique<OscarOutput<OscarFormat2013Extended, Contents>>(path,
-                                                                       name);
+    return make_unique<OscarOutput<OscarFormat2013Extended, Contents>>(
+        path, name, out_par);
   } else if (modern_format && !extended_format) {
-    return make_unique<OscarOutput<OscarFormat2013, Contents>>(path, name);
+    return make_unique<OscarOutput<OscarFormat2013, Contents>>(path, name,
+                                                               out_par);
   } else if (!modern_format && !extended_format) {
-    return make_unique<OscarOutput<OscarFormat1999, Contents>>(path, name);
+    return make_unique<OscarOutput<OscarFormat1999, Contents>>(path, name,
+                                                               out_par);
   } else {
     // Only remaining possibility: (!modern_format && extended_format)
     logg[LOutput].warn() << "Creating Oscar output: "
                          << "There is no extended Oscar1999 format.";
-    return make_unique<OscarOutput<OscarFormat1999, Contents>>(path, name);
+    return make_unique<OscarOutput<OscarFormat1999, Contents>>(path, name,
+                                                               out_par);
   }
 }
 }  // unnamed namespace
@@ -798,14 +1003,14 @@ std::unique_ptr<OutputInterface> create_oscar_output(
   } else if (content == "Dileptons") {
     if (modern_format && out_par.dil_extended) {
       return make_unique<
-          OscarOutput<OscarFormat2013Extended, OscarInteractions>>(path,
-                                                                   "Dileptons");
+          OscarOutput<OscarFormat2013Extended, OscarInteractions>>(
+          path, "Dileptons", out_par);
     } else if (modern_format && !out_par.dil_extended) {
       return make_unique<OscarOutput<OscarFormat2013, OscarInteractions>>(
-          path, "Dileptons");
+          path, "Dileptons", out_par);
     } else if (!modern_format && !out_par.dil_extended) {
       return make_unique<OscarOutput<OscarFormat1999, OscarInteractions>>(
-          path, "Dileptons");
+          path, "Dileptons", out_par);
     } else if (!modern_format && out_par.dil_extended) {
       logg[LOutput].warn()
           << "Creating Oscar output: "
@@ -814,14 +1019,14 @@ std::unique_ptr<OutputInterface> create_oscar_output(
   } else if (content == "Photons") {
     if (modern_format && !out_par.photons_extended) {
       return make_unique<OscarOutput<OscarFormat2013, OscarInteractions>>(
-          path, "Photons");
+          path, "Photons", out_par);
     } else if (modern_format && out_par.photons_extended) {
       return make_unique<
-          OscarOutput<OscarFormat2013Extended, OscarInteractions>>(path,
-                                                                   "Photons");
+          OscarOutput<OscarFormat2013Extended, OscarInteractions>>(
+          path, "Photons", out_par);
     } else if (!modern_format && !out_par.photons_extended) {
       return make_unique<OscarOutput<OscarFormat1999, OscarInteractions>>(
-          path, "Photons");
+          path, "Photons", out_par);
     } else if (!modern_format && out_par.photons_extended) {
       logg[LOutput].warn()
           << "Creating Oscar output: "
@@ -831,15 +1036,15 @@ std::unique_ptr<OutputInterface> create_oscar_output(
     if (modern_format && !out_par.ic_extended) {
       return make_unique<
           OscarOutput<OscarFormat2013, OscarParticlesIC | OscarAtEventstart>>(
-          path, "SMASH_IC");
+          path, "SMASH_IC", out_par);
     } else if (modern_format && out_par.ic_extended) {
       return make_unique<OscarOutput<OscarFormat2013Extended,
                                      OscarParticlesIC | OscarAtEventstart>>(
-          path, "SMASH_IC");
+          path, "SMASH_IC", out_par);
     } else if (!modern_format && !out_par.ic_extended) {
       return make_unique<
           OscarOutput<OscarFormat1999, OscarParticlesIC | OscarAtEventstart>>(
-          path, "SMASH_IC");
+          path, "SMASH_IC", out_par);
     } else if (!modern_format && out_par.ic_extended) {
       logg[LOutput].warn()
           << "Creating Oscar output: "
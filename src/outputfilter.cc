@@ -0,0 +1,234 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/outputfilter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "smash/action.h"
+#include "smash/asyncoutput.h"
+#include "smash/cxx14compat.h"
+#include "smash/particles.h"
+
+namespace smash {
+
+/*!\Userguide
+ * \page output_filter_ Output Filter
+ * The \key Filter section of the \key Particles and \key Collisions contents
+ * restricts their outputs to the particles that pass all given cuts. The
+ * other particles are removed before the output is formatted, so they take
+ * no time to write and no disk space. In the collisions output, every
+ * interaction is written with its accepted incoming and outgoing particles,
+ * and interactions without any accepted particle are left out. The header
+ * lines of the particle lists give the number of accepted particles.
+ *
+ * \key PDG (list of PDG codes, optional, default = all particles): \n
+ * Only particles with one of these PDG codes are written. Antiparticles have
+ * to be listed separately.
+ *
+ * \key Only_Charged (bool, optional, default = false): \n
+ * Only electrically charged particles are written.
+ *
+ * \key Only_Hadrons (bool, optional, default = false): \n
+ * Only hadrons are written.
+ *
+ * \key Rapidity_Cut (double, optional, no default): \n
+ * Only particles with a momentum space rapidity \f$|y|\f$ below this value
+ * are written.
+ *
+ * \key Transverse_Momentum_Range (list of two doubles, optional, no
+ * default): \n
+ * Only particles with a transverse momentum \f$p_T\f$ in the given range
+ * [GeV] are written, including the lower and excluding the upper bound.
+ *
+ * \key Columns (list of strings, optional, default = all columns): \n
+ * Only these columns are written, in the given order. This is supported by
+ * the "Oscar2013" format, whose column names are given in
+ * \ref format_oscar_particlelist. The extended columns need
+ * \key Extended: True. Other formats write all of their columns. A particle
+ * list with only some of the columns cannot be read by the list modus.
+ *
+ * For example, only charged hadrons with \f$|y| < 1\f$ are written with
+ * their momenta and PDG codes by
+ *\verbatim
+ Output:
+     Particles:
+         Format: ["Oscar2013"]
+         Filter:
+             Only_Charged: True
+             Only_Hadrons: True
+             Rapidity_Cut: 1.0
+             Columns: ["p0", "px", "py", "pz", "pdg"]
+ \endverbatim
+ */
+
+OutputFilter::OutputFilter(Configuration conf) {
+  if (conf.has_value({"PDG"})) {
+    pdg_codes_ = conf.take({"PDG"}).convert_for(pdg_codes_);
+    if (pdg_codes_.empty()) {
+      throw std::invalid_argument(
+          "The PDG list of the output filter must not be empty.");
+    }
+    std::sort(pdg_codes_.begin(), pdg_codes_.end());
+  }
+  only_charged_ = conf.take({"Only_Charged"}, false);
+  only_hadrons_ = conf.take({"Only_Hadrons"}, false);
+  if (conf.has_value({"Rapidity_Cut"})) {
+    rapidity_cut_ = conf.take({"Rapidity_Cut"});
+    if (!(rapidity_cut_ > 0.)) {
+      throw std::invalid_argument(
+          "The Rapidity_Cut of the output filter must be positive.");
+    }
+  }
+  if (conf.has_value({"Transverse_Momentum_Range"})) {
+    pt_range_ =
+        conf.take({"Transverse_Momentum_Range"}).convert_for(pt_range_);
+    if (pt_range_[0] < 0. || !(pt_range_[1] > pt_range_[0])) {
+      throw std::invalid_argument(
+          "The Transverse_Momentum_Range of the output filter must be "
+          "[min, max] with 0 <= min < max.");
+    }
+    cut_pt_ = true;
+  }
+  if (conf.has_value({"Columns"})) {
+    columns_ = conf.take({"Columns"}).convert_for(columns_);
+    if (columns_.empty()) {
+      throw std::invalid_argument(
+          "The Columns of the output filter must not be empty.");
+    }
+  }
+  selects_particles_ = !pdg_codes_.empty() || only_charged_ || only_hadrons_ ||
+                       rapidity_cut_ > 0. || cut_pt_;
+}
+
+bool OutputFilter::accepts(const ParticleData &p) const {
+  if (!pdg_codes_.empty() && !std::binary_search(pdg_codes_.begin(),
+                                                 pdg_codes_.end(),
+                                                 p.pdgcode())) {
+    return false;
+  }
+  if (only_charged_ && p.type().charge() == 0) {
+    return false;
+  }
+  if (only_hadrons_ && !p.pdgcode().is_hadron()) {
+    return false;
+  }
+  const FourVector &mom = p.momentum();
+  if (rapidity_cut_ > 0.) {
+    const double y =
+        0.5 * std::log((mom.x0() + mom.x3()) / (mom.x0() - mom.x3()));
+    if (!(std::abs(y) < rapidity_cut_)) {
+      return false;
+    }
+  }
+  if (cut_pt_) {
+    const double pt = std::sqrt(mom.x1() * mom.x1() + mom.x2() * mom.x2());
+    if (pt < pt_range_[0] || pt >= pt_range_[1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+FilteredOutput::FilteredOutput(std::unique_ptr<OutputInterface> output,
+                               OutputFilter filter)
+    : ForwardingOutput(std::move(output)), filter_(std::move(filter)) {}
+
+const Particles &FilteredOutput::filter(const Particles &particles) {
+  is_accepted_.clear();
+  std::size_t n_accepted = 0;
+  for (const ParticleData &p : particles) {
+    is_accepted_.push_back(filter_.accepts(p));
+    n_accepted += is_accepted_.back();
+  }
+  if (n_accepted == particles.size()) {
+    return particles;
+  } else if (n_accepted == 0) {
+    accepted_ = make_unique<Particles>();
+    return *accepted_;
+  }
+  // Removing from a copy keeps the ids and the order of the other particles.
+  accepted_ = particles.clone();
+  auto accepted = is_accepted_.begin();
+  for (const ParticleData &p : particles) {
+    if (!*accepted++) {
+      accepted_->remove(p);
+    }
+  }
+  return *accepted_;
+}
+
+std::size_t FilteredOutput::mark_accepted(const Action &action) {
+  is_accepted_.clear();
+  std::size_t n_accepted = 0;
+  for (const ParticleList *list :
+       {&action.incoming_particles(), &action.outgoing_particles()}) {
+    for (const ParticleData &p : *list) {
+      is_accepted_.push_back(filter_.accepts(p));
+      n_accepted += is_accepted_.back();
+    }
+  }
+  return n_accepted;
+}
+
+std::unique_ptr<Action> FilteredOutput::record_accepted(
+    const Action &action) const {
+  auto accepted = is_accepted_.begin();
+  ParticleList incoming, outgoing;
+  for (const ParticleData &p : action.incoming_particles()) {
+    if (*accepted++) {
+      incoming.push_back(p);
+    }
+  }
+  for (const ParticleData &p : action.outgoing_particles()) {
+    if (*accepted++) {
+      outgoing.push_back(p);
+    }
+  }
+  return make_unique<RecordedAction>(action, incoming, outgoing);
+}
+
+void FilteredOutput::at_eventstart(const Particles &particles,
+                                   const int event_number,
+                                   const EventInfo &info) {
+  output_->at_eventstart(filter(particles), event_number, info);
+}
+
+void FilteredOutput::at_eventend(const Particles &particles,
+                                 const int event_number,
+                                 const EventInfo &info) {
+  output_->at_eventend(filter(particles), event_number, info);
+}
+
+void FilteredOutput::at_interaction(const Action &action,
+                                    const double density) {
+  const std::size_t n_accepted = mark_accepted(action);
+  if (n_accepted == is_accepted_.size()) {
+    output_->at_interaction(action, density);
+  } else if (n_accepted > 0) {
+    output_->at_interaction(*record_accepted(action), density);
+  }
+}
+
+void FilteredOutput::at_dilepton_decays(
+    const std::vector<DileptonDecay> &decays) {
+  // Every decay is filtered like any other action.
+  OutputInterface::at_dilepton_decays(decays);
+}
+
+void FilteredOutput::at_intermediate_time(const Particles &particles,
+                                          const std::unique_ptr<Clock> &clock,
+                                          const DensityParameters &dens_param,
+                                          const EventInfo &info) {
+  output_->at_intermediate_time(filter(particles), clock, dens_param, info);
+}
+
+}  // namespace smash
@@ -0,0 +1,23 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/outputinterface.h"
+
+#include "smash/asyncoutput.h"
+
+namespace smash {
+
+void OutputInterface::at_dilepton_decays(
+    const std::vector<DileptonDecay> &decays) {
+  for (const DileptonDecay &decay : decays) {
+    at_interaction(RecordedAction(decay), 0.);
+  }
+}
+
+}  // namespace smash
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/particlecells.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace smash {
+
+ParticleCells::ParticleCells(const ParticleList &particles,
+                             double min_cell_length) {
+  particles_.reserve(particles.size());
+  for (const ParticleData &p : particles) {
+    particles_.push_back(&p);
+  }
+  sort_into_cells(min_cell_length);
+}
+
+ParticleCells::ParticleCells(const std::vector<Particles> &ensembles,
+                             double min_cell_length) {
+  size_t n = 0;
+  for (const Particles &particles : ensembles) {
+    n += particles.size();
+  }
+  particles_.reserve(n);
+  for (const Particles &particles : ensembles) {
+    for (const ParticleData &p : particles) {
+      particles_.push_back(&p);
+    }
+  }
+  sort_into_cells(min_cell_length);
+}
+
+void ParticleCells::sort_into_cells(double min_cell_length) {
+  if (!(min_cell_length > 0.)) {
+    throw std::invalid_argument("The cell length must be positive.");
+  }
+  cell_length_ = min_cell_length;
+  std::array<double, 3> max_position;
+  min_position_.fill(std::numeric_limits<double>::infinity());
+  max_position.fill(-std::numeric_limits<double>::infinity());
+  for (const ParticleData *p : particles_) {
+    const ThreeVector r = p->position().threevec();
+    for (int i = 0; i < 3; i++) {
+      min_position_[i] = std::min(min_position_[i], r[i]);
+      max_position[i] = std::max(max_position[i], r[i]);
+    }
+  }
+  if (particles_.empty()) {
+    min_position_.fill(0.);
+    cell_begin_.assign(2, 0);
+    return;
+  }
+
+  // Limit the number of cells to the number of particles
+  const double max_cells = static_cast<double>(particles_.size());
+  while (true) {
+    double total = 1.;
+    std::array<double, 3> n;
+    for (int i = 0; i < 3; i++) {
+      n[i] = std::floor((max_position[i] - min_position_[i]) / cell_length_) +
+             1.;
+      total *= n[i];
+    }
+    if (total <= max_cells) {
+      for (int i = 0; i < 3; i++) {
+        n_cells_[i] = static_cast<int>(n[i]);
+      }
+      break;
+    }
+    cell_length_ *= std::max(1.01, std::cbrt(total / max_cells));
+  }
+
+  // Counting sort of the particle indices by cell, which keeps the order of
+  // the list within every cell
+  const int n_total = n_cells_[0] * n_cells_[1] * n_cells_[2];
+  std::vector<int> cell_of_particle(particles_.size());
+  cell_begin_.assign(n_total + 1, 0);
+  for (size_t j = 0; j < particles_.size(); j++) {
+    const ThreeVector r = particles_[j]->position().threevec();
+    std::array<int, 3> c;
+    for (int i = 0; i < 3; i++) {
+      c[i] = std::min(n_cells_[i] - 1,
+                      static_cast<int>((r[i] - min_position_[i]) /
+                                       cell_length_));
+    }
+    cell_of_particle[j] = c[0] + n_cells_[0] * (c[1] + n_cells_[1] * c[2]);
+    cell_begin_[cell_of_particle[j] + 1]++;
+  }
+  for (int cell = 0; cell < n_total; cell++) {
+    cell_begin_[cell + 1] += cell_begin_[cell];
+  }
+  indices_.resize(particles_.size());
+  std::vector<int> fill(cell_begin_.begin(), cell_begin_.end() - 1);
+  for (size_t j = 0; j < particles_.size(); j++) {
+    indices_[fill[cell_of_particle[j]]++] = j;
+  }
+}
+
+std::vector<const ParticleData *> ParticleCells::neighbors(
+    const ThreeVector &r) const {
+  std::array<int, 3> first, last;
+  for (int i = 0; i < 3; i++) {
+    const double c = std::floor((r[i] - min_position_[i]) / cell_length_);
+    if (c < -1. || c > n_cells_[i]) {
+      return {};
+    }
+    first[i] = std::max(0, static_cast<int>(c) - 1);
+    last[i] = std::min(n_cells_[i] - 1, static_cast<int>(c) + 1);
+  }
+  std::vector<int> found;
+  for (int iz = first[2]; iz <= last[2]; iz++) {
+    for (int iy = first[1]; iy <= last[1]; iy++) {
+      const int row = n_cells_[0] * (iy + n_cells_[1] * iz);
+      found.insert(found.end(), indices_.begin() + cell_begin_[row + first[0]],
+                   indices_.begin() + cell_begin_[row + last[0] + 1]);
+    }
+  }
+  std::sort(found.begin(), found.end());
+  std::vector<const ParticleData *> result;
+  result.reserve(found.size());
+  for (const int j : found) {
+    result.push_back(particles_[j]);
+  }
+  return result;
+}
+
+}  // namespace smash
@@ -9,9 +9,12 @@
 
 #include "smash/particles.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 
+#include "smash/cxx14compat.h"
+
 namespace smash {
 
 Particles::Particles() : data_(new ParticleData[data_capacity_]) {
@@ -20,6 +23,17 @@ Particles::Particles() : data_(new ParticleData[data_capacity_]) {
   }
 }
 
+std::unique_ptr<Particles> Particles::clone() const {
+  std::unique_ptr<Particles> copy = make_unique<Particles>();
+  copy->id_max_ = id_max_;
+  copy->data_size_ = data_size_;
+  copy->data_capacity_ = data_capacity_;
+  copy->data_.reset(new ParticleData[data_capacity_]);
+  std::copy(&data_[0], &data_[data_capacity_], &copy->data_[0]);
+  copy->dirty_ = dirty_;
+  return copy;
+}
+
 inline void Particles::ensure_capacity(unsigned to_add) {
   if (data_size_ + to_add >= data_capacity_) {
     increase_capacity((data_capacity_ + to_add) * 2u);
@@ -453,7 +453,7 @@ void ParticleType::check_consistency() {
 
 bool ParticleType::wanted_decaymode(const DecayType &t,
                                     WhichDecaymodes wh) const {
-  const auto FinalTypes = t.particle_types();
+  const auto &FinalTypes = t.particle_types();
   switch (wh) {
     case WhichDecaymodes::All: {
       return true;
@@ -491,42 +491,76 @@ DecayBranchList ParticleType::get_partial_widths(const FourVector p,
       (wh == WhichDecaymodes::Hadronic && is_stable())) {
     return {};
   }
-  /* Determine whether the decay is affected by the potentials. If it's
-   * affected, read the values of the potentials at the position of the
-   * particle */
-  FourVector UB = FourVector();
-  FourVector UI3 = FourVector();
-  if (UB_lat_pointer != nullptr) {
-    UB_lat_pointer->value_at(x, UB);
-  }
-  if (UI3_lat_pointer != nullptr) {
-    UI3_lat_pointer->value_at(x, UI3);
+  std::vector<double> partial_widths(decay_mode_list.size());
+  get_total_width(p, x, wh, partial_widths.data());
+  return get_decay_branches(partial_widths.data());
+}
+
+double ParticleType::get_total_width(const FourVector p, const ThreeVector x,
+                                     WhichDecaymodes wh,
+                                     double *partial_widths) const {
+  const auto &decay_mode_list = decay_modes().decay_mode_list();
+  if (wh == WhichDecaymodes::Hadronic && is_stable()) {
+    std::fill_n(partial_widths, decay_mode_list.size(), 0.);
+    return 0.;
   }
+  /* Determine whether the decay is affected by the potentials. The scale
+   * factors of the final states are stored with the decay types, so only the
+   * one of the mother has to be evaluated here. */
+  std::pair<double, double> scale_mother(0., 0.);
+  if (pot_pointer != nullptr) {
+    const auto scale = pot_pointer->force_scale(*this);
+    scale_mother = {scale.first, scale.second * isospin3_rel()};
+  }
+  /* The values of the potentials at the position of the particle are only
+   * read, once the first decay mode turns out to be affected by them. */
+  bool potentials_read = false;
+  PotentialsOnLattice potentials;
+  const double m = p.abs();
   /* Loop over decay modes and calculate all partial widths. */
-  DecayBranchList partial;
-  partial.reserve(decay_mode_list.size());
+  double width = 0.;
   for (unsigned int i = 0; i < decay_mode_list.size(); i++) {
+    const DecayBranch *mode = decay_mode_list[i].get();
+    partial_widths[i] = 0.;
+    if (!wanted_decaymode(mode->type(), wh)) {
+      continue;
+    }
     /* Calculate the sqare root s of the final state particles. */
-    const auto FinalTypes = decay_mode_list[i]->type().particle_types();
-    double scale_B = 0.0;
-    double scale_I3 = 0.0;
+    double sqrt_s = m;
     if (pot_pointer != nullptr) {
-      scale_B += pot_pointer->force_scale(*this).first;
-      scale_I3 += pot_pointer->force_scale(*this).second * isospin3_rel();
-      for (const auto &finaltype : FinalTypes) {
-        scale_B -= pot_pointer->force_scale(*finaltype).first;
-        scale_I3 -= pot_pointer->force_scale(*finaltype).second *
-                    finaltype->isospin3_rel();
+      const auto &scale_final = mode->type().final_state_force_scale();
+      const double scale_B = scale_mother.first - scale_final.first;
+      const double scale_I3 = scale_mother.second - scale_final.second;
+      if (scale_B != 0. || scale_I3 != 0.) {
+        if (!potentials_read) {
+          if (potentials_lat_pointer != nullptr) {
+            potentials_lat_pointer->at(x, potentials);
+          }
+          potentials_read = true;
+        }
+        sqrt_s = (p + potentials.UB * scale_B + potentials.UI3 * scale_I3)
+                     .abs();
       }
     }
-    double sqrt_s = (p + UB * scale_B + UI3 * scale_I3).abs();
 
-    const double w = partial_width(sqrt_s, decay_mode_list[i].get());
+    const double w = partial_width(sqrt_s, mode);
     if (w > 0.) {
-      if (wanted_decaymode(decay_mode_list[i]->type(), wh)) {
-        partial.push_back(
-            make_unique<DecayBranch>(decay_mode_list[i]->type(), w));
-      }
+      partial_widths[i] = w;
+      width += w;
+    }
+  }
+  return width;
+}
+
+DecayBranchList ParticleType::get_decay_branches(
+    const double *partial_widths) const {
+  const auto &decay_mode_list = decay_modes().decay_mode_list();
+  DecayBranchList partial;
+  partial.reserve(decay_mode_list.size());
+  for (unsigned int i = 0; i < decay_mode_list.size(); i++) {
+    if (partial_widths[i] > 0.) {
+      partial.push_back(make_unique<DecayBranch>(decay_mode_list[i]->type(),
+                                                 partial_widths[i]));
     }
   }
   return partial;
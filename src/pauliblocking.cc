@@ -8,6 +8,10 @@
  */
 
 #include "smash/pauliblocking.h"
+
+#include <algorithm>
+#include <stdexcept>
+
 #include "smash/constants.h"
 #include "smash/logging.h"
 
@@ -72,48 +76,143 @@ double PauliBlocker::phasespace_dens(const ThreeVector &r, const ThreeVector &p,
                                      const ParticleList &disregard) const {
   double f = 0.0;
 
-  /* TODO(oliiny): looping over all particles is inefficient,
-   * I need only particles within rp_ radius in momentum and
-   * within rr_+rc_ in coordinate space. Some search algorithm might help. */
-  for (const Particles &particles : ensembles) {
-    for (const ParticleData &part : particles) {
-      // Only consider identical particles
-      if (part.pdgcode() != pdg) {
-        continue;
-      }
-      // Only consider momenta in sphere of radius rp_ with center at p
-      const double pdist_sqr = (part.momentum().threevec() - p).sqr();
-      if (pdist_sqr > rp_ * rp_) {
-        continue;
-      }
-      const double rdist_sqr = (part.position().threevec() - r).sqr();
-      // Only consider coordinates in sphere of radius rr_+rc_ with center at r
-      if (rdist_sqr >= (rr_ + rc_) * (rr_ + rc_)) {
-        continue;
-      }
-      // Do not count particles that should be disregarded.
-      bool to_disregard = false;
-      for (const auto &disregard_part : disregard) {
-        if (part.id() == disregard_part.id()) {
-          to_disregard = true;
+  if (!indexed_) {
+    for (const Particles &particles : ensembles) {
+      for (const ParticleData &part : particles) {
+        // Only consider identical particles
+        if (part.pdgcode() == pdg) {
+          f += weight(part, r, p, disregard);
+        }
+      }  // loop over particles in one ensemble
+    }    // loop over ensembles
+    return f / ntest_ / n_ensembles_;
+  }
+
+  const auto species = index_.find(pdg);
+  if (species == index_.end()) {
+    return 0.0;
+  }
+  /* Collect the particles of the neighboring cells, which are still in the
+   * ensembles, and sum them up in the order of the ensembles. */
+  std::vector<std::pair<int, const ParticleData *>> candidates;
+  const std::int64_t cx = cell_coordinate(r, 0);
+  const std::int64_t cy = cell_coordinate(r, 1);
+  const std::int64_t cz = cell_coordinate(r, 2);
+  for (std::int64_t ix = cx - 1; ix <= cx + 1; ix++) {
+    for (std::int64_t iy = cy - 1; iy <= cy + 1; iy++) {
+      for (std::int64_t iz = cz - 1; iz <= cz + 1; iz++) {
+        const auto cell = species->second.find(cell_key(ix, iy, iz));
+        if (cell == species->second.end()) {
+          continue;
+        }
+        for (const auto &entry : cell->second) {
+          const Particles &particles = ensembles[entry.first];
+          if (particles.is_valid(entry.second)) {
+            candidates.emplace_back(entry.first,
+                                    &particles.lookup(entry.second));
+          }
         }
       }
-      if (to_disregard) {
-        continue;
-      }
-      // 1st order interpolation using tabulated values
-      const double i_real =
-          std::sqrt(rdist_sqr) / (rr_ + rc_) * weights_.size();
-      const size_t i = std::floor(i_real);
-      const double rest = i_real - i;
-      if (likely(i + 1 < weights_.size())) {
-        f += weights_[i] * rest + weights_[i + 1] * (1. - rest);
-      }
-    }  // loop over particles in one ensemble
-  }    // loop over ensembles
+    }
+  }
+  // Particles crossing a box wall can be in the index twice.
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                   candidates.end());
+  for (const auto &candidate : candidates) {
+    f += weight(*candidate.second, r, p, disregard);
+  }
   return f / ntest_ / n_ensembles_;
 }
 
+double PauliBlocker::weight(const ParticleData &part, const ThreeVector &r,
+                            const ThreeVector &p,
+                            const ParticleList &disregard) const {
+  // Only consider momenta in sphere of radius rp_ with center at p
+  const double pdist_sqr = (part.momentum().threevec() - p).sqr();
+  if (pdist_sqr > rp_ * rp_) {
+    return 0.0;
+  }
+  const double rdist_sqr = (part.position().threevec() - r).sqr();
+  // Only consider coordinates in sphere of radius rr_+rc_ with center at r
+  if (rdist_sqr >= (rr_ + rc_) * (rr_ + rc_)) {
+    return 0.0;
+  }
+  // Do not count particles that should be disregarded.
+  for (const auto &disregard_part : disregard) {
+    if (part.id() == disregard_part.id()) {
+      return 0.0;
+    }
+  }
+  // 1st order interpolation using tabulated values
+  const double i_real = std::sqrt(rdist_sqr) / (rr_ + rc_) * weights_.size();
+  const size_t i = std::floor(i_real);
+  const double rest = i_real - i;
+  if (likely(i + 1 < weights_.size())) {
+    return weights_[i] * rest + weights_[i + 1] * (1. - rest);
+  }
+  return 0.0;
+}
+
+void PauliBlocker::index_particles(const std::vector<Particles> &ensembles,
+                                   double max_drift) {
+  if (max_drift < 0.0) {
+    throw std::invalid_argument(
+        "The drift of the particles in the Pauli blocking index cannot be "
+        "negative.");
+  }
+  clear_index();
+  /* A particle within rr_ + rc_ of a point now was within that distance plus
+   * max_drift when it was indexed, hence in one of the neighboring cells. */
+  index_cell_length_ = rr_ + rc_ + max_drift;
+  indexed_ = true;
+  for (size_t i_ens = 0; i_ens < ensembles.size(); i_ens++) {
+    for (const ParticleData &part : ensembles[i_ens]) {
+      add_particle_to_index(i_ens, part);
+    }
+  }
+}
+
+void PauliBlocker::add_to_index(int i_ensemble, const ParticleList &particles) {
+  if (!indexed_) {
+    return;
+  }
+  for (const ParticleData &part : particles) {
+    add_particle_to_index(i_ensemble, part);
+  }
+}
+
+void PauliBlocker::clear_index() {
+  index_.clear();
+  indexed_ = false;
+}
+
+std::int64_t PauliBlocker::cell_key(std::int64_t ix, std::int64_t iy,
+                                    std::int64_t iz) {
+  // 21 bits per direction, which is enough for a million cells
+  constexpr std::int64_t offset = 1 << 20;
+  constexpr std::int64_t mask = (1 << 21) - 1;
+  return ((ix + offset) & mask) | (((iy + offset) & mask) << 21) |
+         (((iz + offset) & mask) << 42);
+}
+
+std::int64_t PauliBlocker::cell_coordinate(const ThreeVector &r,
+                                           int i) const {
+  return static_cast<std::int64_t>(std::floor(r[i] / index_cell_length_));
+}
+
+void PauliBlocker::add_particle_to_index(int i_ensemble,
+                                         const ParticleData &part) {
+  // Only baryons are Pauli blocked.
+  if (!part.is_baryon()) {
+    return;
+  }
+  const ThreeVector r = part.position().threevec();
+  index_[part.pdgcode()][cell_key(cell_coordinate(r, 0), cell_coordinate(r, 1),
+                                  cell_coordinate(r, 2))]
+      .emplace_back(i_ensemble, part);
+}
+
 void PauliBlocker::init_weights_analytical() {
   const double pi = M_PI;
   const double sqrt2 = std::sqrt(2.);
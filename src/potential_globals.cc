@@ -9,11 +9,11 @@
 
 #include "smash/lattice.h"
 #include "smash/potentials.h"
+#include "smash/potentialslattice.h"
 
 namespace smash {
 
-RectangularLattice<FourVector> *UB_lat_pointer = nullptr;
-RectangularLattice<FourVector> *UI3_lat_pointer = nullptr;
+PotentialsLattice *potentials_lat_pointer = nullptr;
 Potentials *pot_pointer = nullptr;
 
 }  // namespace smash
@@ -136,9 +136,21 @@ Potentials::Potentials(Configuration conf, const DensityParameters &param)
    * the configuration. Note that in the final eqations the summand for \f$ i=j
    * \f$ drops out because the contribution from that cell to the integral
    * vanishes if one assumes the current and density to be constant in the cell.
+   *
+   * By default the sums are carried out directly for every lattice node, which
+   * takes a time proportional to the number of nodes times the number of cells
+   * within \f$ R_\mathrm{cut} \f$. With \key FFT_Solver (bool, optional,
+   * default = false) set to true, they are instead evaluated as discrete
+   * convolutions with fast Fourier transforms, which scales with the number of
+   * nodes times its logarithm. The charge distribution is padded with empty
+   * cells for non-periodic lattices, such that the fields do not wrap around
+   * the lattice. The cut is applied to every coordinate separately with this
+   * solver, i.e. all cells within a cube of half edge length
+   * \f$ R_\mathrm{cut} \f$ contribute.
    */
   if (use_coulomb_) {
     coulomb_r_cut_ = conf.take({"Coulomb", "R_Cut"});
+    coulomb_fft_ = conf.take({"Coulomb", "FFT_Solver"}, false);
   }
   /*!\Userguide
     * \page potentials_VDF_ VDF
@@ -432,6 +444,13 @@ double Potentials::dVsym_drhoB(const double rhoB, const double rhoI3) const {
 
 std::tuple<ThreeVector, ThreeVector, ThreeVector, ThreeVector>
 Potentials::all_forces(const ThreeVector &r, const ParticleList &plist) const {
+  return all_forces(r, ParticleCells(plist, param_.r_cut()));
+}
+
+std::tuple<ThreeVector, ThreeVector, ThreeVector, ThreeVector>
+Potentials::all_forces(const ThreeVector &r, const ParticleCells &cells) const {
+  // Only particles within r_cut contribute to the smeared densities
+  const std::vector<const ParticleData *> plist = cells.neighbors(r);
   const bool compute_gradient = true;
   const bool smearing = true;
   auto F_skyrme_or_VDF =
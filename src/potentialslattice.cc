@@ -0,0 +1,29 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include "smash/potentialslattice.h"
+
+#include <stdexcept>
+
+namespace smash {
+
+void PotentialsLattice::set_fields(
+    const RectangularLattice<std::pair<ThreeVector, ThreeVector>> &EM_lat) {
+  const std::size_t n = size();
+  if (EM_lat.size() != n) {
+    throw std::invalid_argument(
+        "The lattices of potentials and fields have different numbers of "
+        "nodes.");
+  }
+  for (std::size_t i = 0; i < n; i++) {
+    (*this)[i].EM = EM_lat[i];
+  }
+}
+
+}  // namespace smash
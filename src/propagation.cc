@@ -13,6 +13,7 @@
 #include "smash/collidermodus.h"
 #include "smash/listmodus.h"
 #include "smash/logging.h"
+#include "smash/parallel.h"
 #include "smash/spheremodus.h"
 
 namespace smash {
@@ -108,79 +109,111 @@ void expand_space_time(Particles *particles,
   }
 }
 
-void update_momenta(
-    std::vector<Particles> &ensembles, double dt, const Potentials &pot,
-    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FB_lat,
-    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FI3_lat,
-    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *EM_lat) {
-  // Copy particles from ALL ensembles to a single list before propagation
-  // and calculate potentials from this list
-  ParticleList plist;
+namespace {
+/**
+ * Common implementation of both versions of update_momenta.
+ *
+ * \tparam F Type of the lookup, callable as lookup(r, fields), which stores
+ *         the forces and fields at r in fields and returns whether the forces
+ *         were found on the lattices. If not, they are computed off the
+ *         lattices, but the electric and magnetic fields are still used.
+ * \param[in,out] ensembles Particles of all ensembles
+ * \param[in] dt Time step
+ * \param[in] pot The potentials in the system
+ * \param[in] lookup Lookup of the forces on the lattices
+ * \param[in] n_threads Number of threads computing the forces
+ */
+template <typename F>
+void update_momenta_impl(std::vector<Particles> &ensembles, double dt,
+                         const Potentials &pot, F &&lookup, int n_threads) {
+  // Only baryons and nuclei will be affected by the potentials
+  std::vector<ParticleData *> affected;
   for (Particles &particles : ensembles) {
-    const ParticleList tmp = particles.copy_to_vector();
-    plist.insert(plist.end(), tmp.begin(), tmp.end());
+    for (ParticleData &data : particles) {
+      if (data.is_baryon() || data.is_nucleus()) {
+        affected.push_back(&data);
+      }
+    }
   }
+  const int n_affected = affected.size();
 
-  bool possibly_use_lattice =
-      (pot.use_skyrme() ? (FB_lat != nullptr) : true) &&
-      (pot.use_vdf() ? (FB_lat != nullptr) : true) &&
-      (pot.use_symmetry() ? (FI3_lat != nullptr) : true);
-  std::pair<ThreeVector, ThreeVector> FB, FI3, EM_fields;
-  double min_time_scale = std::numeric_limits<double>::infinity();
+  // Force from the given baryon and isospin forces plus the Lorentz force
+  auto total_force = [&](const ParticleData &data,
+                         const PotentialsOnLattice &fields) {
+    const auto scale = pot.force_scale(data.type());
+    const ThreeVector v = data.momentum().velocity();
+    ThreeVector Force =
+        scale.first * (fields.FB.first + v.cross_product(fields.FB.second)) +
+        scale.second * data.type().isospin3_rel() *
+            (fields.FI3.first + v.cross_product(fields.FI3.second));
+    // Potentially add Lorentz force
+    if (pot.use_coulomb()) {
+      // factor hbar*c to convert fields from 1/fm^2 to GeV/fm
+      Force += hbarc * data.type().charge() * elementary_charge *
+               (fields.EM.first + v.cross_product(fields.EM.second));
+    }
+    return Force;
+  };
 
-  for (Particles &particles : ensembles) {
-    for (ParticleData &data : particles) {
-      // Only baryons and nuclei will be affected by the potentials
-      if (!(data.is_baryon() || data.is_nucleus())) {
-        continue;
-      }
-      const auto scale = pot.force_scale(data.type());
-      const ThreeVector r = data.position().threevec();
-      /* Lattices can be used for calculation if 1-2 are fulfilled:
-       * 1) Required lattices are not nullptr - possibly_use_lattice
-       * 2) r is not out of required lattices */
-      const bool use_lattice =
-          possibly_use_lattice &&
-          (pot.use_skyrme() ? FB_lat->value_at(r, FB) : true) &&
-          (pot.use_vdf() ? FB_lat->value_at(r, FB) : true) &&
-          (pot.use_symmetry() ? FI3_lat->value_at(r, FI3) : true);
-      if (!pot.use_skyrme() && !pot.use_vdf()) {
-        FB = std::make_pair(ThreeVector(0., 0., 0.), ThreeVector(0., 0., 0.));
-      }
-      if (!pot.use_symmetry()) {
-        FI3 = std::make_pair(ThreeVector(0., 0., 0.), ThreeVector(0., 0., 0.));
-      }
-      if (!use_lattice) {
-        const auto tmp = pot.all_forces(r, plist);
-        FB = std::make_pair(std::get<0>(tmp), std::get<1>(tmp));
-        FI3 = std::make_pair(std::get<2>(tmp), std::get<3>(tmp));
-      }
-      ThreeVector Force =
-          scale.first *
-              (FB.first + data.momentum().velocity().cross_product(FB.second)) +
-          scale.second * data.type().isospin3_rel() *
-              (FI3.first +
-               data.momentum().velocity().cross_product(FI3.second));
-      // Potentially add Lorentz force
-      if (pot.use_coulomb() && EM_lat->value_at(r, EM_fields)) {
-        // factor hbar*c to convert fields from 1/fm^2 to GeV/fm
-        Force += hbarc * data.type().charge() * elementary_charge *
-                 (EM_fields.first +
-                  data.momentum().velocity().cross_product(EM_fields.second));
-      }
-      logg[LPropagation].debug("Update momenta: F [GeV/fm] = ", Force);
-      data.set_4momentum(data.effective_mass(),
-                         data.momentum().threevec() + Force * dt);
-
-      // calculate the time scale of the change in momentum
-      const double Force_abs = Force.abs();
-      if (Force_abs < really_small) {
-        continue;
+  /* All forces are computed before any momentum is changed, such that the
+   * particles see the same densities as before the time step. The forces of
+   * particles outside of the lattices are computed afterwards. */
+  std::vector<ThreeVector> forces(n_affected);
+  std::vector<std::vector<int>> off_lattice(std::max(1, n_threads));
+  parallel_for_blocks(n_affected, n_threads, [&](int begin, int end,
+                                                  int block) {
+    for (int i = begin; i < end; i++) {
+      const ParticleData &data = *affected[i];
+      PotentialsOnLattice fields;
+      if (lookup(data.position().threevec(), fields)) {
+        forces[i] = total_force(data, fields);
+      } else {
+        off_lattice[block].push_back(i);
       }
-      const double time_scale = data.momentum().x0() / Force_abs;
-      if (time_scale < min_time_scale) {
-        min_time_scale = time_scale;
+    }
+  });
+
+  std::vector<int> outside;
+  for (const std::vector<int> &block : off_lattice) {
+    outside.insert(outside.end(), block.begin(), block.end());
+  }
+  if (!outside.empty()) {
+    /* Sort the particles of all ensembles into cells only if needed, such
+     * that the forces are only summed over the particles within the cutoff
+     * of the smearing kernel. The cells point to the particles themselves,
+     * which are not modified before all forces are known. */
+    const ParticleCells cells(ensembles, pot.smearing_cutoff());
+    const int n_outside = outside.size();
+    parallel_for_blocks(n_outside, n_threads, [&](int begin, int end, int) {
+      for (int k = begin; k < end; k++) {
+        const ParticleData &data = *affected[outside[k]];
+        const ThreeVector r = data.position().threevec();
+        PotentialsOnLattice fields;
+        lookup(r, fields);
+        const auto tmp = pot.all_forces(r, cells);
+        fields.FB = std::make_pair(std::get<0>(tmp), std::get<1>(tmp));
+        fields.FI3 = std::make_pair(std::get<2>(tmp), std::get<3>(tmp));
+        forces[outside[k]] = total_force(data, fields);
       }
+    });
+  }
+
+  double min_time_scale = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < n_affected; i++) {
+    ParticleData &data = *affected[i];
+    const ThreeVector &Force = forces[i];
+    logg[LPropagation].debug("Update momenta: F [GeV/fm] = ", Force);
+    data.set_4momentum(data.effective_mass(),
+                       data.momentum().threevec() + Force * dt);
+
+    // calculate the time scale of the change in momentum
+    const double Force_abs = Force.abs();
+    if (Force_abs < really_small) {
+      continue;
+    }
+    const double time_scale = data.momentum().x0() / Force_abs;
+    if (time_scale < min_time_scale) {
+      min_time_scale = time_scale;
     }
   }
   // warn if the time step is too big
@@ -194,5 +227,43 @@ void update_momenta(
         << "need to increase the number of ensembles or testparticles.";
   }
 }
+}  // unnamed namespace
+
+void update_momenta(
+    std::vector<Particles> &ensembles, double dt, const Potentials &pot,
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FB_lat,
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *FI3_lat,
+    RectangularLattice<std::pair<ThreeVector, ThreeVector>> *EM_lat,
+    int n_threads) {
+  const bool possibly_use_lattice =
+      (pot.use_skyrme() ? (FB_lat != nullptr) : true) &&
+      (pot.use_vdf() ? (FB_lat != nullptr) : true) &&
+      (pot.use_symmetry() ? (FI3_lat != nullptr) : true);
+  auto lookup = [&](const ThreeVector &r, PotentialsOnLattice &fields) {
+    if (pot.use_coulomb()) {
+      EM_lat->value_at(r, fields.EM);
+    }
+    /* Lattices can be used for calculation if 1-2 are fulfilled:
+     * 1) Required lattices are not nullptr - possibly_use_lattice
+     * 2) r is not out of required lattices */
+    return possibly_use_lattice &&
+           (pot.use_skyrme() ? FB_lat->value_at(r, fields.FB) : true) &&
+           (pot.use_vdf() ? FB_lat->value_at(r, fields.FB) : true) &&
+           (pot.use_symmetry() ? FI3_lat->value_at(r, fields.FI3) : true);
+  };
+  update_momenta_impl(ensembles, dt, pot, lookup, n_threads);
+}
+
+void update_momenta(std::vector<Particles> &ensembles, double dt,
+                    const Potentials &pot, PotentialsLattice *pot_lat,
+                    int n_threads) {
+  const bool needs_lattice =
+      pot.use_skyrme() || pot.use_vdf() || pot.use_symmetry();
+  auto lookup = [&](const ThreeVector &r, PotentialsOnLattice &fields) {
+    const bool found = pot_lat != nullptr && pot_lat->at(r, fields);
+    return found || !needs_lattice;
+  };
+  update_momenta_impl(ensembles, dt, pot, lookup, n_threads);
+}
 
 }  // namespace smash
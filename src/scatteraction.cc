@@ -142,6 +142,17 @@ void ScatterAction::add_all_scatterings(
   }
 }
 
+void ScatterAction::add_elastic_and_resonance_scatterings(
+    double elastic_parameter, bool include_elastic, double low_snn_cut,
+    bool use_AQM, const ParticleTypePtrList& resonances, double scale_xs,
+    double additional_el_xs) {
+  CrossSections xs(incoming_particles_, sqrt_s(),
+                   get_potential_at_interaction_point());
+  add_collisions(xs.generate_elastic_and_resonance_list(
+      elastic_parameter, include_elastic, low_snn_cut, use_AQM, resonances,
+      scale_xs, additional_el_xs));
+}
+
 double ScatterAction::get_total_weight() const {
   return total_cross_section_ * incoming_particles_[0].xsec_scaling_factor() *
          incoming_particles_[1].xsec_scaling_factor();
@@ -348,15 +348,11 @@ CollisionBranchList ScatterActionPhoton::create_collision_branch() {
   return process_list;
 }
 
-double ScatterActionPhoton::total_cross_section(MediatorType mediator) const {
-  CollisionBranchList process_list;
-  CrosssectionsPhoton<ComputationMethod::Analytic> xs_object;
-
-  const double s = mandelstam_s();
-  // the mass of the mediating particle depends on the channel. For an incoming
-  // rho it is the mass of the incoming particle, for an outgoing rho it is the
-  // sampled mass
-  const double m_rho = rho_mass();
+template <ComputationMethod method>
+double ScatterActionPhoton::total_cross_section_from(MediatorType mediator,
+                                                     const double s,
+                                                     const double m_rho) const {
+  CrosssectionsPhoton<method> xs_object;
   double xsection = 0.0;
 
   switch (reac_) {
@@ -411,6 +407,21 @@ double ScatterActionPhoton::total_cross_section(MediatorType mediator) const {
       // never reached
       break;
   }
+  return xsection;
+}
+
+double ScatterActionPhoton::total_cross_section(MediatorType mediator) const {
+  const double s = mandelstam_s();
+  // the mass of the mediating particle depends on the channel. For an incoming
+  // rho it is the mass of the incoming particle, for an outgoing rho it is the
+  // sampled mass
+  const double m_rho = rho_mass();
+  double xsection =
+      CrosssectionsPhoton<ComputationMethod::Lookup>::is_tabulated()
+          ? total_cross_section_from<ComputationMethod::Lookup>(mediator, s,
+                                                                m_rho)
+          : total_cross_section_from<ComputationMethod::Analytic>(mediator, s,
+                                                                  m_rho);
 
   if (xsection == 0.0) {
     // Vanishing cross sections are problematic for the creation of a
@@ -500,14 +511,14 @@ double ScatterActionPhoton::total_cross_section_w_ff(const double E_photon) {
   }
 }
 
-double ScatterActionPhoton::diff_cross_section(const double t,
-                                               const double m_rho,
-                                               MediatorType mediator) const {
-  const double s = mandelstam_s();
+template <ComputationMethod method>
+double ScatterActionPhoton::diff_cross_section_from(MediatorType mediator,
+                                                    const double s,
+                                                    const double t,
+                                                    const double m_rho) const {
+  CrosssectionsPhoton<method> xs_object;
   double diff_xsection = 0.0;
 
-  CrosssectionsPhoton<ComputationMethod::Analytic> xs_object;
-
   switch (reac_) {
     case ReactionType::pi_p_pi_m_rho_z:
       diff_xsection = xs_object.xs_diff_pi_pi_rho0(s, t, m_rho);
@@ -558,6 +569,19 @@ double ScatterActionPhoton::diff_cross_section(const double t,
       // never reached
       break;
   }
+  return diff_xsection;
+}
+
+double ScatterActionPhoton::diff_cross_section(const double t,
+                                               const double m_rho,
+                                               MediatorType mediator) const {
+  const double s = mandelstam_s();
+  double diff_xsection =
+      CrosssectionsPhoton<ComputationMethod::Lookup>::is_tabulated()
+          ? diff_cross_section_from<ComputationMethod::Lookup>(mediator, s, t,
+                                                               m_rho)
+          : diff_cross_section_from<ComputationMethod::Analytic>(mediator, s,
+                                                                 t, m_rho);
 
   // Rarely, it can happen that the computed differential cross sections slip
   // slightly below zero for numerical reasons. This is unphysical. We
@@ -11,9 +11,12 @@
 
 #include <algorithm>
 #include <map>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "smash/constants.h"
+#include "smash/crosssections.h"
 #include "smash/cxx14compat.h"
 #include "smash/decaymodes.h"
 #include "smash/logging.h"
@@ -191,6 +194,17 @@ static constexpr int LFindScatter = LogArea::FindScatter::id;
  * It is possible to produce a popcorn meson from the diquark end of a string
  * with certain probability (i.e., diquark to meson + diquark).
  *
+ * \key Pythia_Hard_Pairs (list of pairs of PDG codes, optional, default = [])
+ * \n
+ * Hadron pairs for which the PYTHIA objects of the hard string routine are
+ * initialized at startup. Otherwise each of them is initialized when the
+ * first hard string process of the pair happens, which takes a few seconds in
+ * the middle of the event. The objects are kept for all events and ensembles.
+ *
+ * \key Pythia_Hard_Init_Energy (double, optional, default = 10.0 GeV) \n
+ * Center-of-mass energy with which the PYTHIA objects for the pairs given in
+ * Pythia_Hard_Pairs are initialized.
+ *
  * **Examples: Configuring the String Paramters**\n
  *
  * String fragmentation is activated and if desired, the string parameters can
@@ -218,6 +232,15 @@ static constexpr int LFindScatter = LogArea::FindScatter::id;
          Popcorn_Rate: 0.15
   \endverbatim
  *
+ * The PYTHIA objects for hard proton-proton and pion-proton collisions are
+ * initialized at startup with
+ *\verbatim
+ Collision_Term:
+     String_Parameters:
+         Pythia_Hard_Pairs: [[2212, 2212], [211, 2212], [-211, 2212]]
+         Pythia_Hard_Init_Energy: 17.3
+  \endverbatim
+ *
  *
  * \page collision_criterion Collision_Criterion
  * \key "Geometric" - Geometric collision criterion \n
@@ -300,6 +323,25 @@ static constexpr int LFindScatter = LogArea::FindScatter::id;
 
  */
 
+/**
+ * Check whether elastic and 2->1 reactions are the only binary reactions that
+ * can happen with the given parameters. Strings, inelastic 2->2 reactions,
+ * deuteron 2->3 reactions and NNbar annihilation are all excluded then.
+ *
+ * \param[in] parameters Parameters of the experiment
+ * \return Whether only elastic and 2->1 reactions are enabled.
+ */
+static bool only_elastic_and_resonances(
+    const ExperimentParameters& parameters) {
+  ReactionsBitSet inelastic_2to2 = parameters.included_2to2;
+  inelastic_2to2.reset(IncludedReactions::Elastic);
+  return !parameters.strings_switch && inelastic_2to2.none() &&
+         !parameters
+              .included_multi[IncludedMultiParticleReactions::Deuteron_3to2] &&
+         parameters.nnbar_treatment != NNbarTreatment::Resonances &&
+         parameters.nnbar_treatment != NNbarTreatment::TwoToFive;
+}
+
 ScatterActionsFinder::ScatterActionsFinder(
     Configuration config, const ExperimentParameters& parameters)
     : coll_crit_(parameters.coll_crit),
@@ -324,7 +366,8 @@ ScatterActionsFinder::ScatterActionsFinder(
       allow_first_collisions_within_nucleus_(
           parameters.allow_collisions_within_nucleus),
       only_warn_for_high_prob_(config.take(
-          {"Collision_Term", "Only_Warn_For_High_Probability"}, false)) {
+          {"Collision_Term", "Only_Warn_For_High_Probability"}, false)),
+      elastic_and_resonances_only_(only_elastic_and_resonances(parameters)) {
   if (is_constant_elastic_isotropic()) {
     logg[LFindScatter].info(
         "Constant elastic isotropic cross-section mode:", " using ",
@@ -369,27 +412,92 @@ ScatterActionsFinder::ScatterActionsFinder(
 
   if (strings_switch_) {
     auto subconfig = config["Collision_Term"]["String_Parameters"];
-    string_process_interface_ = make_unique<StringProcess>(
-        subconfig.take({"String_Tension"}, 1.0), string_formation_time_,
-        subconfig.take({"Gluon_Beta"}, 0.5),
-        subconfig.take({"Gluon_Pmin"}, 0.001),
-        subconfig.take({"Quark_Alpha"}, 2.0),
-        subconfig.take({"Quark_Beta"}, 7.0),
-        subconfig.take({"Strange_Supp"}, 0.16),
-        subconfig.take({"Diquark_Supp"}, 0.036),
-        subconfig.take({"Sigma_Perp"}, 0.42),
-        subconfig.take({"StringZ_A_Leading"}, 0.2),
-        subconfig.take({"StringZ_B_Leading"}, 2.0),
-        subconfig.take({"StringZ_A"}, 2.0), subconfig.take({"StringZ_B"}, 0.55),
-        subconfig.take({"String_Sigma_T"}, 0.5),
-        subconfig.take({"Form_Time_Factor"}, 1.0),
-        subconfig.take({"Mass_Dependent_Formation_Times"}, false),
-        subconfig.take({"Prob_proton_to_d_uu"}, 1. / 3.),
-        subconfig.take({"Separate_Fragment_Baryon"}, true),
-        subconfig.take({"Popcorn_Rate"}, 0.15));
+    const double string_tension = subconfig.take({"String_Tension"}, 1.0);
+    const double gluon_beta = subconfig.take({"Gluon_Beta"}, 0.5);
+    const double gluon_pmin = subconfig.take({"Gluon_Pmin"}, 0.001);
+    const double quark_alpha = subconfig.take({"Quark_Alpha"}, 2.0);
+    const double quark_beta = subconfig.take({"Quark_Beta"}, 7.0);
+    const double strange_supp = subconfig.take({"Strange_Supp"}, 0.16);
+    const double diquark_supp = subconfig.take({"Diquark_Supp"}, 0.036);
+    const double sigma_perp = subconfig.take({"Sigma_Perp"}, 0.42);
+    const double stringz_a_leading =
+        subconfig.take({"StringZ_A_Leading"}, 0.2);
+    const double stringz_b_leading =
+        subconfig.take({"StringZ_B_Leading"}, 2.0);
+    const double stringz_a = subconfig.take({"StringZ_A"}, 2.0);
+    const double stringz_b = subconfig.take({"StringZ_B"}, 0.55);
+    const double string_sigma_t = subconfig.take({"String_Sigma_T"}, 0.5);
+    const double form_time_factor = subconfig.take({"Form_Time_Factor"}, 1.0);
+    const bool mass_dependent_formation_times =
+        subconfig.take({"Mass_Dependent_Formation_Times"}, false);
+    const double prob_proton_to_d_uu =
+        subconfig.take({"Prob_proton_to_d_uu"}, 1. / 3.);
+    const bool separate_fragment_baryon =
+        subconfig.take({"Separate_Fragment_Baryon"}, true);
+    const double popcorn_rate = subconfig.take({"Popcorn_Rate"}, 0.15);
+
+    const std::vector<std::vector<int>> hard_pairs = subconfig.take(
+        {"Pythia_Hard_Pairs"}, std::vector<std::vector<int>>{});
+    const double hard_init_sqrts =
+        subconfig.take({"Pythia_Hard_Init_Energy"}, 10.);
+    std::vector<std::pair<PdgCode, PdgCode>> pairs;
+    for (const std::vector<int>& pair : hard_pairs) {
+      if (pair.size() != 2) {
+        throw std::invalid_argument(
+            "Pythia_Hard_Pairs has to be a list of pairs of PDG codes.");
+      }
+      pairs.emplace_back(PdgCode::from_decimal(pair[0]),
+                         PdgCode::from_decimal(pair[1]));
+    }
+
+    const double time_formation = string_formation_time_;
+    auto create_string_process = [=]() {
+      auto process = make_unique<StringProcess>(
+          string_tension, time_formation, gluon_beta, gluon_pmin, quark_alpha,
+          quark_beta, strange_supp, diquark_supp, sigma_perp,
+          stringz_a_leading, stringz_b_leading, stringz_a, stringz_b,
+          string_sigma_t, form_time_factor, mass_dependent_formation_times,
+          prob_proton_to_d_uu, separate_fragment_baryon, popcorn_rate);
+      if (!pairs.empty()) {
+        process->preinitialize_hard_pythia(pairs, hard_init_sqrts);
+      }
+      return process;
+    };
+    /* At most one worker per hardware thread can perform string processes
+     * at the same time. The objects of the other workers are only created
+     * once they are used. */
+    const int n_workers =
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    string_process_pool_ =
+        make_unique<StringProcessPool>(create_string_process, n_workers);
+    if (!pairs.empty()) {
+      logg[LFindScatter].info("Initialized PYTHIA for hard string processes ",
+                              "of ", pairs.size(), " hadron pairs.");
+    }
+  }
+
+  if (elastic_and_resonances_only_) {
+    logg[LFindScatter].info(
+        "Only elastic and 2->1 reactions are enabled, using the reduced "
+        "cross-section kernel.");
+    if (two_to_one_) {
+      resonance_table_ = CrossSections::resonance_formation_table();
+    }
   }
 }
 
+const ParticleTypePtrList& ScatterActionsFinder::formable_resonances(
+    const ParticleType& a, const ParticleType& b) const {
+  static const ParticleTypePtrList none;
+  if (resonance_table_.empty()) {
+    return none;
+  }
+  const ParticleTypeList& all_types = ParticleType::list_all();
+  const size_t i = std::addressof(a) - std::addressof(all_types[0]);
+  const size_t j = std::addressof(b) - std::addressof(all_types[0]);
+  return resonance_table_[i * all_types.size() + j];
+}
+
 ActionPtr ScatterActionsFinder::check_collision_two_part(
     const ParticleData& data_a, const ParticleData& data_b, double dt,
     const std::vector<FourVector>& beam_momentum,
@@ -438,7 +546,7 @@ ActionPtr ScatterActionsFinder::check_collision_two_part(
   }
 
   if (strings_switch_) {
-    act->set_string_interface(string_process_interface_.get());
+    act->set_string_interface(string_process_pool_->get());
   }
 
   // Distance squared calculation not needed for stochastic criterion
@@ -457,10 +565,18 @@ ActionPtr ScatterActionsFinder::check_collision_two_part(
   }
 
   // Add various subprocesses.
-  act->add_all_scatterings(elastic_parameter_, two_to_one_, incl_set_,
-                           incl_multi_set_, low_snn_cut_, strings_switch_,
-                           use_AQM_, strings_with_probability_,
-                           nnbar_treatment_, scale_xs_, additional_el_xs_);
+  if (elastic_and_resonances_only_) {
+    act->add_elastic_and_resonance_scatterings(
+        elastic_parameter_, incl_set_[IncludedReactions::Elastic],
+        low_snn_cut_, use_AQM_,
+        formable_resonances(data_a.type(), data_b.type()), scale_xs_,
+        additional_el_xs_);
+  } else {
+    act->add_all_scatterings(elastic_parameter_, two_to_one_, incl_set_,
+                             incl_multi_set_, low_snn_cut_, strings_switch_,
+                             use_AQM_, strings_with_probability_,
+                             nnbar_treatment_, scale_xs_, additional_el_xs_);
+  }
 
   double xs =
       act->cross_section() * fm2_mb / static_cast<double>(testparticles_);
@@ -731,7 +847,7 @@ void ScatterActionsFinder::dump_reactions() const {
             ScatterActionPtr act = make_unique<ScatterAction>(
                 A, B, time, isotropic_, string_formation_time_);
             if (strings_switch_) {
-              act->set_string_interface(string_process_interface_.get());
+              act->set_string_interface(string_process_pool_->get());
             }
             act->add_all_scatterings(
                 elastic_parameter_, two_to_one_, incl_set_, incl_multi_set_,
@@ -1126,7 +1242,7 @@ void ScatterActionsFinder::dump_cross_sections(
     ScatterActionPtr act = make_unique<ScatterAction>(
         a_data, b_data, 0., isotropic_, string_formation_time_);
     if (strings_switch_) {
-      act->set_string_interface(string_process_interface_.get());
+      act->set_string_interface(string_process_pool_->get());
     }
     act->add_all_scatterings(elastic_parameter_, two_to_one_, incl_set_,
                              incl_multi_set_, low_snn_cut_, strings_switch_,
@@ -14,6 +14,7 @@
 
 #include <boost/filesystem/fstream.hpp>
 
+#include "smash/crosssectionsphoton.h"
 #include "smash/cxx14compat.h"
 #include "smash/decaymodes.h"
 #include "smash/experiment.h"
@@ -384,6 +385,14 @@ void initialize_particles_and_decays(Configuration &configuration,
   initialize_particles_and_decays(configuration);
   logg[LMain].info("Tabulating cross section integrals...");
   IsoParticleType::tabulate_integrals(hash, tabulations_path);
+  if (configuration.read({"Collision_Term", "Photons", "2to2_Scatterings"},
+                         false) &&
+      configuration.read(
+          {"Collision_Term", "Photons", "Tabulated_Cross_Sections"}, false)) {
+    logg[LMain].info("Tabulating photon cross sections...");
+    CrosssectionsPhoton<ComputationMethod::Lookup>::tabulate(hash,
+                                                            tabulations_path);
+  }
 }
 
 }  // unnamed namespace
@@ -7,7 +7,11 @@
  *
  */
 
+#include <algorithm>
 #include <array>
+#include <random>
+#include <stdexcept>
+#include <string>
 
 #include "smash/angles.h"
 #include "smash/kinematics.h"
@@ -47,6 +51,7 @@ StringProcess::StringProcess(
       mass_dependent_formation_times_(mass_dependent_formation_times),
       prob_proton_to_d_uu_(prob_proton_to_d_uu),
       separate_fragment_baryon_(separate_fragment_baryon) {
+  const SystemTimePoint init_start = SystemClock::now();
   // setup and initialize pythia for fragmentation
   pythia_hadron_ = make_unique<Pythia8::Pythia>(PYTHIA_XML_DIR, false);
   /* turn off all parton-level processes to implement only hadronization */
@@ -82,6 +87,54 @@ StringProcess::StringProcess(
   }
 
   final_state_.clear();
+  pythia_init_time_ += SystemClock::now() - init_start;
+}
+
+void StringProcess::preinitialize_hard_pythia(
+    const std::vector<std::pair<PdgCode, PdgCode>> &pairs, double sqrts) {
+  for (const auto &pair : pairs) {
+    PdgCode pdg_a = pair.first;
+    PdgCode pdg_b = pair.second;
+    const int id_a = pdg_map_for_pythia(pdg_a);
+    const int id_b = pdg_map_for_pythia(pdg_b);
+    hard_pythia({id_a, id_b}, sqrts);
+    hard_pythia({id_b, id_a}, sqrts);
+  }
+}
+
+Pythia8::Pythia *StringProcess::hard_pythia(std::pair<int, int> idAB,
+                                            double sqrts) {
+  std::unique_ptr<Pythia8::Pythia> &pythia_hard = hard_map_[idAB];
+  // If an entry for the particle IDs has already been initialized, use it
+  if (pythia_hard) {
+    return pythia_hard.get();
+  }
+
+  const SystemTimePoint init_start = SystemClock::now();
+  pythia_hard = make_unique<Pythia8::Pythia>(PYTHIA_XML_DIR, false);
+  pythia_hard->readString("SoftQCD:nonDiffractive = on");
+  pythia_hard->readString("MultipartonInteractions:pTmin = 1.5");
+  pythia_hard->readString("HadronLevel:all = off");
+
+  common_setup_pythia(pythia_hard.get(), strange_supp_, diquark_supp_,
+                      popcorn_rate_, stringz_a_produce_, stringz_b_produce_,
+                      string_sigma_T_);
+
+  pythia_hard->settings.flag("Beams:allowVariableEnergy", true);
+
+  pythia_hard->settings.mode("Beams:idA", idAB.first);
+  pythia_hard->settings.mode("Beams:idB", idAB.second);
+  pythia_hard->settings.parm("Beams:eCM", sqrts);
+
+  logg[LPythia].debug("Pythia object initialized with ", idAB.first, " + ",
+                      idAB.second, " at CM energy [GeV] ", sqrts);
+
+  if (!pythia_hard->init()) {
+    pythia_hard.reset();
+    throw std::runtime_error("Pythia failed to initialize.");
+  }
+  pythia_init_time_ += SystemClock::now() - init_start;
+  return pythia_hard.get();
 }
 
 void StringProcess::common_setup_pythia(Pythia8::Pythia *pythia_in,
@@ -555,37 +608,12 @@ bool StringProcess::next_NDiffHard() {
 
   std::pair<int, int> idAB{pdg_for_pythia[0], pdg_for_pythia[1]};
 
-  // If an entry for the calculated particle IDs does not exist, create one and
-  // initialize it accordingly
-  if (hard_map_.count(idAB) == 0) {
-    hard_map_[idAB] = make_unique<Pythia8::Pythia>(PYTHIA_XML_DIR, false);
-    hard_map_[idAB]->readString("SoftQCD:nonDiffractive = on");
-    hard_map_[idAB]->readString("MultipartonInteractions:pTmin = 1.5");
-    hard_map_[idAB]->readString("HadronLevel:all = off");
-
-    common_setup_pythia(hard_map_[idAB].get(), strange_supp_, diquark_supp_,
-                        popcorn_rate_, stringz_a_produce_, stringz_b_produce_,
-                        string_sigma_T_);
-
-    hard_map_[idAB]->settings.flag("Beams:allowVariableEnergy", true);
-
-    hard_map_[idAB]->settings.mode("Beams:idA", idAB.first);
-    hard_map_[idAB]->settings.mode("Beams:idB", idAB.second);
-    hard_map_[idAB]->settings.parm("Beams:eCM", sqrtsAB_);
-
-    logg[LPythia].debug("Pythia object initialized with ", pdg_for_pythia[0],
-                        " + ", pdg_for_pythia[1], " at CM energy [GeV] ",
-                        sqrtsAB_);
-
-    if (!hard_map_[idAB]->init()) {
-      throw std::runtime_error("Pythia failed to initialize.");
-    }
-  }
+  // Get the PYTHIA object for these particle IDs, create one if necessary
+  Pythia8::Pythia *pythia_hard = hard_pythia(idAB, sqrtsAB_);
 
-  // Else just pick the existing and initialized entry and go on
   // Initialize Pythias random number generator using SMASHs seed
   const int seed_new = random::uniform_int(1, maximum_rndm_seed_in_pythia);
-  hard_map_[idAB]->rndm.init(seed_new);
+  pythia_hard->rndm.init(seed_new);
   logg[LPythia].debug("hard_map_[", idAB.first, "][", idAB.second,
                       "] : rndm is initialized with seed ", seed_new);
 
@@ -594,7 +622,7 @@ bool StringProcess::next_NDiffHard() {
   // Short notation for Pythia event
   Pythia8::Event &event_hadron = pythia_hadron_->event;
   logg[LPythia].debug("Pythia hard event created");
-  bool final_state_success = hard_map_[idAB]->next(sqrtsAB_);
+  bool final_state_success = pythia_hard->next(sqrtsAB_);
   logg[LPythia].debug("Pythia final state computed, success = ",
                       final_state_success);
   if (!final_state_success) {
@@ -609,15 +637,15 @@ bool StringProcess::next_NDiffHard() {
   /* Update the partonic intermediate state from PYTHIA output.
    * Note that hadronization will be performed separately,
    * after identification of strings and replacement of constituents. */
-  for (int i = 0; i < hard_map_[idAB]->event.size(); i++) {
-    if (hard_map_[idAB]->event[i].isFinal()) {
-      const int pdgid = hard_map_[idAB]->event[i].id();
-      Pythia8::Vec4 pquark = hard_map_[idAB]->event[i].p();
-      const double mass = hard_map_[idAB]->particleData.m0(pdgid);
+  for (int i = 0; i < pythia_hard->event.size(); i++) {
+    if (pythia_hard->event[i].isFinal()) {
+      const int pdgid = pythia_hard->event[i].id();
+      Pythia8::Vec4 pquark = pythia_hard->event[i].p();
+      const double mass = pythia_hard->particleData.m0(pdgid);
 
-      const int status = hard_map_[idAB]->event[i].status();
-      const int color = hard_map_[idAB]->event[i].col();
-      const int anticolor = hard_map_[idAB]->event[i].acol();
+      const int status = pythia_hard->event[i].status();
+      const int color = pythia_hard->event[i].col();
+      const int anticolor = pythia_hard->event[i].acol();
 
       pSum += pquark;
       event_intermediate_.append(pdgid, status, color, anticolor, pquark, mass);
@@ -625,11 +653,11 @@ bool StringProcess::next_NDiffHard() {
   }
   // add junctions to the intermediate state if there is any.
   event_intermediate_.clearJunctions();
-  for (int i = 0; i < hard_map_[idAB]->event.sizeJunction(); i++) {
-    const int kind = hard_map_[idAB]->event.kindJunction(i);
+  for (int i = 0; i < pythia_hard->event.sizeJunction(); i++) {
+    const int kind = pythia_hard->event.kindJunction(i);
     std::array<int, 3> col;
     for (int j = 0; j < 3; j++) {
-      col[j] = hard_map_[idAB]->event.colJunction(i, j);
+      col[j] = pythia_hard->event.colJunction(i, j);
     }
     event_intermediate_.appendJunction(kind, col[0], col[1], col[2]);
   }
@@ -654,7 +682,7 @@ bool StringProcess::next_NDiffHard() {
     const int pdgid = event_intermediate_[ipart].id();
     if (event_intermediate_[ipart].isFinal() &&
         !event_intermediate_[ipart].isParton() &&
-        !hard_map_[idAB]->particleData.isOctetHadron(pdgid)) {
+        !pythia_hard->particleData.isOctetHadron(pdgid)) {
       logg[LPythia].debug("PDG ID from Pythia: ", pdgid);
       FourVector momentum = reorient(event_intermediate_[ipart], evecBasisAB_);
       logg[LPythia].debug("4-momentum from Pythia: ", momentum);
@@ -3274,4 +3302,89 @@ int StringProcess::pdg_map_for_pythia(PdgCode &pdg) {
   return pdg_mapped.get_decimal();
 }
 
+thread_local int StringProcessPool::current_worker_ = 0;
+
+StringProcessPool::StringProcessPool(Factory factory, int n_workers)
+    : factory_(std::move(factory)) {
+  if (n_workers < 1) {
+    throw std::invalid_argument(
+        "A pool of string processes needs at least one worker.");
+  }
+  workers_.resize(n_workers);
+  workers_[0].process = factory_();
+}
+
+StringProcessPool::WorkerScope::WorkerScope(StringProcessPool &pool,
+                                            int worker)
+    : pool_(pool), worker_(worker), previous_worker_(current_worker_) {
+  if (worker < 0 || worker >= pool.n_workers()) {
+    throw std::out_of_range("There is no string process worker " +
+                            std::to_string(worker) + ".");
+  }
+  current_worker_ = worker_;
+  if (worker_ > 0) {
+    std::swap(random::engine, pool_.workers_[worker_].engine);
+  }
+}
+
+StringProcessPool::WorkerScope::~WorkerScope() {
+  if (worker_ > 0) {
+    std::swap(random::engine, pool_.workers_[worker_].engine);
+  }
+  current_worker_ = previous_worker_;
+}
+
+StringProcess *StringProcessPool::get() {
+  if (current_worker_ >= n_workers()) {
+    throw std::out_of_range("There is no string process worker " +
+                            std::to_string(current_worker_) + ".");
+  }
+  Worker &worker = workers_[current_worker_];
+  if (!worker.process) {
+    worker.process = factory_();
+    seed_process(current_worker_);
+    logg[LPythia].debug("Created string process object for worker ",
+                        current_worker_);
+  }
+  return worker.process.get();
+}
+
+int StringProcessPool::size() const {
+  return std::count_if(
+      workers_.begin(), workers_.end(),
+      [](const Worker &worker) { return worker.process != nullptr; });
+}
+
+void StringProcessPool::init_pythia_hadron_rndm() {
+  common_seed_ = random::uniform_int(1, maximum_rndm_seed_in_pythia);
+  for (int i = 0; i < n_workers(); i++) {
+    if (i > 0) {
+      std::seed_seq seeds{common_seed_, i};
+      workers_[i].engine.seed(seeds);
+    }
+    if (workers_[i].process) {
+      seed_process(i);
+    }
+  }
+}
+
+SystemTimeSpan StringProcessPool::pythia_init_time() const {
+  SystemTimeSpan total = SystemTimeSpan::zero();
+  for (const Worker &worker : workers_) {
+    if (worker.process) {
+      total += worker.process->pythia_init_time();
+    }
+  }
+  return total;
+}
+
+void StringProcessPool::seed_process(int worker) {
+  /* Shift the common seed by a large prime for every further worker, such
+   * that the PYTHIA objects use different random streams. */
+  constexpr int64_t seed_stride = 104729;
+  const int64_t shifted = common_seed_ - 1 + seed_stride * worker;
+  workers_[worker].process->init_pythia_hadron_rndm(
+      1 + static_cast<int>(shifted % maximum_rndm_seed_in_pythia));
+}
+
 }  // namespace smash
@@ -7,6 +7,12 @@
 
 #include "smash/tabulation.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include <boost/filesystem.hpp>
+
 namespace smash {
 
 Tabulation::Tabulation(double x_min, double range, size_t num,
@@ -96,7 +102,7 @@ static void swrite(std::ofstream& stream, size_t x) {
  * \return Read value.
  */
 static size_t sread_size(std::ifstream& stream) {
-  uint64_t x;
+  uint64_t x = 0;
   stream.read(reinterpret_cast<char*>(&x), sizeof(x));
   if (x > std::numeric_limits<size_t>::max()) {
     throw std::runtime_error("trying to read vector larger than supported");
@@ -110,7 +116,8 @@ static size_t sread_size(std::ifstream& stream) {
  * \param stream Output stream.
  * \param x Value to be written.
  */
-static void swrite(std::ofstream& stream, const std::vector<double> x) {
+template <typename T>
+static void swrite(std::ofstream& stream, const std::vector<T> x) {
   swrite(stream, x.size());
   if (x.size() > 0) {
     stream.write(reinterpret_cast<const char*>(x.data()),
@@ -119,16 +126,43 @@ static void swrite(std::ofstream& stream, const std::vector<double> x) {
 }
 
 /**
- * Read binary representation of a vector of doubles.
+ * Count the bytes that are left to be read from a stream.
  *
  * \param[in] stream Input stream.
- * \return Read value.
+ * \return Number of remaining bytes, or 0 if the stream has failed.
  */
-static std::vector<double> sread_vector(std::ifstream& stream) {
-  const size_t n = sread_size(stream);
-  std::vector<double> x;
+static size_t remaining_bytes(std::ifstream& stream) {
+  const auto pos = stream.tellg();
+  if (!stream || pos < 0) {
+    return 0;
+  }
+  stream.seekg(0, std::ios::end);
+  const auto end = stream.tellg();
+  stream.seekg(pos);
+  return end > pos ? static_cast<size_t>(end - pos) : 0;
+}
+
+/**
+ * Read binary representation of a vector of floating-point values, which has
+ * to fill the rest of the stream.
+ *
+ * \tparam T Type of the vector elements.
+ * \param[in] stream Input stream.
+ * \param[in] n Expected number of values.
+ * \return Read values, or an empty vector if the stored size is not \p n or
+ *         the stream does not hold exactly that many values.
+ */
+template <typename T = double>
+static std::vector<T> sread_vector(std::ifstream& stream, size_t n) {
+  std::vector<T> x;
+  if (sread_size(stream) != n || remaining_bytes(stream) != sizeof(T) * n) {
+    return x;
+  }
   x.resize(n);
-  stream.read(reinterpret_cast<char*>(x.data()), sizeof(double) * n);
+  stream.read(reinterpret_cast<char*>(x.data()), sizeof(T) * n);
+  if (!stream) {
+    x.clear();
+  }
   return x;
 }
 
@@ -173,8 +207,203 @@ Tabulation Tabulation::from_file(std::ifstream& stream, sha256::Hash hash) {
   t.x_min_ = sread_double(stream);
   t.x_max_ = sread_double(stream);
   t.inv_dx_ = sread_double(stream);
-  t.values_ = sread_vector(stream);
+  // the number of intervals follows from the domain and the step size
+  const double num = std::round((t.x_max_ - t.x_min_) * t.inv_dx_);
+  const size_t max_values = remaining_bytes(stream) / sizeof(double);
+  if (!(num >= 2. && num < max_values)) {
+    return Tabulation();
+  }
+  t.values_ = sread_vector(stream, static_cast<size_t>(num) + 1);
+  return t;
+}
+
+template <typename T>
+BasicGridTabulation<T>::BasicGridTabulation(
+    const Axis& x, const Axis& y, std::function<double(double, double)> f)
+    : dims_(2), min_{}, max_{}, inv_d_{}, n_{{1, 1, 1}} {
+  set_axis(0, x);
+  set_axis(1, y);
+  values_.resize(n_[0] * n_[1]);
+  for (size_t i = 0; i < n_[0]; i++) {
+    const double xi = x.min + i / inv_d_[0];
+    for (size_t j = 0; j < n_[1]; j++) {
+      values_[i * n_[1] + j] = static_cast<T>(f(xi, y.min + j / inv_d_[1]));
+    }
+  }
+}
+
+template <typename T>
+BasicGridTabulation<T>::BasicGridTabulation(
+    const Axis& x, const Axis& y, const Axis& z,
+    std::function<double(double, double, double)> f)
+    : dims_(3), min_{}, max_{}, inv_d_{}, n_{{1, 1, 1}} {
+  set_axis(0, x);
+  set_axis(1, y);
+  set_axis(2, z);
+  values_.resize(n_[0] * n_[1] * n_[2]);
+  for (size_t i = 0; i < n_[0]; i++) {
+    const double xi = x.min + i / inv_d_[0];
+    for (size_t j = 0; j < n_[1]; j++) {
+      const double yj = y.min + j / inv_d_[1];
+      for (size_t k = 0; k < n_[2]; k++) {
+        const double zk = z.min + k / inv_d_[2];
+        values_[(i * n_[1] + j) * n_[2] + k] = static_cast<T>(f(xi, yj, zk));
+      }
+    }
+  }
+}
+
+template <typename T>
+void BasicGridTabulation<T>::set_axis(size_t axis, const Axis& a) {
+  if (a.num < 2 || !(a.max > a.min)) {
+    throw std::runtime_error("GridTabulation needs at least two intervals");
+  }
+  min_[axis] = a.min;
+  max_[axis] = a.max;
+  inv_d_[axis] = a.num / (a.max - a.min);
+  n_[axis] = a.num + 1;
+}
+
+template <typename T>
+size_t BasicGridTabulation<T>::locate(size_t axis, double x, double& r) const {
+  x = std::min(std::max(x, min_[axis]), max_[axis]);
+  const double index_double = (x - min_[axis]) * inv_d_[axis];
+  // here n is the lower index
+  const size_t n =
+      std::min(static_cast<size_t>(index_double), n_[axis] - 2);
+  r = index_double - n;
+  return n;
+}
+
+template <typename T>
+double BasicGridTabulation<T>::get_value_linear(double x, double y) const {
+  assert(dims_ == 2);
+  double rx, ry;
+  const size_t i = locate(0, x, rx);
+  const size_t j = locate(1, y, ry);
+  const T* v0 = &values_[i * n_[1] + j];
+  const T* v1 = v0 + n_[1];
+  const double a = v0[0] + (static_cast<double>(v0[1]) - v0[0]) * ry;
+  const double b = v1[0] + (static_cast<double>(v1[1]) - v1[0]) * ry;
+  return a + (b - a) * rx;
+}
+
+template <typename T>
+double BasicGridTabulation<T>::get_value_linear(double x, double y,
+                                                double z) const {
+  assert(dims_ == 3);
+  double rx, ry, rz;
+  const size_t i = locate(0, x, rx);
+  const size_t j = locate(1, y, ry);
+  const size_t k = locate(2, z, rz);
+  const size_t stride_y = n_[2];
+  const size_t stride_x = n_[1] * n_[2];
+  const T* v = &values_[(i * n_[1] + j) * n_[2] + k];
+  auto lerp_z = [rz](const T* w) {
+    return w[0] + (static_cast<double>(w[1]) - w[0]) * rz;
+  };
+  const double c00 = lerp_z(v);
+  const double c01 = lerp_z(v + stride_y);
+  const double c10 = lerp_z(v + stride_x);
+  const double c11 = lerp_z(v + stride_x + stride_y);
+  const double c0 = c00 + (c01 - c00) * ry;
+  const double c1 = c10 + (c11 - c10) * ry;
+  return c0 + (c1 - c0) * rx;
+}
+
+template <typename T>
+void BasicGridTabulation<T>::write(std::ofstream& stream,
+                                   sha256::Hash hash) const {
+  swrite(stream, hash);
+  swrite(stream, dims_);
+  for (size_t axis = 0; axis < dims_; axis++) {
+    swrite(stream, min_[axis]);
+    swrite(stream, max_[axis]);
+    swrite(stream, n_[axis]);
+  }
+  swrite(stream, values_);
+}
+
+template <typename T>
+BasicGridTabulation<T> BasicGridTabulation<T>::from_file(std::ifstream& stream,
+                                                         sha256::Hash hash) {
+  sha256::Hash hash_from_stream = sread_hash(stream);
+  BasicGridTabulation t;
+  if (hash != hash_from_stream) {
+    return t;
+  }
+  const size_t dims = sread_size(stream);
+  if (dims < 2 || dims > 3) {
+    return t;
+  }
+  t.n_ = {{1, 1, 1}};
+  const size_t max_values = remaining_bytes(stream) / sizeof(T);
+  size_t n_values = 1;
+  for (size_t axis = 0; axis < dims; axis++) {
+    const double min = sread_double(stream);
+    const double max = sread_double(stream);
+    const size_t n = sread_size(stream);
+    // an axis needs at least two intervals and all values have to fit
+    if (!stream || n < 3 || !(max > min) || n > max_values / n_values) {
+      return BasicGridTabulation();
+    }
+    n_values *= n;
+    t.set_axis(axis, {min, max, n - 1});
+  }
+  t.values_ = sread_vector<T>(stream, n_values);
+  if (t.values_.empty()) {
+    return BasicGridTabulation();
+  }
+  t.dims_ = dims;
   return t;
 }
 
+template class BasicGridTabulation<double>;
+template class BasicGridTabulation<float>;
+
+template <typename T>
+T cache_tabulation(const bf::path& dir, const std::string& file_name,
+                   sha256::Hash hash, const std::function<T()>& create,
+                   bool* created) {
+  const auto path = dir / file_name;
+  T tab;
+  if (!dir.empty() && bf::exists(path)) {
+    std::ifstream file(path.string(), std::ios::binary);
+    try {
+      tab = T::from_file(file, hash);
+    } catch (const std::runtime_error&) {
+      // A corrupt tabulation is created again and overwritten.
+      tab = T();
+    }
+    if (!tab.is_empty()) {
+      // Only print message if the found tabulation was valid.
+      std::cout << "Tabulation found at " << path.filename() << '\r'
+                << std::flush;
+    }
+  }
+  if (tab.is_empty()) {
+    if (!dir.empty()) {
+      std::cout << "Caching tabulation to " << path.filename() << '\r'
+                << std::flush;
+    }
+    tab = create();
+    if (created) {
+      *created = true;
+    }
+    if (!dir.empty()) {
+      std::ofstream file(path.string(), std::ios::binary);
+      tab.write(file, hash);
+    }
+  }
+  return tab;
+}
+
+template Tabulation cache_tabulation(const bf::path&, const std::string&,
+                                     sha256::Hash,
+                                     const std::function<Tabulation()>&,
+                                     bool*);
+template GridTabulation cache_tabulation(
+    const bf::path&, const std::string&, sha256::Hash,
+    const std::function<GridTabulation()>&, bool*);
+
 }  // namespace smash
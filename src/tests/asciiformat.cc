@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/asciiformat.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../include/smash/random.h"
+
+using namespace smash;
+
+/// \return The number as written by format_general
+static std::string general(double x, int precision) {
+  char buffer[max_general_length];
+  return std::string(buffer, format_general(buffer, x, precision));
+}
+
+/// \return The number as written by printf
+static std::string printf_general(double x, int precision) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "%.*g", precision, x);
+  return buffer;
+}
+
+/// \return Everything written to a file
+static std::string contents(std::FILE *file) {
+  std::rewind(file);
+  std::string s;
+  char buffer[4096];
+  std::size_t n;
+  while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    s.append(buffer, n);
+  }
+  return s;
+}
+
+TEST(special_values) {
+  const double values[] = {0.,
+                           -0.,
+                           1.,
+                           -1.,
+                           0.5,
+                           2.5,
+                           0.15,
+                           1e-4,
+                           9.99999e-5,
+                           0.000099999951,
+                           123456.5,
+                           999999.5,
+                           9999995.,
+                           1e9,
+                           1e22,
+                           1e23,
+                           1e-22,
+                           1e100,
+                           -1.5e-300,
+                           std::numeric_limits<double>::denorm_min(),
+                           std::numeric_limits<double>::min(),
+                           std::numeric_limits<double>::max(),
+                           std::numeric_limits<double>::infinity(),
+                           -std::numeric_limits<double>::infinity(),
+                           std::numeric_limits<double>::quiet_NaN()};
+  for (double x : values) {
+    for (int precision = 1; precision <= 9; precision++) {
+      COMPARE(general(x, precision), printf_general(x, precision)) << x;
+    }
+  }
+}
+
+TEST(random_values) {
+  for (int i = 0; i < 200000; i++) {
+    // Numbers of all magnitudes, which appear in the output
+    const double x = random::uniform(-1., 1.) *
+                     std::pow(10., random::uniform_int(-30, 30));
+    COMPARE(general(x, 6), printf_general(x, 6)) << x;
+    COMPARE(general(x, 9), printf_general(x, 9)) << x;
+    // Numbers with few digits, which are often close to halfway cases
+    const double y = random::uniform_int(-100000, 100000) * 0.0005;
+    COMPARE(general(y, 3), printf_general(y, 3)) << y;
+  }
+}
+
+TEST(random_bits) {
+  for (int i = 0; i < 200000; i++) {
+    const std::uint64_t bits =
+        (static_cast<std::uint64_t>(random::uniform_int(0, 0x7fffffff)) << 33) ^
+        (static_cast<std::uint64_t>(random::uniform_int(0, 0x7fffffff)) << 2);
+    double x;
+    std::memcpy(&x, &bits, sizeof(x));
+    COMPARE(general(x, 6), printf_general(x, 6)) << x;
+    COMPARE(general(-x, 9), printf_general(-x, 9)) << x;
+  }
+}
+
+TEST(integers) {
+  const int values[] = {0,
+                        1,
+                        -1,
+                        9,
+                        10,
+                        -2212,
+                        123456789,
+                        std::numeric_limits<int>::max(),
+                        std::numeric_limits<int>::min()};
+  for (int x : values) {
+    char buffer[11];
+    COMPARE(std::string(buffer, format_int(buffer, x)), std::to_string(x));
+  }
+}
+
+TEST(line) {
+  std::FILE *file = std::tmpfile();
+  VERIFY(file != nullptr);
+  AsciiLine line;
+  line.general(0.1).general(-2.5e-7, 9).string("2212").integer(-3);
+  line.write(file);
+  line.integer(7);
+  line.write(file);
+  COMPARE(contents(file), "0.1 -2.5e-07 2212 -3\n7\n");
+  std::fclose(file);
+}
+
+TEST_CATCH(line_too_long, std::length_error) {
+  const std::string s(1000, 'x');
+  AsciiLine line;
+  line.string(s.c_str());
+}
+
+/* Particle lines of the OSCAR2013 output, written to a file, are the same
+ * as with printf. */
+TEST(file_output_like_printf) {
+  constexpr int n = 10000;
+  std::vector<double> values(9 * n);
+  for (double &x : values) {
+    x = random::uniform(-10., 10.);
+  }
+  std::FILE *file_printf = std::tmpfile();
+  std::FILE *file_line = std::tmpfile();
+  VERIFY(file_printf != nullptr && file_line != nullptr);
+  for (int i = 0; i < n; i++) {
+    const double *v = &values[9 * i];
+    std::fprintf(file_printf, "%g %g %g %g %g %.9g %.9g %.9g %.9g %s %i %i\n",
+                 v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], "211",
+                 i, 1);
+  }
+  std::fflush(file_printf);
+  AsciiLine line;
+  for (int i = 0; i < n; i++) {
+    const double *v = &values[9 * i];
+    line.general(v[0])
+        .general(v[1])
+        .general(v[2])
+        .general(v[3])
+        .general(v[4])
+        .general(v[5], 9)
+        .general(v[6], 9)
+        .general(v[7], 9)
+        .general(v[8], 9)
+        .string("211")
+        .integer(i)
+        .integer(1);
+    line.write(file_line);
+  }
+  std::fflush(file_line);
+  VERIFY(contents(file_line) == contents(file_printf));
+  std::fclose(file_printf);
+  std::fclose(file_line);
+}
@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../include/smash/asciiformat.h"
+#include "../include/smash/random.h"
+
+// Compares the throughput of printf and AsciiLine for the particle lines of
+// the OSCAR2013 output. Usage: asciiformat_benchmark [number of lines]
+
+using namespace smash;
+
+/// \return Everything written to a file
+static std::string contents(std::FILE *file) {
+  std::string result;
+  std::rewind(file);
+  char buffer[4096];
+  std::size_t n;
+  while ((n = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    result.append(buffer, n);
+  }
+  return result;
+}
+
+int main(int argc, char **argv) {
+  const int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+  std::vector<double> values(9 * n);
+  for (double &x : values) {
+    x = random::uniform(-10., 10.);
+  }
+  std::FILE *file_printf = std::tmpfile();
+  std::FILE *file_line = std::tmpfile();
+  if (file_printf == nullptr || file_line == nullptr) {
+    std::fprintf(stderr, "Cannot open temporary files.\n");
+    return 1;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; i++) {
+    const double *v = &values[9 * i];
+    std::fprintf(file_printf, "%g %g %g %g %g %.9g %.9g %.9g %.9g %s %i %i\n",
+                 v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], "211",
+                 i, 1);
+  }
+  std::fflush(file_printf);
+  const auto middle = std::chrono::steady_clock::now();
+  AsciiLine line;
+  for (int i = 0; i < n; i++) {
+    const double *v = &values[9 * i];
+    line.general(v[0])
+        .general(v[1])
+        .general(v[2])
+        .general(v[3])
+        .general(v[4])
+        .general(v[5], 9)
+        .general(v[6], 9)
+        .general(v[7], 9)
+        .general(v[8], 9)
+        .string("211")
+        .integer(i)
+        .integer(1);
+    line.write(file_line);
+  }
+  std::fflush(file_line);
+  const auto end = std::chrono::steady_clock::now();
+
+  const std::string expected = contents(file_printf);
+  const bool identical = contents(file_line) == expected;
+  std::fclose(file_printf);
+  std::fclose(file_line);
+
+  const double megabytes = expected.size() * 1e-6;
+  const double t_printf = std::chrono::duration<double>(middle - start).count();
+  const double t_line = std::chrono::duration<double>(end - middle).count();
+  std::printf("%d lines, %.1f MB\n", n, megabytes);
+  std::printf("printf:    %8.1f MB/s\n", megabytes / t_printf);
+  std::printf("AsciiLine: %8.1f MB/s (%.2f times printf)\n",
+              megabytes / t_line, t_printf / t_line);
+  if (!identical) {
+    std::fprintf(stderr, "The outputs differ.\n");
+    return 1;
+  }
+  return 0;
+}
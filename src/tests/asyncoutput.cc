@@ -0,0 +1,170 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/asyncoutput.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/smash/clock.h"
+#include "../include/smash/scatteraction.h"
+#include "setup.h"
+
+using namespace smash;
+
+namespace {
+/// Output which records what it is asked to write
+class RecordingOutput : public OutputInterface {
+ public:
+  explicit RecordingOutput(std::vector<std::string> *log)
+      : OutputInterface("Photons"), log_(log) {}
+
+  void at_eventstart(const Particles &particles, const int event_number,
+                     const EventInfo &) override {
+    log_->push_back("start " + std::to_string(event_number) + " " +
+                    std::to_string(particles.size()));
+  }
+
+  void at_eventend(const Particles &particles, const int event_number,
+                   const EventInfo &) override {
+    log_->push_back("end " + std::to_string(event_number) + " " +
+                    std::to_string(particles.size()));
+  }
+
+  void at_interaction(const Action &action, const double) override {
+    log_->push_back("interaction " +
+                    std::to_string(action.incoming_particles()[0].id()) + " " +
+                    std::to_string(action.get_interaction_point().x0()));
+  }
+
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override {
+    log_->push_back("dileptons " + std::to_string(decays.size()) + " " +
+                    std::to_string(decays.front().parent.id()));
+  }
+
+  void at_intermediate_time(const Particles &particles,
+                            const std::unique_ptr<Clock> &clock,
+                            const DensityParameters &,
+                            const EventInfo &) override {
+    log_->push_back("time " + std::to_string(clock->current_time()) + " " +
+                    std::to_string(particles.front().id()));
+  }
+
+ private:
+  std::vector<std::string> *log_;
+};
+}  // unnamed namespace
+
+TEST(init_particletypes) { Test::create_smashon_particletypes(); }
+
+TEST(clone_particles) {
+  Particles particles;
+  particles.insert(Test::smashon_random());
+  const ParticleData second = particles.insert(Test::smashon_random());
+  particles.insert(Test::smashon_random());
+  particles.remove(second);
+  const std::unique_ptr<Particles> copy = particles.clone();
+  COMPARE(copy->size(), 2u);
+  auto it = copy->begin();
+  for (const ParticleData &p : particles) {
+    COMPARE(it->id(), p.id());
+    COMPARE(it->position(), p.position());
+    VERIFY(copy->is_valid(p));
+    ++it;
+  }
+  // The copy is independent of the original.
+  particles.remove(particles.front());
+  COMPARE(copy->size(), 2u);
+  COMPARE(copy->insert(Test::smashon_random()).id(), 3);
+}
+
+TEST(ordered_snapshots) {
+  std::vector<std::string> log;
+  auto writer = std::make_shared<OutputWriterThread>(2);
+  AsyncOutput output(make_unique<RecordingOutput>(&log), writer);
+  VERIFY(output.is_photon_output());
+
+  Particles particles;
+  const ParticleData p1 = particles.insert(Test::smashon_random());
+  const ParticleData p2 = particles.insert(Test::smashon_random());
+  const EventInfo event = Test::default_event_info();
+  const DensityParameters dens_par(Test::default_parameters());
+  output.at_eventstart(particles, 4, event);
+
+  auto action = make_unique<ScatterAction>(p1, p2, 0.5);
+  const double t_interaction = action->get_interaction_point().x0();
+  output.at_interaction(*action, 0.);
+  // The original action may be gone before it is written.
+  action.reset();
+
+  std::unique_ptr<Clock> clock = make_unique<UniformClock>(1., 0.1);
+  output.at_intermediate_time(particles, clock, dens_par, event);
+  // Neither the particles nor the clock may change what is written.
+  ++*clock;
+  particles.remove(p1);
+  output.at_eventend(particles, 4, event);
+
+  // All earlier calls are written at the end of the event.
+  COMPARE(log.size(), 4u);
+  COMPARE(log[0], "start 4 2");
+  COMPARE(log[1], "interaction 0 " + std::to_string(t_interaction));
+  COMPARE(log[2], "time " + std::to_string(1.) + " 0");
+  COMPARE(log[3], "end 4 1");
+}
+
+TEST(dilepton_decays) {
+  std::vector<std::string> log;
+  auto writer = std::make_shared<OutputWriterThread>(2);
+  AsyncOutput output(make_unique<RecordingOutput>(&log), writer);
+
+  Particles particles;
+  const ParticleData p = particles.insert(Test::smashon_random());
+  std::vector<DileptonDecay> decays = {
+      {p, {Test::smashon_random(), Test::smashon_random()}, 0.1, 0.2},
+      {p, {Test::smashon_random(), Test::smashon_random()}, 0.3, 0.4}};
+  output.at_dilepton_decays(decays);
+  // The decays are copied, such that the finder may reuse its list.
+  decays.clear();
+  output.at_eventend(particles, 0, Test::default_event_info());
+
+  COMPARE(log.size(), 2u);
+  COMPARE(log[0], "dileptons 2 0");
+  COMPARE(log[1], "end 0 1");
+}
+
+TEST(backpressure) {
+  std::atomic<int> done(0);
+  {
+    OutputWriterThread writer(1);
+    for (int i = 0; i < 5; i++) {
+      writer.push([&done] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        done++;
+      });
+      // There is at most one pending task next to the running one.
+      VERIFY(done >= i - 1);
+    }
+    writer.flush();
+    COMPARE(done.load(), 5);
+  }
+}
+
+TEST_CATCH(rethrow_error, std::runtime_error) {
+  OutputWriterThread writer(4);
+  writer.push([] { throw std::runtime_error("disk full"); });
+  writer.flush();
+}
+
+TEST_CATCH(zero_capacity, std::invalid_argument) { OutputWriterThread(0); }
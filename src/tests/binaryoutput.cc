@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "../include/smash/asyncoutput.h"
 #include "../include/smash/binaryoutput.h"
 #include "../include/smash/clock.h"
 #include "../include/smash/file.h"
@@ -445,6 +446,57 @@ TEST(extended) {
   VERIFY(bf::remove(collisionsoutputfilepath));
 }
 
+TEST(dilepton_decays_format) {
+  const ParticleData parent = Test::smashon_random(1);
+  std::vector<DileptonDecay> decays;
+  decays.push_back({parent,
+                    {Test::smashon_random(2), Test::smashon_random(3)},
+                    1.2e-5,
+                    0.011});
+  decays.push_back({parent,
+                    {Test::smashon_random(4), Test::smashon_random(5),
+                     Test::smashon_random(6)},
+                    3.4e-6,
+                    0.0022});
+
+  const bf::path dileptonoutputpath = testoutputpath / "Dileptons.bin";
+  {
+    OutputParameters output_par = OutputParameters();
+    output_par.coll_extended = false;
+    BinaryOutputCollisions bin_output(testoutputpath, "Dileptons", output_par);
+    bin_output.at_dilepton_decays(decays);
+  }
+  VERIFY(bf::exists(dileptonoutputpath));
+
+  {
+    FilePtr binF = fopen(dileptonoutputpath.native(), "rb");
+    VERIFY(binF.get());
+    // Header
+    std::vector<char> buf(4);
+    std::string magic, smash_version;
+    int format_version_number;
+
+    COMPARE(std::fread(&buf[0], 1, 4, binF.get()), 4u);  // magic number
+    magic.assign(&buf[0], 4);
+    read_binary(format_version_number, binF);  // format version number
+    read_binary(smash_version, binF);          // smash version
+    COMPARE(magic, "SMSH");
+
+    // every decay is written like a decay action at zero density
+    for (const DileptonDecay &decay : decays) {
+      const RecordedAction action(decay);
+      VERIFY(compare_interaction_block_header(1, decay.products.size(), action,
+                                              0., binF));
+      VERIFY(compare_particle(parent, binF));
+      for (const ParticleData &p : decay.products) {
+        VERIFY(compare_particle(p, binF));
+      }
+    }
+    VERIFY(check_end_of_file(binF));
+  }
+  VERIFY(bf::remove(dileptonoutputpath));
+}
+
 TEST(initial_conditions_format) {
   // Create 1 particle
   Particles particles;
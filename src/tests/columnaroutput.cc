@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "setup.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "../include/smash/columnarfile.h"
+#include "../include/smash/columnaroutput.h"
+#include "../include/smash/particles.h"
+
+using namespace smash;
+
+static const bf::path testoutputpath = bf::absolute(SMASH_TEST_OUTPUT_PATH);
+static const bf::path columnar_path = testoutputpath / "particles_columnar.bin";
+
+TEST(directory_is_created) {
+  bf::create_directories(testoutputpath);
+  VERIFY(bf::exists(testoutputpath));
+}
+
+TEST(init_particletypes) { Test::create_smashon_particletypes(); }
+
+TEST(write_and_read_events) {
+  const std::vector<int> n_particles = {3, 0, 5};
+  std::vector<ParticleList> written;
+  {
+    ColumnarOutput output(testoutputpath, "Particles", OutputParameters());
+    VERIFY(bf::exists(columnar_path.native() + ".unfinished"));
+    for (std::size_t event = 0; event < n_particles.size(); event++) {
+      Particles particles;
+      for (int i = 0; i < n_particles[event]; i++) {
+        ParticleData p = Test::smashon_random();
+        p.set_history(2, event, ProcessType::Elastic, 1.5, {});
+        particles.insert(p);
+      }
+      written.push_back(particles.copy_to_vector());
+      output.at_eventend(particles, event,
+                         Test::default_event_info(0.5 * event, event == 1));
+    }
+  }
+  VERIFY(bf::exists(columnar_path));
+
+  const ColumnarFileReader file(columnar_path);
+  COMPARE(file.n_events(), n_particles.size());
+  for (std::size_t event = 0; event < n_particles.size(); event++) {
+    const ColumnarEventInfo &info = file.event(event);
+    COMPARE(info.n_particles, written[event].size());
+    COMPARE(info.event_number, static_cast<int>(event));
+    COMPARE(info.empty_event, event == 1 ? 1 : 0);
+    COMPARE(info.impact_parameter, 0.5 * event);
+    const auto r = file.double_column(event, ColumnarColumn::Position);
+    const auto p = file.double_column(event, ColumnarColumn::Momentum);
+    const auto mass = file.double_column(event, ColumnarColumn::Mass);
+    const auto pdg = file.int_column(event, ColumnarColumn::Pdg);
+    const auto id = file.int_column(event, ColumnarColumn::Id);
+    const auto process = file.int_column(event, ColumnarColumn::IdProcess);
+    const auto t_last =
+        file.double_column(event, ColumnarColumn::TimeLastCollision);
+    COMPARE(r.size(), 4 * written[event].size());
+    COMPARE(pdg.size(), written[event].size());
+    for (std::size_t i = 0; i < pdg.size(); i++) {
+      const ParticleData &expected = written[event][i];
+      for (int k = 0; k < 4; k++) {
+        COMPARE(r[4 * i + k], expected.position()[k]);
+        COMPARE(p[4 * i + k], expected.momentum()[k]);
+      }
+      COMPARE(mass[i], expected.effective_mass());
+      COMPARE(pdg[i], expected.pdgcode().get_decimal());
+      COMPARE(id[i], expected.id());
+      COMPARE(process[i], static_cast<int>(event));
+      COMPARE(t_last[i], 1.5);
+    }
+  }
+}
+
+TEST_CATCH(wrong_column_type, std::invalid_argument) {
+  const ColumnarFileReader file(columnar_path);
+  file.int_column(0, ColumnarColumn::Mass);
+}
+
+TEST_CATCH(no_such_event, std::out_of_range) {
+  const ColumnarFileReader file(columnar_path);
+  file.double_column(3, ColumnarColumn::Mass);
+}
+
+TEST_CATCH(unfinished_file, std::runtime_error) {
+  const bf::path path = testoutputpath / "unfinished_columnar.bin";
+  {
+    ColumnarOutput output(testoutputpath, "Particles", OutputParameters());
+    Particles particles;
+    particles.insert(Test::smashon_random());
+    output.at_eventend(particles, 0, Test::default_event_info());
+    std::fflush(nullptr);
+    // Copy the file before the index is written
+    bf::copy_file(columnar_path.native() + ".unfinished", path,
+                  bf::copy_option::overwrite_if_exists);
+  }
+  const ColumnarFileReader file(path);
+}
+
+TEST_CATCH(overflowing_event_index, std::runtime_error) {
+  const bf::path path = testoutputpath / "overflowing_columnar.bin";
+  bf::copy_file(columnar_path, path, bf::copy_option::overwrite_if_exists);
+  {
+    std::fstream file(path.native(),
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekg(-24, std::ios::end);
+    std::uint64_t index_offset;
+    file.read(reinterpret_cast<char *>(&index_offset), 8);
+    /* So many particles in the first event that the end of the event wraps
+     * around to a position within the file. */
+    const std::uint64_t n_particles = std::uint64_t(1) << 61;
+    file.seekp(index_offset + 8);
+    file.write(reinterpret_cast<const char *>(&n_particles), 8);
+  }
+  const ColumnarFileReader file(path);
+}
@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "setup.h"
+
+#include <cstdio>
+#include <istream>
+#include <string>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "../include/smash/compression.h"
+#include "../include/smash/file.h"
+
+using namespace smash;
+
+static const bf::path testoutputpath = bf::absolute(SMASH_TEST_OUTPUT_PATH);
+
+TEST(directory_is_created) {
+  bf::create_directories(testoutputpath);
+  VERIFY(bf::exists(testoutputpath));
+}
+
+TEST(no_compression) { VERIFY(!create_compression_codec("None")); }
+
+TEST_CATCH(unknown_compression, std::invalid_argument) {
+  create_compression_codec("Zip");
+}
+
+TEST(uncompressed_file_is_not_detected) {
+  const bf::path path = testoutputpath / "uncompressed.txt";
+  {
+    RenamingFilePtr file(path, "w");
+    std::fprintf(file.get(), "# event 0 end\n");
+  }
+  VERIFY(!detect_compression_codec(path));
+}
+
+#ifdef SMASH_USE_ZLIB
+TEST(frames_are_independent) {
+  const auto codec = create_compression_codec("Zlib");
+  const std::string first = "# event 0 end\n";
+  const std::string second(100000, 'x');
+  std::string compressed;
+  codec->compress(first.data(), first.size(), compressed);
+  const std::size_t first_size = compressed.size();
+  codec->compress(second.data(), second.size(), compressed);
+
+  std::string out;
+  COMPARE(codec->decompress_frame(compressed.data(), compressed.size(), out),
+          first_size);
+  COMPARE(out, first);
+  // The second frame is decompressed without the first one
+  out.clear();
+  COMPARE(codec->decompress_frame(compressed.data() + first_size,
+                                  compressed.size() - first_size, out),
+          compressed.size() - first_size);
+  COMPARE(out, second);
+}
+
+TEST_CATCH(incomplete_frame, std::runtime_error) {
+  const auto codec = create_compression_codec("Zlib");
+  const std::string data = "0 0 0 0 0.138 0.138 0 0 0 111 0 0\n";
+  std::string compressed;
+  codec->compress(data.data(), data.size(), compressed);
+  std::string out;
+  codec->decompress_frame(compressed.data(), compressed.size() - 4, out);
+}
+
+TEST(compressed_file) {
+  const bf::path path = testoutputpath / "compressed.txt";
+  std::string expected;
+  {
+    RenamingFilePtr file(path, "w", create_compression_codec("Zlib"));
+    VERIFY(bf::exists(path.native() + ".gz.unfinished"));
+    for (int event = 0; event < 3; event++) {
+      for (int i = 0; i < 1000; i++) {
+        std::fprintf(file.get(), "%d %d\n", event, i);
+        expected += std::to_string(event) + ' ' + std::to_string(i) + '\n';
+      }
+      file.flush();
+    }
+    // The last frame is written when the file is closed
+    std::fprintf(file.get(), "# end\n");
+    expected += "# end\n";
+  }
+  const bf::path compressed_path = path.native() + ".gz";
+  VERIFY(bf::exists(compressed_path));
+  const auto codec = detect_compression_codec(compressed_path);
+  VERIFY(bool(codec));
+  COMPARE(decompress_file(compressed_path, *codec), expected);
+
+  // One frame per flush
+  bf::ifstream file{compressed_path, std::ios::binary};
+  const std::string compressed{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+  std::size_t done = 0;
+  int n_frames = 0;
+  std::string out;
+  while (done < compressed.size()) {
+    done += codec->decompress_frame(compressed.data() + done,
+                                    compressed.size() - done, out);
+    n_frames++;
+  }
+  COMPARE(n_frames, 4);
+}
+
+TEST(large_frames_are_split) {
+  const bf::path path = testoutputpath / "split.txt.gz";
+  const std::string line(99, 'x');
+  std::string expected;
+  {
+    FilePtr target = smash::fopen(path, "w");
+    /* A small maximal frame size, which is reached many times without
+     * end_frame(), although the collecting file passes the lines on in
+     * larger blocks */
+    FrameCompressor compressor(target.get(), create_compression_codec("Zlib"),
+                               1000);
+    for (int i = 0; i < 1000; i++) {
+      std::fprintf(compressor.get(), "%s\n", line.c_str());
+      expected += line + '\n';
+    }
+  }
+  const auto codec = create_compression_codec("Zlib");
+  bf::ifstream file{path, std::ios::binary};
+  int n_frames = 0;
+  std::string out;
+  while (codec->decompress_frame(file, out)) {
+    n_frames++;
+  }
+  COMPARE(out, expected);
+  VERIFY(n_frames >= 4);
+}
+
+TEST(stream_of_frames) {
+  const bf::path path = testoutputpath / "streamed.txt";
+  std::string expected;
+  {
+    RenamingFilePtr file(path, "w", create_compression_codec("Zlib"));
+    for (int event = 0; event < 3; event++) {
+      for (int i = 0; i < 1000; i++) {
+        std::fprintf(file.get(), "%d %d\n", event, i);
+        expected += std::to_string(event) + ' ' + std::to_string(i) + '\n';
+      }
+      file.flush();
+    }
+  }
+  FrameDecompressor buffer(path.native() + ".gz",
+                           create_compression_codec("Zlib"));
+  std::istream stream(&buffer);
+  const std::string all{std::istreambuf_iterator<char>(stream),
+                        std::istreambuf_iterator<char>()};
+  COMPARE(all, expected);
+  // Seek forward into the last frame, then back to the first one
+  const std::size_t last_event = expected.find("2 0\n");
+  stream.clear();
+  stream.seekg(last_event);
+  std::string line;
+  std::getline(stream, line);
+  COMPARE(line, "2 0");
+  COMPARE(static_cast<std::size_t>(stream.tellg()), last_event + 4);
+  stream.seekg(2);
+  std::getline(stream, line);
+  COMPARE(line, "0");
+  std::getline(stream, line);
+  COMPARE(line, "0 1");
+}
+#else
+TEST_CATCH(zlib_is_not_available, std::runtime_error) {
+  create_compression_codec("Zlib");
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/coulombsolver.h"
+
+#include <cmath>
+
+#include "../include/smash/potentials.h"
+
+using namespace smash;
+
+using FieldLattice = RectangularLattice<std::pair<ThreeVector, ThreeVector>>;
+
+namespace {
+/// Fill the lattice with an arbitrary, but reproducible 4-current
+void fill_charges(DensityLattice *lat) {
+  for (size_t i = 0; i < lat->size(); i++) {
+    const double x = static_cast<double>(i);
+    const FourVector j(2. + std::sin(0.7 * x), 0.5 * std::cos(1.3 * x),
+                       0.4 * std::sin(2.1 * x + 1.), 0.3 * std::cos(0.4 * x));
+    if (i % 3 == 0) {
+      (*lat)[i].add_to_jmu_neg(j * (-1.));
+    } else {
+      (*lat)[i].add_to_jmu_pos(j);
+    }
+  }
+}
+
+/**
+ * Compare the fields from the Fourier transforms to the direct sums over the
+ * lattice. The cutoff is no integer multiple of the spacings, such that both
+ * cover the same cells.
+ */
+void compare_to_direct_sum(const std::array<int, 3> &n, bool periodic) {
+  const std::array<double, 3> l = {1.0 * n[0], 1.1 * n[1], 0.9 * n[2]};
+  const std::array<double, 3> origin = {-2., -1., -3.};
+  const double r_cut = 2.5;
+  DensityLattice jmu_el(l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+  fill_charges(&jmu_el);
+  FieldLattice em_lat(l, n, origin, periodic, LatticeUpdate::EveryTimestep);
+
+  CoulombFieldSolver solver(n, jmu_el.cell_sizes(), periodic, r_cut);
+  for (int n_threads : {1, 3}) {
+    solver.compute_fields(jmu_el, em_lat, n_threads);
+    for (size_t i = 0; i < jmu_el.size(); i++) {
+      const ThreeVector position = jmu_el.cell_center(i);
+      ThreeVector electric_field = {0., 0., 0.};
+      jmu_el.integrate_volume(electric_field, Potentials::E_field_integrand,
+                              r_cut, position);
+      ThreeVector magnetic_field = {0., 0., 0.};
+      jmu_el.integrate_volume(magnetic_field, Potentials::B_field_integrand,
+                              r_cut, position);
+      for (int dir = 0; dir < 3; dir++) {
+        COMPARE_ABSOLUTE_ERROR(em_lat[i].first[dir], electric_field[dir],
+                               1e-12)
+            << "node " << i << ", threads " << n_threads;
+        COMPARE_ABSOLUTE_ERROR(em_lat[i].second[dir], magnetic_field[dir],
+                               1e-12)
+            << "node " << i << ", threads " << n_threads;
+      }
+    }
+  }
+}
+}  // unnamed namespace
+
+TEST(padding) {
+  const CoulombFieldSolver open({9, 8, 1}, {1., 1., 1.}, false, 3.);
+  COMPARE(open.transform_dims(), (std::array<int, 3>{32, 16, 1}));
+  const CoulombFieldSolver closed({9, 8, 1}, {1., 1., 1.}, true, 3.);
+  COMPARE(closed.transform_dims(), (std::array<int, 3>{9, 8, 1}));
+}
+
+TEST(non_periodic) { compare_to_direct_sum({9, 8, 7}, false); }
+
+TEST(periodic) {
+  // The cutoff cube is larger than the lattice in z direction.
+  compare_to_direct_sum({6, 5, 4}, true);
+}
+
+TEST_CATCH(wrong_lattice, std::invalid_argument) {
+  const std::array<double, 3> l = {4., 4., 4.}, origin = {0., 0., 0.};
+  DensityLattice jmu_el(l, {4, 4, 4}, origin, false,
+                        LatticeUpdate::EveryTimestep);
+  FieldLattice em_lat(l, {4, 4, 4}, origin, false,
+                      LatticeUpdate::EveryTimestep);
+  CoulombFieldSolver solver({4, 4, 5}, {1., 1., 1.}, false, 2.);
+  solver.compute_fields(jmu_el, em_lat);
+}
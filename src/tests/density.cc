@@ -23,6 +23,7 @@
 #include "../include/smash/experiment.h"
 #include "../include/smash/modusdefault.h"
 #include "../include/smash/nucleus.h"
+#include "../include/smash/random.h"
 #include "../include/smash/thermodynamicoutput.h"
 
 using namespace smash;
@@ -179,11 +180,240 @@ TEST(smearing_factor_normalization) {
   COMPARE_RELATIVE_ERROR(int_rho_r_d3r, 1.0, 3.e-6);
 }
 
+TEST(covariant_gaussian_deposition) {
+  // a fast proton, such that the smearing is strongly Lorentz contracted
+  ParticleData part = create_proton();
+  part.set_4momentum(0.938, 3.0, -1.5, 0.7);
+  part.set_4position(FourVector(0.0, 0.31, -0.22, 0.45));
+  std::vector<Particles> ensembles(1);
+  ensembles[0].insert(part);
+  const ExperimentParameters par = smash::Test::default_parameters();
+  const DensityParameters dens_par(par);
+  for (bool periodic : {false, true}) {
+    DensityLattice lat({10., 10., 10.}, {21, 23, 25}, {-5., -5., -5.}, periodic,
+                       LatticeUpdate::EveryTimestep);
+    update_lattice(&lat, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                   dens_par, ensembles, true);
+    // compare to the smearing factor evaluated for every node
+    const FourVector p = part.momentum();
+    const ThreeVector u = p.threevec() / p.abs();
+    lat.iterate_sublattice({0, 0, 0}, lat.n_cells(), [&](DensityOnLattice &node,
+                                                         int ix, int iy,
+                                                         int iz) {
+      const ThreeVector r = part.position().threevec() -
+                            lat.cell_center(ix, iy, iz);
+      const double sf = unnormalized_smearing_factor(r, p, 1.0 / p.abs(),
+                                                     dens_par, true)
+                            .first *
+                        dens_par.norm_factor_sf();
+      const FourVector expected = FourVector(1.0, part.velocity()) * sf;
+      for (int mu = 0; mu < 4; mu++) {
+        COMPARE_RELATIVE_ERROR(node.jmu_net()[mu], expected[mu], 1.e-12);
+      }
+      // the Lorentz contracted distance decides about the cut-off
+      const double r_rest_sqr = r.sqr() + (r * u) * (r * u);
+      if (r_rest_sqr > dens_par.r_cut_sqr()) {
+        COMPARE(node.jmu_net().x0(), 0.0);
+      }
+    });
+  }
+}
+
+TEST(parallel_deposition) {
+  const std::array<double, 3> l = {10., 10., 10.};
+  const std::array<int, 3> n = {20, 20, 20};
+  const std::array<double, 3> origin = {-5., -5., -5.};
+  // two ensembles of protons and antiprotons spread over the lattice
+  std::vector<Particles> ensembles(2);
+  for (Particles &particles : ensembles) {
+    for (int i = 0; i < 50; i++) {
+      ParticleData part = i % 5 == 0 ? create_antiproton() : create_proton();
+      part.set_4momentum(0.938, random::uniform(-1., 1.),
+                         random::uniform(-1., 1.), random::uniform(-1., 1.));
+      part.set_4position(FourVector(0., random::uniform(-4., 4.),
+                                    random::uniform(-4., 4.),
+                                    random::uniform(-4., 4.)));
+      particles.insert(part);
+    }
+  }
+  ExperimentParameters par = smash::Test::default_parameters();
+  par.n_ensembles = 2;
+  const DensityParameters serial_par(par);
+  par.lattice_threads = 3;
+  const DensityParameters parallel_par(par);
+
+  DensityLattice serial(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  DensityLattice parallel(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  DensityLattice repeated(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  update_lattice(&serial, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 serial_par, ensembles, true);
+  update_lattice(&parallel, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 parallel_par, ensembles, true);
+  update_lattice(&repeated, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 parallel_par, ensembles, true);
+
+  for (size_t i = 0; i < serial.size(); i++) {
+    // only the order of the summation differs from the serial deposition
+    const FourVector diff = parallel[i].jmu_net() - serial[i].jmu_net();
+    for (int mu = 0; mu < 4; mu++) {
+      COMPARE_ABSOLUTE_ERROR(diff[mu], 0., 1.e-12);
+      const FourVector grad_diff =
+          parallel[i].djmu_dxnu()[mu] - serial[i].djmu_dxnu()[mu];
+      for (int nu = 0; nu < 4; nu++) {
+        COMPARE_ABSOLUTE_ERROR(grad_diff[nu], 0., 1.e-12);
+      }
+    }
+    // the same number of threads reproduces the result exactly
+    COMPARE(repeated[i].jmu_net(), parallel[i].jmu_net());
+    COMPARE(repeated[i].djmu_dxnu()[1], parallel[i].djmu_dxnu()[1]);
+  }
+}
+
+TEST(parallel_deposition_on_compact_nodes) {
+  const std::array<double, 3> l = {10., 10., 10.};
+  const std::array<int, 3> n = {20, 20, 20};
+  const std::array<double, 3> origin = {-5., -5., -5.};
+  std::vector<Particles> ensembles(1);
+  for (int i = 0; i < 60; i++) {
+    ParticleData part = i % 4 == 0 ? create_antiproton() : create_proton();
+    part.set_4momentum(0.938, random::uniform(-1., 1.),
+                       random::uniform(-1., 1.), random::uniform(-1., 1.));
+    part.set_4position(FourVector(0., random::uniform(-4., 4.),
+                                  random::uniform(-4., 4.),
+                                  random::uniform(-4., 4.)));
+    ensembles[0].insert(part);
+  }
+  ExperimentParameters par = smash::Test::default_parameters();
+  const DensityParameters serial_par(par);
+  par.lattice_threads = 3;
+  const DensityParameters parallel_par(par);
+
+  DensityLattice serial(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  DensityLattice parallel(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  update_lattice(&serial, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 serial_par, ensembles, false);
+  update_lattice(&parallel, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 parallel_par, ensembles, false);
+  // without gradients the threads accumulate on nodes with currents only
+  const CurrentOnLattice *compact_nodes =
+      &parallel.scratch_lattices<CurrentOnLattice>(2)[0][0];
+  update_lattice(&parallel, LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                 parallel_par, ensembles, false);
+  COMPARE(&parallel.scratch_lattices<CurrentOnLattice>(2)[0][0],
+          compact_nodes);
+
+  for (size_t i = 0; i < serial.size(); i++) {
+    const FourVector diff = parallel[i].jmu_net() - serial[i].jmu_net();
+    for (int mu = 0; mu < 4; mu++) {
+      COMPARE_ABSOLUTE_ERROR(diff[mu], 0., 1.e-12);
+    }
+    COMPARE_ABSOLUTE_ERROR(parallel[i].rho(), serial[i].rho(), 1.e-12);
+  }
+}
+
 TEST(smearing_factor_rcut_correction) {
   FUZZY_COMPARE(smearing_factor_rcut_correction(3.0), 0.97070911346511177);
   FUZZY_COMPARE(smearing_factor_rcut_correction(4.0), 0.99886601571021467);
 }
 
+TEST(lattice_update_memo) {
+  const std::array<double, 3> l = {4., 4., 4.};
+  const std::array<int, 3> n = {2, 2, 2};
+  const std::array<double, 3> origin = {0., 0., 0.};
+  DensityLattice at_output(l, n, origin, false, LatticeUpdate::AtOutput);
+  DensityLattice every_step(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  const LatticeUpdate upd = LatticeUpdate::AtOutput;
+  LatticeUpdateMemo memo;
+  VERIFY(memo.update_needed(&at_output, upd, DensityType::Baryon, 1.));
+  // Every lattice is updated once per time and density type.
+  VERIFY(!memo.update_needed(&at_output, upd, DensityType::Baryon, 1.));
+  VERIFY(memo.update_needed(&at_output, upd, DensityType::Baryon, 2.));
+  VERIFY(memo.update_needed(&at_output, upd, DensityType::Pion, 2.));
+  // Lattices that are not updated at this occasion are not remembered.
+  VERIFY(!memo.update_needed(&every_step, upd, DensityType::Pion, 2.));
+  VERIFY(memo.update_needed(&every_step, LatticeUpdate::EveryTimestep,
+                            DensityType::Pion, 2.));
+  VERIFY(!memo.update_needed<DensityOnLattice>(nullptr, upd,
+                                               DensityType::Pion, 2.));
+  memo.clear();
+  VERIFY(memo.update_needed(&at_output, upd, DensityType::Pion, 2.));
+}
+
+TEST(auxiliary_lattices_only_for_finite_differences) {
+  const std::array<double, 3> l = {4., 4., 4.};
+  const std::array<int, 3> n = {2, 2, 2};
+  const std::array<double, 3> origin = {0., 0., 0.};
+  DensityLattice lat(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  ParticleData part = create_proton();
+  part.set_4momentum(0.938, ThreeVector());
+  part.set_4position(FourVector(0., 1., 1., 1.));
+  std::vector<Particles> ensembles(1);
+  ensembles[0].insert(part);
+  ExperimentParameters exp_par = smash::Test::default_parameters();
+  // Gaussian derivatives work without the auxiliary lattices.
+  update_lattice(&lat, nullptr, nullptr, nullptr, LatticeUpdate::EveryTimestep,
+                 DensityType::Baryon, DensityParameters(exp_par), ensembles,
+                 0.1, true);
+  VERIFY(lat[0].rho() > 0.);
+  exp_par.derivatives_mode = DerivativesMode::FiniteDifference;
+  bool thrown = false;
+  try {
+    update_lattice(&lat, nullptr, nullptr, nullptr,
+                   LatticeUpdate::EveryTimestep, DensityType::Baryon,
+                   DensityParameters(exp_par), ensembles, 0.1, true);
+  } catch (std::invalid_argument &) {
+    thrown = true;
+  }
+  VERIFY(thrown);
+}
+
+TEST(interaction_point_density_of_ensembles) {
+  const std::array<double, 3> l = {6., 6., 6.};
+  const std::array<int, 3> n = {6, 6, 6};
+  const std::array<double, 3> origin = {-3., -3., -3.};
+  DensityLattice lat(l, n, origin, false, LatticeUpdate::EveryTimestep);
+  ExperimentParameters exp_par = smash::Test::default_parameters();
+  exp_par.n_ensembles = 3;
+  const DensityParameters par(exp_par);
+  // Identical ensembles, such that the density of every ensemble equals the
+  // average over the ensembles.
+  std::vector<Particles> ensembles(exp_par.n_ensembles);
+  for (Particles &particles : ensembles) {
+    for (int i = 0; i < 3; i++) {
+      ParticleData part = create_proton();
+      part.set_4momentum(0.938, ThreeVector(0.1 * i, 0., 0.));
+      part.set_4position(FourVector(0., 0.5 * i, 0.2, -0.3));
+      particles.insert(part);
+    }
+  }
+  update_lattice(&lat, LatticeUpdate::EveryTimestep, DensityType::Baryon, par,
+                 ensembles, false);
+  for (const int i : {92, 93, 123}) {
+    const ThreeVector r = lat.cell_center(i);
+    const double on_lattice = density_at_interaction_point(
+        r, ensembles[1], par, DensityType::Baryon, &lat);
+    VERIFY(on_lattice > 0.01);
+    COMPARE(on_lattice, lat[i].rho());
+    // Without a lattice, the sum over one ensemble is kept as it is.
+    const double without_lattice = density_at_interaction_point(
+        r, ensembles[1], par, DensityType::Baryon, nullptr);
+    COMPARE_RELATIVE_ERROR(exp_par.n_ensembles * without_lattice, on_lattice,
+                           1.e-9);
+  }
+  /* Outside of the lattice, the sum over the particles is normalized to the
+   * ensembles like the lattice. */
+  const ThreeVector outside(3.5, 0., 0.);
+  const double beyond_lattice = density_at_interaction_point(
+      outside, ensembles[0], par, DensityType::Baryon, &lat);
+  VERIFY(beyond_lattice > 0.);
+  COMPARE_RELATIVE_ERROR(
+      beyond_lattice,
+      exp_par.n_ensembles * density_at_interaction_point(
+                                outside, ensembles[0], par,
+                                DensityType::Baryon, nullptr),
+      1.e-12);
+}
+
 // check that analytical and numerical results for gradient of density coincide
 TEST(density_gradient) {
   // create two protons
@@ -10,6 +10,7 @@
 #include "setup.h"
 
 #include "../include/smash/decayactiondilepton.h"
+#include "../include/smash/decayactionsfinderdilepton.h"
 
 using namespace smash;
 
@@ -109,3 +110,87 @@ TEST(eta_decay) {
   // (to an accuracy of five percent)
   COMPARE_RELATIVE_ERROR(weight_sum / N_samples, 0.0069, 0.05);
 }
+
+namespace {
+/// Dilepton output, which only counts the written actions and their weights.
+class CountingDileptonOutput : public OutputInterface {
+ public:
+  CountingDileptonOutput() : OutputInterface("Dileptons") {}
+  void at_interaction(const Action &action, const double) override {
+    n_actions++;
+    partial_weight_sum += action.get_partial_weight();
+  }
+  int n_actions = 0;
+  double partial_weight_sum = 0.;
+};
+
+/// Dilepton output, which keeps the decays of the last call.
+class RecordingDileptonOutput : public OutputInterface {
+ public:
+  RecordingDileptonOutput() : OutputInterface("Dileptons") {}
+  void at_dilepton_decays(const std::vector<DileptonDecay> &decays) override {
+    n_calls++;
+    last_decays = decays;
+  }
+  int n_calls = 0;
+  std::vector<DileptonDecay> last_decays;
+};
+}  // unnamed namespace
+
+TEST(shine_final) {
+  const ParticleType &type_piz = ParticleType::find(0x111);
+  const ParticleType &type_etaz = ParticleType::find(0x221);
+  const ParticleType &type_photon = ParticleType::find(0x22);
+  Particles particles;
+  for (ParticleTypePtr t : {&type_piz, &type_etaz, &type_photon}) {
+    ParticleData p{*t};
+    p.set_4momentum(t->mass(), ThreeVector(0., 0., 0.));
+    particles.insert(p);
+  }
+
+  DecayActionsFinderDilepton finder;
+  CountingDileptonOutput output;
+  // stable particles do not shine during the evolution
+  finder.shine(particles, &output, 0.1);
+  COMPARE(output.n_actions, 0);
+  finder.shine_final(particles, &output, true);
+  COMPARE(output.n_actions, 0);
+  // one Dalitz decay each for the π⁰ and the η, nothing for the photon
+  finder.shine_final(particles, &output, false);
+  COMPARE(output.n_actions, 2);
+  // the partial weight of a decay action is the partial width of its mode
+  const ParticleTypePtrList dalitz = {&ParticleType::find(0x11),
+                                      &ParticleType::find(-0x11), &type_photon};
+  COMPARE_RELATIVE_ERROR(
+      output.partial_weight_sum,
+      type_piz.get_partial_width(type_piz.mass(), dalitz) +
+          type_etaz.get_partial_width(type_etaz.mass(), dalitz),
+      1e-12);
+}
+
+TEST(shine_final_in_one_call) {
+  const ParticleType &type_piz = ParticleType::find(0x111);
+  const ParticleType &type_etaz = ParticleType::find(0x221);
+  Particles particles;
+  for (ParticleTypePtr t : {&type_piz, &type_etaz}) {
+    ParticleData p{*t};
+    p.set_4momentum(t->mass(), ThreeVector(0., 0., 0.));
+    particles.insert(p);
+  }
+
+  DecayActionsFinderDilepton finder;
+  RecordingDileptonOutput output;
+  finder.shine(particles, &output, 0.1);
+  COMPARE(output.n_calls, 0);
+  // both Dalitz decays are passed on together
+  finder.shine_final(particles, &output, false);
+  COMPARE(output.n_calls, 1);
+  COMPARE(output.last_decays.size(), 2u);
+  for (const DileptonDecay &decay : output.last_decays) {
+    COMPARE(decay.products.size(), 3u);
+    VERIFY(decay.weight > 0.);
+    VERIFY(decay.partial_width > 0.);
+  }
+  COMPARE(output.last_decays[0].parent.pdgcode(), type_piz.pdgcode());
+  COMPARE(output.last_decays[1].parent.pdgcode(), type_etaz.pdgcode());
+}
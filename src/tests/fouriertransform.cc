@@ -0,0 +1,116 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/fouriertransform.h"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "../include/smash/constants.h"
+
+using namespace smash;
+
+using Complex = std::complex<double>;
+
+namespace {
+/// Arbitrary, but reproducible complex test data
+std::vector<Complex> test_data(int n) {
+  std::vector<Complex> data(n);
+  for (int j = 0; j < n; j++) {
+    data[j] = Complex(std::sin(1.3 * j + 0.2), std::cos(0.7 * j * j - 1.));
+  }
+  return data;
+}
+
+/// Discrete Fourier transform evaluated directly from its definition
+std::vector<Complex> naive_dft(const std::vector<Complex> &data) {
+  const int n = data.size();
+  std::vector<Complex> result(n, 0.);
+  for (int k = 0; k < n; k++) {
+    for (int j = 0; j < n; j++) {
+      result[k] += data[j] * std::polar(1., -twopi * j * k / n);
+    }
+  }
+  return result;
+}
+}  // unnamed namespace
+
+TEST_CATCH(invalid_size, std::invalid_argument) { FourierTransform fft(0); }
+
+TEST(compare_to_dft) {
+  // Powers of two use radix-2, all other lengths Bluestein's algorithm.
+  for (int n : {1, 2, 3, 5, 6, 8, 12, 17, 32, 100}) {
+    const FourierTransform fft(n);
+    COMPARE(fft.size(), n);
+    const std::vector<Complex> data = test_data(n);
+    const std::vector<Complex> expected = naive_dft(data);
+    std::vector<Complex> result = data;
+    fft.forward(result.data());
+    for (int k = 0; k < n; k++) {
+      COMPARE_ABSOLUTE_ERROR(result[k].real(), expected[k].real(), 1e-10)
+          << "n = " << n << ", k = " << k;
+      COMPARE_ABSOLUTE_ERROR(result[k].imag(), expected[k].imag(), 1e-10)
+          << "n = " << n << ", k = " << k;
+    }
+    fft.inverse(result.data());
+    for (int j = 0; j < n; j++) {
+      COMPARE_ABSOLUTE_ERROR(result[j].real(), data[j].real(), 1e-12);
+      COMPARE_ABSOLUTE_ERROR(result[j].imag(), data[j].imag(), 1e-12);
+    }
+  }
+}
+
+TEST(transform_3d) {
+  const std::array<int, 3> dims = {4, 3, 5};
+  const FourierTransform3D fft(dims);
+  COMPARE(fft.size(), 60);
+  const std::vector<Complex> data = test_data(fft.size());
+  std::vector<Complex> expected(fft.size(), 0.);
+  for (int kz = 0; kz < dims[2]; kz++) {
+    for (int ky = 0; ky < dims[1]; ky++) {
+      for (int kx = 0; kx < dims[0]; kx++) {
+        Complex &value = expected[kx + dims[0] * (ky + dims[1] * kz)];
+        for (int z = 0; z < dims[2]; z++) {
+          for (int y = 0; y < dims[1]; y++) {
+            for (int x = 0; x < dims[0]; x++) {
+              const double phase = static_cast<double>(kx * x) / dims[0] +
+                                   static_cast<double>(ky * y) / dims[1] +
+                                   static_cast<double>(kz * z) / dims[2];
+              value += data[x + dims[0] * (y + dims[1] * z)] *
+                       std::polar(1., -twopi * phase);
+            }
+          }
+        }
+      }
+    }
+  }
+  // The result must not depend on the number of threads.
+  for (int n_threads : {1, 3}) {
+    std::vector<Complex> result = data;
+    fft.forward(result, n_threads);
+    for (int i = 0; i < fft.size(); i++) {
+      COMPARE_ABSOLUTE_ERROR(result[i].real(), expected[i].real(), 1e-10);
+      COMPARE_ABSOLUTE_ERROR(result[i].imag(), expected[i].imag(), 1e-10);
+    }
+    fft.inverse(result, n_threads);
+    for (int i = 0; i < fft.size(); i++) {
+      COMPARE_ABSOLUTE_ERROR(result[i].real(), data[i].real(), 1e-12);
+      COMPARE_ABSOLUTE_ERROR(result[i].imag(), data[i].imag(), 1e-12);
+    }
+  }
+}
+
+TEST_CATCH(wrong_data_size, std::invalid_argument) {
+  const FourierTransform3D fft({2, 2, 2});
+  std::vector<Complex> data(7);
+  fft.forward(data);
+}
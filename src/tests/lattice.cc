@@ -50,6 +50,47 @@ TEST(reset) {
   }
 }
 
+TEST(move_window) {
+  const std::array<double, 3> l = {10., 6., 2.};
+  const std::array<int, 3> n = {4, 8, 3};
+  const std::array<double, 3> origin = {0., 3., 7.};
+  RectangularLattice<double> lattice(l, n, origin, false,
+                                     LatticeUpdate::EveryTimestep);
+  int i = 0;
+  for (auto &node : lattice) {
+    node = static_cast<double>(++i);
+  }
+  RectangularLattice<double> moved = lattice;
+  moved.move_window({1, -2, 0}, {5, 6, 2});
+  COMPARE(moved.n_cells(), (std::array<int, 3>{5, 6, 2}));
+  COMPARE(moved.cell_sizes(), lattice.cell_sizes());
+  FUZZY_COMPARE(moved.origin()[0], 2.5);
+  FUZZY_COMPARE(moved.origin()[1], 1.5);
+  FUZZY_COMPARE(moved.origin()[2], 7.);
+  FUZZY_COMPARE(moved.lattice_sizes()[0], 12.5);
+  FUZZY_COMPARE(moved.lattice_sizes()[1], 4.5);
+  FUZZY_COMPARE(moved.lattice_sizes()[2], 2. * 2. / 3.);
+  COMPARE(moved.size(), 60u);
+  // Nodes at the same position keep their values, new nodes are empty.
+  moved.iterate_sublattice(
+      {0, 0, 0}, moved.n_cells(), [&](double &node, int ix, int iy, int iz) {
+        const int jx = ix + 1, jy = iy - 2;
+        if (jx < n[0] && jy >= 0) {
+          COMPARE(node, lattice.node(jx, jy, iz));
+          const ThreeVector d =
+              moved.cell_center(ix, iy, iz) - lattice.cell_center(jx, jy, iz);
+          VERIFY(d.abs() < 1e-12);
+        } else {
+          COMPARE(node, 0.);
+        }
+      });
+}
+
+TEST_CATCH(move_periodic_window, std::logic_error) {
+  auto lattice = create_lattice(true);
+  lattice->move_window({1, 0, 0}, {4, 8, 3});
+}
+
 TEST(out_of_bounds) {
   auto lattice1 = create_lattice(true);
   // For periodic lattice nothing is out of bounds
@@ -71,6 +112,49 @@ TEST(out_of_bounds) {
   VERIFY(lattice2->out_of_bounds(999, 666, 999999));
 }
 
+TEST(interpolate_at) {
+  // Lattice with 4 x 8 x 3 cells of sizes 2.5 x 0.75 x 2/3
+  auto lattice = create_lattice(false);
+  auto f = [](const ThreeVector &r) {
+    return FourVector(1. + 2. * r.x1() - 3. * r.x2() + 0.5 * r.x3(), r);
+  };
+  for (size_t i = 0; i < lattice->size(); i++) {
+    (*lattice)[i] = f(lattice->cell_center(i));
+  }
+  FourVector value;
+  auto verify_value = [&](const FourVector &expected) {
+    for (int mu = 0; mu < 4; mu++) {
+      COMPARE_ABSOLUTE_ERROR(value[mu], expected[mu], 1e-12);
+    }
+  };
+  // Linear functions are reproduced between the outermost cell centers.
+  const ThreeVector r(4.3, 2.1, 1.2);
+  VERIFY(lattice->interpolate_at(r, value));
+  verify_value(f(r));
+  // The value at a cell center is the one of the node.
+  VERIFY(lattice->interpolate_at(lattice->cell_center(2, 5, 1), value));
+  verify_value(lattice->node(2, 5, 1));
+  // Closer to the edges than the outermost centers, the values are constant.
+  VERIFY(lattice->interpolate_at(ThreeVector(0.1, 2.1, 1.2), value));
+  verify_value(f(ThreeVector(1.25, 2.1, 1.2)));
+  VERIFY(lattice->interpolate_at(ThreeVector(4.3, 5.9, 1.9), value));
+  verify_value(f(ThreeVector(4.3, 5.625, 5. / 3.)));
+  // Out of the lattice
+  VERIFY(!lattice->interpolate_at(ThreeVector(-0.1, 2.1, 1.2), value));
+  COMPARE(value, FourVector());
+  VERIFY(!lattice->interpolate_at(ThreeVector(4.3, 6., 1.2), value));
+
+  // Periodic lattices interpolate across the edges.
+  auto periodic = create_lattice(true);
+  periodic->reset();
+  periodic->node(0, 0, 0) = FourVector(1., 0., 0., 0.);
+  periodic->node(3, 0, 0) = FourVector(3., 0., 0., 0.);
+  VERIFY(periodic->interpolate_at(ThreeVector(10., 0.375, 1. / 3.), value));
+  verify_value(FourVector(2., 0., 0., 0.));
+  VERIFY(periodic->interpolate_at(ThreeVector(-0.625, 0.375, 1. / 3.), value));
+  verify_value(FourVector(2.5, 0., 0., 0.));
+}
+
 TEST(cell_center) {
   auto lattice = create_lattice(true);
   COMPARE(lattice->cell_center(0, 0, 0).x1(), 1.25);
@@ -472,6 +556,17 @@ TEST(compute_four_gradient_lattice) {
   // compute the four-gradient
   new_lat.compute_four_gradient_lattice(old_lat, time_step, grad_lat);
 
+  // splitting the work between threads does not change the result
+  RectangularLattice<std::array<FourVector, 4>> parallel_grad_lat(
+      l, n, origin, periodicity, LatticeUpdate::EveryTimestep);
+  new_lat.compute_four_gradient_lattice(old_lat, time_step, parallel_grad_lat,
+                                        4);
+  for (size_t i = 0; i < grad_lat.size(); i++) {
+    for (int nu = 0; nu < 4; nu++) {
+      COMPARE(parallel_grad_lat[i][nu], grad_lat[i][nu]);
+    }
+  }
+
   double expected_dt = 0.0;
   ThreeVector expected_grad(0.0, 0.0, 0.0);
   /* Error of the derivative calculation is proportional to the
@@ -799,6 +894,52 @@ TEST(iterate_in_cube) {
       });
 }
 
+TEST(iterate_in_cube_rows) {
+  for (bool periodic : {false, true}) {
+    auto lattice = create_lattice(periodic);
+    const ThreeVector r0 = ThreeVector(2.0, 2.0, 1.0);
+    const double r_cut = 2.0;
+    // counts how often every node is visited within the cube
+    RectangularLattice<FourVector> cube_visits(*lattice);
+    cube_visits.reset();
+    cube_visits.iterate_in_cube(
+        r0, r_cut, [&](FourVector &node, int, int, int) {
+          node += FourVector(1., 0., 0., 0.);
+        });
+    // only visit the nodes of every row within a ball around r0
+    lattice->reset();
+    int previous_ix = 0, previous_iy = -1, previous_iz = -1;
+    lattice->iterate_in_cube_rows(
+        r0, r_cut,
+        [&](int iy, int iz) {
+          const ThreeVector center = lattice->cell_center(0, iy, iz);
+          const double dy = center[1] - r0[1], dz = center[2] - r0[2];
+          const double half = std::sqrt(std::max(0., 1. - dy * dy - dz * dz));
+          return std::make_pair(r0[0] - half, r0[0] + half);
+        },
+        [&](FourVector &node, int ix, int iy, int iz) {
+          // ix is increasing within a row
+          if (iy == previous_iy && iz == previous_iz) {
+            VERIFY(ix > previous_ix);
+          }
+          previous_ix = ix;
+          previous_iy = iy;
+          previous_iz = iz;
+          node += FourVector(1., 0., 0., 0.);
+          VERIFY((lattice->cell_center(ix, iy, iz) - r0).abs() <= 1.);
+        });
+    for (size_t i = 0; i < lattice->size(); i++) {
+      const double visits = (*lattice)[i].x0();
+      VERIFY(visits <= cube_visits[i].x0());
+      // without periodicity every node within the ball is visited once
+      if (!periodic) {
+        const bool in_ball = (lattice->cell_center(i) - r0).abs() <= 1.;
+        COMPARE(visits, in_ball ? 1. : 0.) << i;
+      }
+    }
+  }
+}
+
 TEST(iterate_in_rectangle) {
   // 1) Lattice is not periodic
   auto lattice = create_lattice(false);
@@ -1022,6 +1163,36 @@ TEST(copy_constructor) {
                              });
 }
 
+TEST(scratch_lattices) {
+  const std::array<double, 3> l = {10., 6., 2.};
+  const std::array<int, 3> n = {4, 8, 3};
+  const std::array<double, 3> origin = {0., 3., 7.};
+  RectangularLattice<double> lattice(l, n, origin, false,
+                                     LatticeUpdate::EveryTimestep);
+  auto &scratch = lattice.scratch_lattices<double>(3);
+  COMPARE(scratch.size(), 3u);
+  for (const auto &lat : scratch) {
+    VERIFY(lat.identical_to_lattice(&lattice));
+  }
+  const double *nodes = &scratch[1][0];
+  // Repeated calls reuse the lattices.
+  auto &fewer = lattice.scratch_lattices<double>(2);
+  COMPARE(&fewer, &scratch);
+  COMPARE(fewer.size(), 2u);
+  COMPARE(&fewer[1][0], nodes);
+  // A different structure or type recreates them.
+  lattice.move_window({1, 0, 0}, {5, 8, 3});
+  auto &moved = lattice.scratch_lattices<double>(2);
+  COMPARE(moved.size(), 2u);
+  VERIFY(moved[1].identical_to_lattice(&lattice));
+  auto &vectors = lattice.scratch_lattices<ThreeVector>(1);
+  COMPARE(vectors.size(), 1u);
+  VERIFY(vectors[0].identical_to_lattice(&lattice));
+  // Copies do not share them.
+  RectangularLattice<double> copy = lattice;
+  VERIFY(&copy.scratch_lattices<ThreeVector>(1) != &vectors);
+}
+
 double integrand(ThreeVector pos, double &value, ThreeVector point) {
   return value / ((pos - point).abs());
 }
@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/latticewindow.h"
+
+#include "../include/smash/particles.h"
+#include "setup.h"
+
+using namespace smash;
+
+namespace {
+/// Insert a particle of the given type at the given position
+void insert(Particles *particles, PdgCode pdg, const ThreeVector &r) {
+  ParticleData p{ParticleType::find(pdg)};
+  p.set_4position(FourVector(0., r));
+  particles->insert(p);
+}
+}  // unnamed namespace
+
+TEST(init_particle_types) { Test::create_actual_particletypes(); }
+
+TEST(follow) {
+  std::vector<Particles> ensembles(2);
+  insert(&ensembles[0], 0x2212, ThreeVector(3.2, -1.5, 7.9));
+  insert(&ensembles[1], 0x2112, ThreeVector(-4.1, 2.0, -6.3));
+  // Only baryons and nuclei define the window.
+  insert(&ensembles[0], 0x211, ThreeVector(50., 50., 50.));
+
+  LatticeWindow window({-10., -10., -10.}, {1., 1., 1.}, {20, 20, 20},
+                       {20, 20, 20}, 2., 2, 1.);
+  VERIFY(window.follow(ensembles));
+  COMPARE(window.shift(), (std::array<int, 3>{3, 6, 1}));
+  COMPARE(window.n_cells(), (std::array<int, 3>{13, 8, 19}));
+  COMPARE(window.origin(), (std::array<double, 3>{-7., -4., -9.}));
+
+  RectangularLattice<double> lattice({20., 20., 20.}, {20, 20, 20},
+                                     {-10., -10., -10.}, false,
+                                     LatticeUpdate::EveryTimestep);
+  window.move(&lattice);
+  COMPARE(lattice.n_cells(), window.n_cells());
+  COMPARE(lattice.origin(), window.origin());
+  window.move<double>(nullptr);
+
+  // The window is only fitted again after the update interval.
+  insert(&ensembles[1], 0x2112, ThreeVector(-9.5, 0., 0.));
+  VERIFY(!window.follow(ensembles));
+  VERIFY(window.follow(ensembles));
+  COMPARE(window.shift(), (std::array<int, 3>{-5, 0, 0}));
+  COMPARE(window.n_cells(), (std::array<int, 3>{18, 8, 19}));
+  // Without changes of the bounding box the window stays.
+  VERIFY(!window.follow(ensembles));
+  VERIFY(!window.follow(ensembles));
+}
+
+TEST(clamp_to_max_cell_number) {
+  std::vector<Particles> ensembles(1);
+  for (int i = 0; i < 3; i++) {
+    insert(&ensembles[0], 0x2212, ThreeVector(0.5 * i, 0., 0.));
+  }
+  // A single outlier far away does not blow up the window.
+  insert(&ensembles[0], 0x2112, ThreeVector(1e6, 0., 0.));
+  LatticeWindow window({-10., -10., -10.}, {1., 1., 1.}, {20, 20, 20},
+                       {20, 20, 20}, 2., 1, 1.);
+  VERIFY(window.follow(ensembles));
+  // The window is centered on the mean position x = 250000.375 fm.
+  COMPARE(window.n_cells(), (std::array<int, 3>{20, 4, 4}));
+  COMPARE(window.origin()[0], 250000. - 10.);
+}
+
+TEST(keep_without_baryons) {
+  std::vector<Particles> ensembles(1);
+  insert(&ensembles[0], 0x211, ThreeVector(1., 2., 3.));
+  LatticeWindow window({0., 0., 0.}, {1., 1., 1.}, {4, 4, 4}, {4, 4, 4}, 1.,
+                       1, 1.);
+  VERIFY(!window.follow(ensembles));
+  COMPARE(window.n_cells(), (std::array<int, 3>{4, 4, 4}));
+}
+
+TEST(occupancy) {
+  std::vector<Particles> ensembles(1);
+  insert(&ensembles[0], 0x2212, ThreeVector(1.5, 1.5, 1.5));
+  // 3 x 2 x 2 tiles of 4 x 4 x 4 cells, the last one in x direction is cut
+  const std::array<int, 3> n = {10, 8, 8};
+  LatticeWindow window({0., 0., 0.}, {1., 1., 1.}, n, n, 1., 1, 2.);
+  auto index = [&](int ix, int iy, int iz) {
+    return ix + n[0] * (iy + n[1] * iz);
+  };
+  // All tiles count as occupied before the first update.
+  VERIFY(window.occupied(index(9, 7, 7)));
+  window.update_occupancy(ensembles);
+  VERIFY(window.occupied(index(9, 7, 7)));
+
+  // The proton is within range of the first tile only.
+  window.update_occupancy(ensembles);
+  VERIFY(window.occupied(index(0, 0, 0)));
+  VERIFY(window.occupied(index(3, 3, 3)));
+  VERIFY(!window.occupied(index(4, 0, 0)));
+  VERIFY(!window.occupied(index(0, 4, 0)));
+  VERIFY(!window.occupied(index(9, 7, 7)));
+
+  // Tiles stay occupied for one more update after the proton left.
+  ensembles[0].front().set_4position(FourVector(0., 8.5, 1.5, 6.5));
+  window.update_occupancy(ensembles);
+  VERIFY(window.occupied(index(0, 0, 0)));
+  VERIFY(window.occupied(index(8, 0, 4)));
+  VERIFY(window.occupied(index(4, 3, 7)));
+  VERIFY(!window.occupied(index(0, 4, 4)));
+  window.update_occupancy(ensembles);
+  VERIFY(!window.occupied(index(0, 0, 0)));
+  VERIFY(window.occupied(index(8, 0, 4)));
+}
+
+TEST_CATCH(invalid_interval, std::invalid_argument) {
+  LatticeWindow window({0., 0., 0.}, {1., 1., 1.}, {4, 4, 4}, {4, 4, 4}, 1.,
+                       0, 1.);
+}
+
+TEST_CATCH(invalid_max_cell_number, std::invalid_argument) {
+  LatticeWindow window({0., 0., 0.}, {1., 1., 1.}, {4, 4, 4}, {4, 0, 4}, 1.,
+                       1, 1.);
+}
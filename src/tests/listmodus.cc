@@ -13,8 +13,12 @@
 
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <cstdint>
+#include <fstream>
 #include <string>
 
+#include "../include/smash/columnarfile.h"
+#include "../include/smash/columnaroutput.h"
 #include "../include/smash/listmodus.h"
 #include "../include/smash/oscaroutput.h"
 #include "../include/smash/particles.h"
@@ -543,3 +547,117 @@ TEST(try_create_particle_func) {
     COMPARE(a.pdgcode(), b.pdgcode());
   }
 }
+
+TEST(events_from_columnar_file) {
+  // Write three events and start reading at the second one
+  constexpr int n_events = 3;
+  std::vector<ParticleList> init_particles;
+  {
+    ColumnarOutput output(testoutputpath, "Particles", OutputParameters());
+    for (int event = 0; event < n_events; event++) {
+      Particles particles;
+      for (int i = 0; i < 5 + event; i++) {
+        particles.insert(Test::smashon_random());
+      }
+      init_particles.push_back(particles.copy_to_vector());
+      output.at_eventend(particles, event, Test::default_event_info());
+    }
+  }
+  const bf::path file = testoutputpath / "particles_columnar.bin";
+  std::string list_conf_str = "List:\n";
+  list_conf_str += "    Columnar_File: \"" + file.native() + "\"\n";
+  list_conf_str += "    Shift_Id: 1\n";
+  auto config = Configuration(list_conf_str.c_str());
+  auto par = Test::default_parameters();
+  ListModus list_modus(config, par);
+
+  for (int event = 1; event < n_events; event++) {
+    Particles particles_read;
+    list_modus.initial_conditions(&particles_read, par);
+    COMPARE(particles_read.size(), init_particles[event].size());
+    const ParticleList p_fin = particles_read.copy_to_vector();
+    for (size_t i = 0; i < p_fin.size(); i++) {
+      const ParticleData &a = init_particles[event][i];
+      compare_fourvector(a.momentum(), p_fin[i].momentum());
+      COMPARE_ABSOLUTE_ERROR(p_fin[i].formation_time(), a.position().x0(),
+                             accuracy);
+      COMPARE(a.pdgcode(), p_fin[i].pdgcode());
+    }
+  }
+}
+
+TEST_CATCH(inconsistent_charge_in_columnar_file, std::invalid_argument) {
+  const bf::path file = testoutputpath / "inconsistent_columnar.bin";
+  bf::copy_file(testoutputpath / "particles_columnar.bin", file,
+                bf::copy_option::overwrite_if_exists);
+  std::uint64_t charge_offset;
+  {
+    const ColumnarFileReader reader(file);
+    const ColumnarEventInfo &info = reader.event(0);
+    charge_offset = info.offset + columnar_column_offset(
+                                      ColumnarColumn::Charge, info.n_particles);
+  }
+  {
+    std::fstream stream(file.native(),
+                        std::ios::in | std::ios::out | std::ios::binary);
+    const std::int32_t charge = 5;
+    stream.seekp(charge_offset);
+    stream.write(reinterpret_cast<const char *>(&charge), sizeof(charge));
+  }
+  std::string list_conf_str = "List:\n";
+  list_conf_str += "    Columnar_File: \"" + file.native() + "\"\n";
+  list_conf_str += "    Shift_Id: 0\n";
+  auto config = Configuration(list_conf_str.c_str());
+  auto par = Test::default_parameters();
+  ListModus list_modus(config, par);
+  Particles particles;
+  list_modus.initial_conditions(&particles, par);
+}
+
+#ifdef SMASH_USE_ZLIB
+TEST(compressed_particle_list) {
+  OutputParameters out_par = OutputParameters();
+  out_par.compression = "Zlib";
+  constexpr int n_events = 3;
+  std::vector<ParticleList> init_particles;
+  {
+    std::unique_ptr<OutputInterface> output =
+        create_oscar_output("Oscar2013", "Particles", testoutputpath, out_par);
+    for (int event = 0; event < n_events; event++) {
+      Particles particles;
+      for (int i = 0; i < 5 + event; i++) {
+        particles.insert(Test::smashon_random());
+      }
+      init_particles.push_back(particles.copy_to_vector());
+      output->at_eventend(particles, event, Test::default_event_info());
+    }
+  }
+  const bf::path outputfilepath = testoutputpath / "particle_lists.oscar.gz";
+  VERIFY(bf::exists(outputfilepath));
+  const bf::path inputfilepath = testoutputpath / "compressed0";
+  std::rename(outputfilepath.native().c_str(), inputfilepath.native().c_str());
+
+  std::string list_conf_str = "List:\n";
+  list_conf_str += "    File_Directory: \"";
+  list_conf_str += testoutputpath.native() + "\"\n";
+  list_conf_str += "    File_Prefix: \"compressed\"\n";
+  list_conf_str += "    Shift_Id: 0\n";
+  auto config = Configuration(list_conf_str.c_str());
+  auto par = Test::default_parameters();
+  ListModus list_modus(config, par);
+
+  for (int event = 0; event < n_events; event++) {
+    Particles particles_read;
+    list_modus.initial_conditions(&particles_read, par);
+    COMPARE(particles_read.size(), init_particles[event].size());
+    const ParticleList p_fin = particles_read.copy_to_vector();
+    for (size_t i = 0; i < p_fin.size(); i++) {
+      const ParticleData &a = init_particles[event][i];
+      compare_fourvector(a.momentum(), p_fin[i].momentum());
+      COMPARE_ABSOLUTE_ERROR(p_fin[i].formation_time(), a.position().x0(),
+                             accuracy);
+      COMPARE(a.pdgcode(), p_fin[i].pdgcode());
+    }
+  }
+}
+#endif
@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/outputfilter.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include "../include/smash/asyncoutput.h"
+#include "../include/smash/oscaroutput.h"
+#include "../include/smash/scatteraction.h"
+#include "setup.h"
+
+using namespace smash;
+
+static const bf::path testoutputpath = bf::absolute(SMASH_TEST_OUTPUT_PATH);
+
+namespace {
+/// Output which records the ids of the particles it is asked to write
+class RecordingOutput : public OutputInterface {
+ public:
+  explicit RecordingOutput(std::vector<std::string> *log)
+      : OutputInterface("Particles"), log_(log) {}
+
+  void at_eventend(const Particles &particles, const int,
+                   const EventInfo &) override {
+    std::string line = "end";
+    for (const ParticleData &p : particles) {
+      line += " " + std::to_string(p.id());
+    }
+    log_->push_back(line);
+  }
+
+  void at_interaction(const Action &action, const double) override {
+    std::string line = "interaction";
+    for (const ParticleData &p : action.incoming_particles()) {
+      line += " " + std::to_string(p.id());
+    }
+    line += " ->";
+    for (const ParticleData &p : action.outgoing_particles()) {
+      line += " " + std::to_string(p.id());
+    }
+    log_->push_back(line);
+  }
+
+ private:
+  std::vector<std::string> *log_;
+};
+
+/// Create a particle with the given PDG code, momentum and id.
+ParticleData particle(int pdg, const FourVector &momentum, int id = -1) {
+  ParticleData p{ParticleType::find(PdgCode::from_decimal(pdg)), id};
+  p.set_4momentum(p.pole_mass(), momentum.threevec());
+  return p;
+}
+}  // unnamed namespace
+
+TEST(directory_is_created) {
+  bf::create_directories(testoutputpath);
+  VERIFY(bf::exists(testoutputpath));
+}
+
+TEST(init_particletypes) { Test::create_actual_particletypes(); }
+
+TEST(accept_all) {
+  const OutputFilter filter;
+  VERIFY(!filter.selects_particles());
+  VERIFY(filter.columns().empty());
+  VERIFY(filter.accepts(particle(111, {0., 0., 0., 10.})));
+}
+
+TEST(charged_hadrons_at_midrapidity) {
+  const OutputFilter filter(
+      Configuration("Only_Charged: True\n"
+                    "Only_Hadrons: True\n"
+                    "Rapidity_Cut: 1.0\n"));
+  VERIFY(filter.selects_particles());
+  VERIFY(filter.accepts(particle(211, {0., 0.3, 0., 0.1})));
+  VERIFY(filter.accepts(particle(-2212, {0., 0., 0., -1.})));
+  VERIFY(!filter.accepts(particle(111, {0., 0.3, 0., 0.1})));
+  VERIFY(!filter.accepts(particle(11, {0., 0.3, 0., 0.1})));
+  // y = 1.52
+  VERIFY(!filter.accepts(particle(211, {0., 0., 0., 0.3})));
+}
+
+TEST(pdg_codes_and_transverse_momentum) {
+  const OutputFilter filter(
+      Configuration("PDG: [211, -211]\n"
+                    "Transverse_Momentum_Range: [0.2, 2.0]\n"));
+  VERIFY(filter.accepts(particle(211, {0., 0.3, 0.4, 5.})));
+  VERIFY(filter.accepts(particle(-211, {0., 0., 0.2, 0.})));
+  VERIFY(!filter.accepts(particle(211, {0., 0.1, 0., 0.})));
+  VERIFY(!filter.accepts(particle(211, {0., 2., 0., 0.})));
+  VERIFY(!filter.accepts(particle(2212, {0., 0.5, 0., 0.})));
+}
+
+TEST_CATCH(negative_rapidity_cut, std::invalid_argument) {
+  OutputFilter(Configuration("Rapidity_Cut: -1.0\n"));
+}
+
+TEST_CATCH(empty_transverse_momentum_range, std::invalid_argument) {
+  OutputFilter(Configuration("Transverse_Momentum_Range: [1.0, 1.0]\n"));
+}
+
+TEST(filtered_particles) {
+  std::vector<std::string> log;
+  FilteredOutput output(make_unique<RecordingOutput>(&log),
+                        OutputFilter(Configuration("Only_Charged: True\n")));
+  Particles particles;
+  particles.insert(particle(211, {0., 0.1, 0., 0.}));
+  const ParticleData pi0 = particles.insert(particle(111, {0., 0.1, 0., 0.}));
+  particles.insert(particle(-211, {0., 0.1, 0., 0.}));
+  const EventInfo event = Test::default_event_info();
+  output.at_eventend(particles, 0, event);
+  // The accepted particles keep their ids and order.
+  COMPARE(log.back(), "end 0 2");
+  particles.remove(pi0);
+  output.at_eventend(particles, 1, event);
+  COMPARE(log.back(), "end 0 2");
+  Particles neutral;
+  neutral.insert(particle(111, {0., 0.1, 0., 0.}));
+  output.at_eventend(neutral, 2, event);
+  COMPARE(log.back(), "end");
+}
+
+TEST(filtered_interactions) {
+  std::vector<std::string> log;
+  FilteredOutput output(make_unique<RecordingOutput>(&log),
+                        OutputFilter(Configuration("PDG: [211]\n")));
+  const ParticleData pip1 = particle(211, {0., 0.1, 0., 0.}, 1);
+  const ParticleData pip2 = particle(211, {0., -0.1, 0., 0.}, 2);
+  const ParticleData pi0 = particle(111, {0., 0.1, 0., 0.}, 3);
+  const ScatterAction scatter(pip1, pi0, 0.5);
+  output.at_interaction(RecordedAction(scatter, {pip1, pi0}, {pip2, pi0}), 0.);
+  COMPARE(log.size(), 1u);
+  COMPARE(log.back(), "interaction 1 -> 2");
+  // Interactions without accepted particles are left out.
+  output.at_interaction(RecordedAction(scatter, {pi0}, {pi0}), 0.);
+  COMPARE(log.size(), 1u);
+  output.at_interaction(RecordedAction(scatter, {pi0}, {pip1, pi0}), 0.);
+  COMPARE(log.size(), 2u);
+  COMPARE(log.back(), "interaction -> 1");
+  output.at_interaction(RecordedAction(scatter, {pip1}, {pip2}), 0.);
+  COMPARE(log.size(), 3u);
+  COMPARE(log.back(), "interaction 1 -> 2");
+}
+
+TEST(filtered_dilepton_decays) {
+  std::vector<std::string> log;
+  FilteredOutput output(make_unique<RecordingOutput>(&log),
+                        OutputFilter(Configuration("Only_Charged: True\n")));
+  const ParticleData pi0 = particle(111, {0., 0.1, 0., 0.}, 1);
+  const ParticleData electron = particle(11, {0., 0.05, 0., 0.}, 2);
+  const ParticleData positron = particle(-11, {0., 0.05, 0., 0.}, 3);
+  const ParticleData photon = particle(22, {0., 0., 0., 0.}, 4);
+  output.at_dilepton_decays({{pi0, {electron, positron, photon}, 1., 0.1},
+                             {pi0, {photon}, 1., 0.1}});
+  // Every decay is filtered on its own.
+  COMPARE(log.size(), 1u);
+  COMPARE(log.back(), "interaction -> 2 3");
+}
+
+TEST(oscar2013_columns) {
+  OutputParameters out_par;
+  out_par.part_filter =
+      OutputFilter(Configuration("Columns: [\"pdg\", \"px\", \"ID\"]\n"));
+  {
+    auto output =
+        create_oscar_output("Oscar2013", "Particles", testoutputpath, out_par);
+    Particles particles;
+    particles.insert(particle(-211, {0., 0.5, 0., 0.}));
+    output->at_eventend(particles, 0, Test::default_event_info());
+  }
+  bf::ifstream file{testoutputpath / "particle_lists.oscar"};
+  std::string line;
+  std::getline(file, line);
+  COMPARE(line, "#!OSCAR2013 particle_lists pdg px ID");
+  std::getline(file, line);
+  COMPARE(line, "# Units: none GeV none");
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "# event 0 out 1");
+  std::getline(file, line);
+  COMPARE(line, "-211 0.5 0");
+}
+
+TEST_CATCH(oscar2013_extended_column, std::invalid_argument) {
+  OutputParameters out_par;
+  out_par.part_filter = OutputFilter(Configuration("Columns: [\"ncoll\"]\n"));
+  create_oscar_output("Oscar2013", "Particles", testoutputpath, out_par);
+}
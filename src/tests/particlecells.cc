@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/particlecells.h"
+
+#include <algorithm>
+
+#include "../include/smash/density.h"
+#include "../include/smash/random.h"
+#include "setup.h"
+
+using namespace smash;
+
+TEST(init_particle_types) {
+  ParticleType::create_type_list(
+      "# NAME MASS[GEV] WIDTH[GEV] PARITY PDG\n"
+      "N+ 0.938 0.0 + 2212\n"
+      "π⁺ 0.138 0.0 -  211\n");
+}
+
+/// \return List of protons, antiprotons and pions in a box of given size
+static ParticleList random_particles(int n, double half_length) {
+  ParticleList plist;
+  for (int i = 0; i < n; i++) {
+    const PdgCode pdg = i % 3 == 0 ? -0x2212 : (i % 3 == 1 ? 0x2212 : 0x211);
+    ParticleData part{ParticleType::find(pdg)};
+    part.set_4momentum(part.pole_mass(), random::uniform(-1., 1.),
+                       random::uniform(-1., 1.), random::uniform(-1., 1.));
+    part.set_4position(
+        FourVector(0., random::uniform(-half_length, half_length),
+                   random::uniform(-half_length, half_length),
+                   random::uniform(-half_length, half_length)));
+    plist.push_back(part);
+  }
+  return plist;
+}
+
+TEST(neighbors) {
+  const ParticleList plist = random_particles(500, 10.);
+  const double length = 2.;
+  const ParticleCells cells(plist, length);
+  for (int i = 0; i < 3; i++) {
+    VERIFY(cells.n_cells()[i] > 1);
+  }
+  for (int k = 0; k < 100; k++) {
+    // Also test points outside of the cells
+    const ThreeVector r(random::uniform(-13., 13.), random::uniform(-13., 13.),
+                        random::uniform(-13., 13.));
+    const std::vector<const ParticleData *> found = cells.neighbors(r);
+    // The particles are in the order of the list, without duplicates.
+    VERIFY(std::is_sorted(found.begin(), found.end()));
+    VERIFY(std::adjacent_find(found.begin(), found.end()) == found.end());
+    for (const ParticleData &p : plist) {
+      if ((p.position().threevec() - r).abs() < length) {
+        VERIFY(std::find(found.begin(), found.end(), &p) != found.end());
+      }
+    }
+  }
+}
+
+TEST(ensembles) {
+  const ParticleList plist = random_particles(200, 5.);
+  std::vector<Particles> ensembles(2);
+  for (size_t i = 0; i < plist.size(); i++) {
+    ensembles[2 * i < plist.size() ? 0 : 1].insert(plist[i]);
+  }
+  const ParticleCells from_list(plist, 1.5);
+  const ParticleCells from_ensembles(ensembles, 1.5);
+  COMPARE(from_ensembles.particles().size(), plist.size());
+  COMPARE(from_ensembles.n_cells(), from_list.n_cells());
+  const ThreeVector r(0.5, -1., 2.);
+  const auto expected = from_list.neighbors(r);
+  const auto found = from_ensembles.neighbors(r);
+  COMPARE(found.size(), expected.size());
+  // The particles of the ensembles are copies with the same positions.
+  for (size_t i = 0; i < found.size(); i++) {
+    COMPARE(found[i]->position(), expected[i]->position());
+  }
+}
+
+TEST(limit_cell_number) {
+  // Two distant particles do not need more than two cells.
+  ParticleList plist = random_particles(2, 1.);
+  plist[1].set_4position(FourVector(0., 1000., -1000., 1000.));
+  const ParticleCells cells(plist, 0.1);
+  const std::array<int, 3> &n = cells.n_cells();
+  VERIFY(n[0] * n[1] * n[2] <= 2);
+  COMPARE(cells.neighbors(plist[1].position().threevec()).size(), 2u);
+}
+
+TEST(empty) {
+  const ParticleList plist;
+  const ParticleCells cells(plist, 1.);
+  VERIFY(cells.neighbors(ThreeVector(0., 0., 0.)).empty());
+}
+
+TEST(same_density_as_full_list) {
+  const ParticleList plist = random_particles(300, 8.);
+  const DensityParameters par(smash::Test::default_parameters());
+  const ParticleCells cells(plist, par.r_cut());
+  for (int k = 0; k < 20; k++) {
+    const ThreeVector r(random::uniform(-9., 9.), random::uniform(-9., 9.),
+                        random::uniform(-9., 9.));
+    const auto full =
+        current_eckart(r, plist, par, DensityType::Baryon, true, true);
+    const auto near = current_eckart(r, cells.neighbors(r), par,
+                                     DensityType::Baryon, true, true);
+    // Identical up to the last bit, since the order of summation is kept
+    COMPARE(std::get<0>(near), std::get<0>(full));
+    COMPARE(std::get<1>(near), std::get<1>(full));
+    COMPARE(std::get<2>(near), std::get<2>(full));
+    COMPARE(std::get<3>(near), std::get<3>(full));
+    COMPARE(std::get<4>(near), std::get<4>(full));
+    COMPARE(std::get<7>(near), std::get<7>(full));
+  }
+}
+
+TEST_CATCH(invalid_length, std::invalid_argument) {
+  const ParticleList plist;
+  const ParticleCells cells(plist, 0.);
+}
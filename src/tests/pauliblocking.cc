@@ -116,3 +116,62 @@ TEST(phase_space_density_nucleus) {
     std::cout << 0.5 / 100 * i << "  " << f << std::endl;
   }
 }
+
+TEST(indexed_phase_space_density) {
+  Configuration conf = Test::configuration();
+  conf["Collision_Term"]["Pauli_Blocking"]["Spatial_Averaging_Radius"] = 1.86;
+  conf["Collision_Term"]["Pauli_Blocking"]["Momentum_Averaging_Radius"] = 0.08;
+  conf["Collision_Term"]["Pauli_Blocking"]["Gaussian_Cutoff"] = 2.2;
+  std::map<PdgCode, int> list = {{0x2212, 79}, {0x2112, 118}};
+  const int Ntest = 20;
+  Nucleus Au(list, Ntest);
+  Au.set_parameters_automatic();
+  Au.arrange_nucleons();
+  Au.generate_fermi_momenta();
+  std::vector<Particles> ensembles(2);
+  Au.copy_particles(&ensembles[0]);
+  Au.arrange_nucleons();
+  Au.generate_fermi_momenta();
+  Au.copy_particles(&ensembles[1]);
+
+  ExperimentParameters param = smash::Test::default_parameters(Ntest);
+  param.n_ensembles = 2;
+  PauliBlocker pb(conf["Collision_Term"]["Pauli_Blocking"], param);
+  PauliBlocker unindexed(conf["Collision_Term"]["Pauli_Blocking"], param);
+  const PdgCode pdg = 0x2212;
+  const ParticleList disregard;
+  auto compare_to_full_loop = [&]() {
+    VERIFY(pb.indexed());
+    for (int i = 0; i < 50; i++) {
+      const ThreeVector r(-6. + 0.25 * i, 0.1 * i, 3. - 0.1 * i);
+      const ThreeVector p(0., 0., 0.005 * i);
+      const double f_indexed =
+          pb.phasespace_dens(r, p, ensembles, pdg, disregard);
+      // Identical, since the same particles are summed in the same order
+      COMPARE(f_indexed,
+              unindexed.phasespace_dens(r, p, ensembles, pdg, disregard));
+    }
+  };
+
+  const double max_drift = 1.;
+  pb.index_particles(ensembles, max_drift);
+  compare_to_full_loop();
+
+  // Let the particles drift, then replace a proton like an action would.
+  for (Particles &particles : ensembles) {
+    for (ParticleData &part : particles) {
+      part.set_4position(part.position() +
+                         FourVector(0., max_drift, 0., 0.) * 0.99);
+    }
+  }
+  ParticleList incoming = {ensembles[1].front()};
+  ParticleList outgoing = {ParticleData{ParticleType::find(pdg)}};
+  outgoing[0].set_4position(FourVector(0., 0.5, 0.5, 0.5));
+  outgoing[0].set_4momentum(0.938, 0., 0., 0.1);
+  ensembles[1].update(incoming, outgoing, true);
+  pb.add_to_index(1, outgoing);
+  compare_to_full_loop();
+
+  pb.clear_index();
+  VERIFY(!pb.indexed());
+}
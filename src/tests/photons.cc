@@ -9,8 +9,14 @@
 
 #include "setup.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "../include/smash/bremsstrahlungaction.h"
+#include "../include/smash/crosssectionsbrems.h"
 #include "../include/smash/crosssectionsphoton.h"
+#include "../include/smash/interpolation2D.h"
 #include "../include/smash/scatteractionphoton.h"
 
 using namespace smash;
@@ -288,6 +294,71 @@ TEST(bremsstrahlung_gen_final_state) {
   COMPARE_RELATIVE_ERROR(tot_weight, 1.84592, 1e-5);
 }
 
+TEST(bremsstrahlung_resampled_diff_cross_sections) {
+  const std::vector<double> sqrts = BREMS_SQRTS;
+  const std::vector<double> k = BREMS_K;
+  const std::vector<double> theta = BREMS_THETA;
+  const std::vector<std::vector<double>> dsigma_dk = {
+      BREMS_PIPI_PIPI_OPP_DIFF_SIG_K, BREMS_PIPI_PIPI_SAME_DIFF_SIG_K,
+      BREMS_PIPI0_PIPI0_DIFF_SIG_K, BREMS_PIPI_PI0PI0_DIFF_SIG_K,
+      BREMS_PI0PI0_PIPI_DIFF_SIG_K};
+  const std::vector<std::vector<double>> dsigma_dtheta = {
+      BREMS_PIPI_PIPI_OPP_DIFF_SIG_THETA, BREMS_PIPI_PIPI_SAME_DIFF_SIG_THETA,
+      BREMS_PIPI0_PIPI0_DIFF_SIG_THETA, BREMS_PIPI_PI0PI0_DIFF_SIG_THETA,
+      BREMS_PI0PI0_PIPI_DIFF_SIG_THETA};
+  /* Compare the tables with the splines they replace halfway between the grid
+   * points, where the bilinear interpolation deviates most. sqrt(s) = 0.305,
+   * 0.315, ... lies between the points of both the tabulated data and the
+   * resampled grid, whose ln(k) and theta points coincide with the data. The
+   * deviations are measured relative to the largest value at the same
+   * sqrt(s), since the cross sections drop to zero at the kinematic
+   * thresholds. Single deviations are larger where the spline oscillates
+   * around the statistical noise of the data. */
+  const double max_tolerance = 0.15;
+  const double mean_tolerance = 0.01;
+  auto compare = [&](const std::vector<double> &x,
+                     const std::vector<double> &sigma, bool log_x) {
+    const InterpolateData2DSpline spline(x, sqrts, sigma);
+    const auto table = BremsstrahlungAction::resample_diff_cross_section(
+        x, sqrts, sigma, log_x);
+    double sum_deviation = 0.;
+    size_t n = 0;
+    for (double srts = 0.305; srts < sqrts.back(); srts += 0.01) {
+      std::vector<double> expected, tabulated;
+      for (size_t i = 0; i + 1 < x.size(); i++) {
+        const double xi = log_x ? std::sqrt(x[i] * x[i + 1])
+                                : 0.5 * (x[i] + x[i + 1]);
+        expected.push_back(spline(xi, srts));
+        tabulated.push_back(
+            table->get_value_linear(log_x ? std::log(xi) : xi, srts));
+      }
+      double max_value = 0.;
+      for (const double value : expected) {
+        max_value = std::max(max_value, std::abs(value));
+      }
+      if (max_value == 0.) {
+        continue;
+      }
+      for (size_t i = 0; i < expected.size(); i++) {
+        const double deviation =
+            std::abs(tabulated[i] - expected[i]) / max_value;
+        VERIFY(deviation < max_tolerance)
+            << "sqrt(s) = " << srts << ", point " << i << ": " << deviation;
+        sum_deviation += deviation;
+        n++;
+      }
+    }
+    VERIFY(n > 0);
+    VERIFY(sum_deviation / n < mean_tolerance) << sum_deviation / n;
+  };
+  for (const std::vector<double> &sigma : dsigma_dk) {
+    compare(k, sigma, true);
+  }
+  for (const std::vector<double> &sigma : dsigma_dtheta) {
+    compare(theta, sigma, false);
+  }
+}
+
 TEST(bremsstrahlung_reaction_type_function) {
   const ParticleData pip{ParticleType::find(0x211)};
   const ParticleData pim{ParticleType::find(-0x211)};
@@ -315,3 +386,53 @@ TEST(bremsstrahlung_reaction_type_function) {
   VERIFY(BremsstrahlungAction::bremsstrahlung_reaction_type(l8) ==
          BremsstrahlungAction::ReactionType::no_reaction);
 }
+
+////
+// Test the tabulated photon cross sections
+////
+
+TEST(tabulated_cross_sections) {
+  using Analytic = CrosssectionsPhoton<ComputationMethod::Analytic>;
+  using Lookup = CrosssectionsPhoton<ComputationMethod::Lookup>;
+  // without tables the analytic formulas are used
+  VERIFY(!Lookup::is_tabulated());
+  COMPARE(Lookup::xs_pi_rho0_pi(1.5, 0.776),
+          Analytic::xs_pi_rho0_pi(1.5, 0.776));
+
+  Lookup::tabulate(sha256::Hash(), "");
+  VERIFY(Lookup::is_tabulated());
+
+  // total cross sections
+  const double tolerance = 0.02;
+  COMPARE_RELATIVE_ERROR(Lookup::xs_pi_rho0_pi(1.5, 0.776),
+                         Analytic::xs_pi_rho0_pi(1.5, 0.776), tolerance);
+  COMPARE_RELATIVE_ERROR(Lookup::xs_pi_pi_rho0(1.44, 0.7),
+                         Analytic::xs_pi_pi_rho0(1.44, 0.7), tolerance);
+  COMPARE_RELATIVE_ERROR(Lookup::xs_pi_rho_pi0(1.8225, 0.9),
+                         Analytic::xs_pi_rho_pi0(1.8225, 0.9), tolerance);
+  COMPARE_RELATIVE_ERROR(Lookup::xs_pi0_rho_pi(4.0, 0.6),
+                         Analytic::xs_pi0_rho_pi(4.0, 0.6), tolerance);
+
+  // differential cross sections
+  COMPARE_RELATIVE_ERROR(Lookup::xs_diff_pi_rho0_pi(1.44, -0.3, 0.776),
+                         Analytic::xs_diff_pi_rho0_pi(1.44, -0.3, 0.776),
+                         tolerance);
+  COMPARE_RELATIVE_ERROR(Lookup::xs_diff_pi_pi0_rho(2.25, -0.5, 0.8),
+                         Analytic::xs_diff_pi_pi0_rho(2.25, -0.5, 0.8),
+                         tolerance);
+  COMPARE_RELATIVE_ERROR(Lookup::xs_diff_pi0_rho0_pi0(4.0, -1.2, 0.776),
+                         Analytic::xs_diff_pi0_rho0_pi0(4.0, -1.2, 0.776),
+                         tolerance);
+
+  // close to the threshold and outside of the tables the analytic formulas
+  // are used
+  const double sqrts_threshold = pion_mass + 0.776 + 0.005;
+  const double s_threshold = sqrts_threshold * sqrts_threshold;
+  COMPARE(Lookup::xs_pi_rho0_pi(s_threshold, 0.776),
+          Analytic::xs_pi_rho0_pi(s_threshold, 0.776));
+  COMPARE(Lookup::xs_pi_rho0_pi(16.0, 0.776),
+          Analytic::xs_pi_rho0_pi(16.0, 0.776));
+  COMPARE(Lookup::xs_pi_rho0_pi(1.5, 1.6), Analytic::xs_pi_rho0_pi(1.5, 1.6));
+  COMPARE(Lookup::xs_diff_pi_rho0_pi(16.0, -1.0, 0.776),
+          Analytic::xs_diff_pi_rho0_pi(16.0, -1.0, 0.776));
+}
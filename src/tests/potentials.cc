@@ -31,6 +31,13 @@
 
 using namespace smash;
 
+static const bf::path testoutputpath = bf::absolute(SMASH_TEST_OUTPUT_PATH);
+
+TEST(directory_is_created) {
+  bf::create_directories(testoutputpath);
+  VERIFY(bf::exists(testoutputpath));
+}
+
 TEST(set_random_seed) {
   std::random_device rd;
   int64_t seed = rd();
@@ -117,8 +124,9 @@ TEST(nucleus_potential_profile) {
   const double timestep = param.labclock->timestep_duration();
   for (auto it = 0; it < 20; it++) {
     {
-      a_file.open(("Nucleus_U_xy.vtk." + std::to_string(it)).c_str(),
-                  std::ios::out);
+      const bf::path vtk_path =
+          testoutputpath / ("Nucleus_U_xy.vtk." + std::to_string(it));
+      a_file.open(vtk_path.native(), std::ios::out);
       plist = P[0].copy_to_vector();
       a_file << "# vtk DataFile Version 2.0\n"
              << "potential\n"
@@ -170,7 +178,7 @@ TEST(propagation_in_test_potential) {
         : Potentials(conf, param), U0_(U0), d_(d), B0_(B0) {}
 
     std::tuple<ThreeVector, ThreeVector, ThreeVector, ThreeVector> all_forces(
-        const ThreeVector& r, const ParticleList&) const override {
+        const ThreeVector& r, const ParticleCells&) const override {
       const double tmp = std::exp(r.x1() / d_);
       return std::make_tuple(
           ThreeVector(U0_ / d_ * tmp / ((1.0 + tmp) * (1.0 + tmp)), 0.0, 0.0),
@@ -347,6 +355,7 @@ static ExperimentParameters default_parameters_vdf(
       4.0,                                  // Gaussian smearing cut-off
       0.333333,                             // discrete smearing weight
       triangular_smearing_range,            // triangular smearing range
+      1,                                    // lattice threads
       CollisionCriterion::Geometric,
       false,  // two_to_one
       false, Test::no_multiparticle_reactions(),
@@ -0,0 +1,61 @@
+/*
+ *
+ *    Copyright (c) 2021
+ *      SMASH Team
+ *
+ *    GNU General Public License (GPLv3 or later)
+ *
+ */
+
+#include <vir/test.h>  // This include has to be first
+
+#include "../include/smash/potentialslattice.h"
+
+using namespace smash;
+
+namespace {
+const std::array<double, 3> l = {4., 4., 4.};
+const std::array<int, 3> n = {2, 2, 2};
+const std::array<double, 3> origin = {0., 0., 0.};
+}  // unnamed namespace
+
+TEST(lookup) {
+  RectangularLattice<std::pair<ThreeVector, ThreeVector>> EM_lat(
+      l, n, origin, false, LatticeUpdate::EveryTimestep);
+  PotentialsLattice lattice(l, n, origin, false, false);
+  for (size_t i = 0; i < lattice.size(); i++) {
+    lattice[i].UB = FourVector(i, 0., 0., 1.);
+    EM_lat[i] = std::make_pair(ThreeVector(i, 0., 0.), ThreeVector(0., 0., i));
+  }
+  lattice.set_fields(EM_lat);
+  PotentialsOnLattice value;
+  VERIFY(lattice.at(ThreeVector(3., 1., 3.), value));
+  COMPARE(value.UB, FourVector(5., 0., 0., 1.));
+  COMPARE(value.UI3, FourVector());
+  COMPARE(value.FB.first, ThreeVector());
+  COMPARE(value.EM.first, ThreeVector(5., 0., 0.));
+  COMPARE(value.EM.second, ThreeVector(0., 0., 5.));
+  VERIFY(!lattice.at(ThreeVector(5., 1., 3.), value));
+  COMPARE(value.UB, FourVector());
+}
+
+TEST(trilinear) {
+  PotentialsLattice lattice(l, n, origin, false, true);
+  VERIFY(lattice.trilinear());
+  for (size_t i = 0; i < lattice.size(); i++) {
+    lattice[i].FB = std::make_pair(ThreeVector(i % 2, 0., 0.), ThreeVector());
+  }
+  PotentialsOnLattice value;
+  // Half way between the cell centers at x = 1 and x = 3
+  VERIFY(lattice.at(ThreeVector(2., 1.5, 2.5), value));
+  COMPARE(value.FB.first, ThreeVector(0.5, 0., 0.));
+  VERIFY(lattice.at(ThreeVector(2.5, 0.5, 3.5), value));
+  COMPARE(value.FB.first, ThreeVector(0.75, 0., 0.));
+}
+
+TEST_CATCH(fields_wrong_size, std::invalid_argument) {
+  RectangularLattice<std::pair<ThreeVector, ThreeVector>> EM_lat(
+      l, {2, 2, 3}, origin, false, LatticeUpdate::EveryTimestep);
+  PotentialsLattice lattice(l, n, origin, false, false);
+  lattice.set_fields(EM_lat);
+}
@@ -10,6 +10,7 @@
 #include <vir/test.h>  // This include has to be first
 
 #include <cinttypes>
+#include <thread>
 
 #include "histogram.h"
 
@@ -24,6 +25,22 @@ TEST(set_random_seed) {
   std::printf("random number seed: %" PRId64 "\n", seed);
 }
 
+TEST(engine_per_thread) {
+  random::set_seed(42);
+  const auto first = random::advance();
+  // another thread starts with its own, default-seeded engine
+  random::Engine::result_type other_first = 0;
+  std::thread other([&other_first]() {
+    other_first = random::advance();
+    random::set_seed(1);
+  });
+  other.join();
+  COMPARE(other_first, random::Engine()());
+  // drawing and seeding there does not touch the engine of this thread
+  random::set_seed(42);
+  COMPARE(random::advance(), first);
+}
+
 int tst_cnt = 0;  // test_counter
 
 // set this to true, in order to generate output files for debugging
@@ -12,6 +12,7 @@
 #include "setup.h"
 
 #include "../include/smash/angles.h"
+#include "../include/smash/crosssections.h"
 #include "../include/smash/random.h"
 #include "../include/smash/scatteraction.h"
 #include "../include/smash/scatteractionmulti.h"
@@ -512,3 +513,48 @@ TEST(particle_ordering) {
     }
   }
 }
+
+TEST(elastic_and_resonances_only) {
+  // the reduced kernel has to give the same channels as the full one, if only
+  // elastic and 2->1 reactions are enabled
+  const auto resonance_table = CrossSections::resonance_formation_table();
+  const auto& all_types = ParticleType::list_all();
+  ReactionsBitSet only_elastic;
+  only_elastic.set(IncludedReactions::Elastic);
+  const std::vector<PdgCode> pdgs = {0x211, 0x111,  -0x211, 0x321, -0x321,
+                                     0x2212, 0x2112, 0x113,  0x2224};
+  for (const PdgCode& pdg_a : pdgs) {
+    for (const PdgCode& pdg_b : pdgs) {
+      const ParticleType& type_a = ParticleType::find(pdg_a);
+      const ParticleType& type_b = ParticleType::find(pdg_b);
+      const size_t i = std::addressof(type_a) - std::addressof(all_types[0]);
+      const size_t j = std::addressof(type_b) - std::addressof(all_types[0]);
+      const ParticleTypePtrList& resonances =
+          resonance_table[i * all_types.size() + j];
+      for (const double p_x : {0.1, 0.3, 0.6, 1.5}) {
+        ParticleData a{type_a}, b{type_b};
+        a.set_4position(pos_a);
+        b.set_4position(pos_b);
+        a.set_4momentum(a.pole_mass(), p_x, 0., 0.);
+        b.set_4momentum(b.pole_mass(), -p_x, 0., 0.);
+        ScatterAction full(a, b, 0.2);
+        ScatterAction reduced(a, b, 0.2);
+        full.add_all_scatterings(-1., true, only_elastic,
+                                 Test::no_multiparticle_reactions(), 0., false,
+                                 false, false, NNbarTreatment::NoAnnihilation,
+                                 1.0, 0.0);
+        reduced.add_elastic_and_resonance_scatterings(-1., true, 0., false,
+                                                      resonances, 1.0, 0.0);
+        const auto& branches_full = full.collision_channels();
+        const auto& branches_reduced = reduced.collision_channels();
+        COMPARE(branches_reduced.size(), branches_full.size())
+            << type_a.name() << " + " << type_b.name() << ", p = " << p_x;
+        for (size_t k = 0; k < branches_full.size(); k++) {
+          VERIFY(collisionbranches_equal(branches_full[k],
+                                         branches_reduced[k]));
+        }
+        COMPARE(reduced.cross_section(), full.cross_section());
+      }
+    }
+  }
+}
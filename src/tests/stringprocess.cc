@@ -18,6 +18,7 @@
 #include "Pythia8/Pythia.h"
 
 #include <iostream>
+#include <thread>
 
 using namespace smash;
 using smash::Test::Momentum;
@@ -768,3 +769,88 @@ TEST(string_scaling_factors) {
   COMPARE(outgoing[3].initial_xsec_scaling_factor(), coherence_factor / 3.);
   VERIFY(outgoing[3] == c);
 }
+
+TEST(preinitialize_hard_pythia) {
+  std::unique_ptr<StringProcess> sp =
+      make_unique<StringProcess>(1.0, 1.0, .0, 0.001, .0, .0, 1., 1., .0, .0,
+                                 .5, .0, .0, .0, .0, true, 1. / 3., true, 0.);
+  const SystemTimeSpan time_hadron = sp->pythia_init_time();
+  VERIFY(time_hadron > SystemTimeSpan::zero());
+
+  sp->preinitialize_hard_pythia({{pdg::p, pdg::pi_p}}, 10.);
+  const SystemTimeSpan time_hard = sp->pythia_init_time();
+  VERIFY(time_hard > time_hadron);
+
+  // both orderings are initialized and used afterwards
+  Pythia8::Pythia *p_pi = sp->hard_pythia({2212, 211}, 5.);
+  Pythia8::Pythia *pi_p = sp->hard_pythia({211, 2212}, 5.);
+  VERIFY(p_pi != pi_p);
+  COMPARE(p_pi->settings.mode("Beams:idA"), 2212);
+  COMPARE(pi_p->settings.mode("Beams:idA"), 211);
+  COMPARE(sp->pythia_init_time(), time_hard);
+}
+
+TEST(string_process_pool) {
+  int created = 0;
+  StringProcessPool pool(
+      [&created]() {
+        created++;
+        return make_unique<StringProcess>(1.0, 1.0, .0, 0.001, .0, .0, 1., 1.,
+                                          .0, .0, .5, .0, .0, .0, .0, true,
+                                          1. / 3., true, 0.);
+      },
+      2);
+  // the object of worker 0 is created right away
+  COMPARE(created, 1);
+  StringProcess *main_sp = pool.get();
+  COMPARE(pool.get(), main_sp);
+
+  // worker 1 gets its own object, which is kept for the next loop
+  pool.init_pythia_hadron_rndm();
+  StringProcess *worker_sp = nullptr;
+  random::Engine::result_type worker_draw = 0;
+  for (int loop = 0; loop < 2; loop++) {
+    std::thread worker([&]() {
+      StringProcessPool::WorkerScope scope(pool, 1);
+      worker_sp = pool.get();
+      if (loop == 0) {
+        worker_draw = random::advance();
+      }
+    });
+    worker.join();
+  }
+  VERIFY(worker_sp != nullptr);
+  VERIFY(worker_sp != main_sp);
+  COMPARE(created, 2);
+  COMPARE(pool.size(), 2);
+  COMPARE(pool.get(), main_sp);
+  COMPARE(pool.pythia_init_time(),
+          main_sp->pythia_init_time() + worker_sp->pythia_init_time());
+
+  // the random stream of a worker only depends on the common seed
+  random::set_seed(7);
+  pool.init_pythia_hadron_rndm();
+  random::Engine::result_type draw = 0;
+  {
+    StringProcessPool::WorkerScope scope(pool, 1);
+    draw = random::advance();
+  }
+  random::set_seed(7);
+  pool.init_pythia_hadron_rndm();
+  {
+    StringProcessPool::WorkerScope scope(pool, 1);
+    COMPARE(random::advance(), draw);
+  }
+  VERIFY(draw != worker_draw);
+}
+
+TEST_CATCH(string_process_pool_worker_out_of_range, std::out_of_range) {
+  StringProcessPool pool(
+      []() {
+        return make_unique<StringProcess>(1.0, 1.0, .0, 0.001, .0, .0, 1., 1.,
+                                          .0, .0, .5, .0, .0, .0, .0, true,
+                                          1. / 3., true, 0.);
+      },
+      2);
+  StringProcessPool::WorkerScope scope(pool, 2);
+}
@@ -11,8 +11,15 @@
 
 #include "../include/smash/tabulation.h"
 
+#include <cstdint>
+#include <fstream>
+
+#include <boost/filesystem.hpp>
+
 using namespace smash;
 
+static const bf::path testoutputpath = bf::absolute(SMASH_TEST_OUTPUT_PATH);
+
 TEST(empty) {
   const Tabulation tab;
   VERIFY(tab.is_empty());
@@ -89,3 +96,152 @@ TEST(quadratic) {
   // check extrapolated values
   COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(3.), 7.8, error);
 }
+
+TEST(grid_empty) {
+  const GridTabulation tab;
+  VERIFY(tab.is_empty());
+}
+
+TEST(grid_bilinear) {
+  // a bilinear function is reproduced exactly
+  const GridTabulation tab({0., 2., 4}, {-1., 1., 10},
+                           [](double x, double y) { return x + 2 * y * x; });
+  const double error = 1E-12;
+  VERIFY(!tab.is_empty());
+  VERIFY(tab.contains(0.3, 0.7));
+  VERIFY(!tab.contains(2.1, 0.7));
+  VERIFY(!tab.contains(0.3, -1.1));
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0., -1.), 0., error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0.3, 0.7), 0.72, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(1.25, -0.35), 0.375, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(2., 1.), 6., error);
+  // values outside of the domain are clamped to the boundary
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(3., 1.), 6., error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(2., 5.), 6., error);
+}
+
+TEST(grid_trilinear) {
+  // a trilinear function is reproduced exactly
+  const GridTabulation tab(
+      {0., 1., 5}, {0., 2., 8}, {-1., 0., 3},
+      [](double x, double y, double z) { return 1. + x - z + x * y * z; });
+  const double error = 1E-12;
+  VERIFY(tab.contains(0.5, 1.5, -0.5));
+  VERIFY(!tab.contains(0.5, 1.5, 0.5));
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0., 0., -1.), 2., error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0.5, 1.5, -0.5), 1.625, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0.9, 0.1, -0.2), 2.082, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(1., 2., 0.), 2., error);
+}
+
+TEST(grid_float) {
+  // values are stored in single precision, but interpolated in double
+  const FloatGridTabulation tab(
+      {0., 2., 4}, {-1., 1., 10},
+      [](double x, double y) { return x + 2 * y * x; });
+  const double error = 1E-6;
+  VERIFY(!tab.is_empty());
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0.3, 0.7), 0.72, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(1.25, -0.35), 0.375, error);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(2., 1.), 6., error);
+}
+
+TEST(grid_cache) {
+  bf::create_directories(testoutputpath);
+  bf::remove(testoutputpath / "grid_cache.bin");
+  sha256::Hash hash{};
+  int n_created = 0;
+  const std::function<GridTabulation()> create = [&]() {
+    n_created++;
+    return GridTabulation({0., 2., 4}, {-1., 1., 10},
+                          [](double x, double y) { return x + 2 * y * x; });
+  };
+  bool created = false;
+  const GridTabulation tab = cache_tabulation(testoutputpath, "grid_cache.bin",
+                                              hash, create, &created);
+  VERIFY(created);
+  VERIFY(bf::exists(testoutputpath / "grid_cache.bin"));
+  // a valid table on disk is read instead of created
+  created = false;
+  const GridTabulation cached = cache_tabulation(
+      testoutputpath, "grid_cache.bin", hash, create, &created);
+  VERIFY(!created);
+  COMPARE(n_created, 1);
+  COMPARE(cached.get_value_linear(0.3, 0.7), tab.get_value_linear(0.3, 0.7));
+  // a table for other parameters is replaced
+  hash[0] = 1;
+  cache_tabulation(testoutputpath, "grid_cache.bin", hash, create, &created);
+  VERIFY(created);
+  COMPARE(n_created, 2);
+  // without a directory, nothing is stored
+  cache_tabulation(bf::path(), "grid_cache.bin", hash, create);
+  COMPARE(n_created, 3);
+}
+
+TEST(corrupt_cache) {
+  bf::create_directories(testoutputpath);
+  const bf::path path = testoutputpath / "corrupt_cache.bin";
+  sha256::Hash hash{};
+  int n_created = 0;
+  const std::function<GridTabulation()> create_grid = [&]() {
+    n_created++;
+    return GridTabulation({0., 2., 4}, {-1., 1., 10},
+                          [](double x, double y) { return x + 2 * y * x; });
+  };
+  const std::function<Tabulation()> create = [&]() {
+    n_created++;
+    return Tabulation(0., 1., 10, [](double x) { return x * x; });
+  };
+  const auto write_header = [&](std::ofstream &file, uint64_t n) {
+    const uint64_t dims = 2;
+    const double min = 0., max = 1.;
+    file.write(reinterpret_cast<const char *>(hash.data()), hash.size());
+    file.write(reinterpret_cast<const char *>(&dims), sizeof(dims));
+    for (int axis = 0; axis < 2; axis++) {
+      file.write(reinterpret_cast<const char *>(&min), sizeof(min));
+      file.write(reinterpret_cast<const char *>(&max), sizeof(max));
+      file.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    }
+  };
+  // an axis without points must not underflow
+  {
+    std::ofstream file(path.string(), std::ios::binary);
+    write_header(file, 0);
+  }
+  bool created = false;
+  GridTabulation grid =
+      cache_tabulation(testoutputpath, "corrupt_cache.bin", hash, create_grid,
+                       &created);
+  VERIFY(created);
+  COMPARE(n_created, 1);
+  // the rewritten table is valid
+  created = false;
+  grid = cache_tabulation(testoutputpath, "corrupt_cache.bin", hash,
+                          create_grid, &created);
+  VERIFY(!created);
+  // a header promising more values than stored
+  {
+    std::ofstream file(path.string(), std::ios::binary);
+    write_header(file, uint64_t(1) << 40);
+  }
+  cache_tabulation(testoutputpath, "corrupt_cache.bin", hash, create_grid,
+                   &created);
+  VERIFY(created);
+  COMPARE(n_created, 2);
+
+  // a truncated one-dimensional table is created again
+  bf::remove(path);
+  cache_tabulation(testoutputpath, "corrupt_cache.bin", hash, create);
+  COMPARE(n_created, 3);
+  bf::resize_file(path, bf::file_size(path) - 8);
+  created = false;
+  const Tabulation tab = cache_tabulation(
+      testoutputpath, "corrupt_cache.bin", hash, create, &created);
+  VERIFY(created);
+  COMPARE(n_created, 4);
+  COMPARE_ABSOLUTE_ERROR(tab.get_value_linear(0.5), 0.25, 1e-12);
+  created = false;
+  cache_tabulation(testoutputpath, "corrupt_cache.bin", hash, create, &created);
+  VERIFY(!created);
+  VERIFY(bf::remove(path));
+}
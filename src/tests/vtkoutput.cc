@@ -12,14 +12,19 @@
 #include "setup.h"
 
 #include <smash/config.h>
+#include <algorithm>
 #include <array>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <vector>
 
 #include "../include/smash/clock.h"
 #include "../include/smash/configuration.h"
+#include "../include/smash/density.h"
+#include "../include/smash/lattice.h"
 #include "../include/smash/outputinterface.h"
 #include "../include/smash/particles.h"
 #include "../include/smash/random.h"
@@ -295,3 +300,127 @@ TEST(vtkoutputfile) {
   VERIFY(bf::remove(outputfilepath));
   VERIFY(bf::remove(outputfile2path));
 }
+
+/// Read a value in big-endian byte order from a binary VTK file.
+template <typename T>
+static T read_big_endian(std::istream &file) {
+  char bytes[sizeof(T)];
+  file.read(bytes, sizeof(T));
+#ifdef LITTLE_ENDIAN_ARCHITECTURE
+  std::reverse(bytes, bytes + sizeof(T));
+#endif
+  T value;
+  std::memcpy(&value, bytes, sizeof(T));
+  return value;
+}
+
+TEST(binary_particles) {
+  Particles particles;
+  const int number_of_particles = 5;
+  for (int i = 0; i < number_of_particles; i++) {
+    particles.insert(Test::smashon_random());
+  }
+  VtkOutput vtkop(testoutputpath, "Particles", OutputParameters(), true);
+  vtkop.at_eventstart(particles, 1, Test::default_event_info());
+  const bf::path outputfilepath = testoutputpath / "pos_ev00001_tstep00000.vtk";
+  VERIFY(bf::exists(outputfilepath));
+
+  bf::ifstream file{outputfilepath, std::ios::binary};
+  std::string line;
+  std::getline(file, line);
+  COMPARE(line, "# vtk DataFile Version 2.0");
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "BINARY");
+  std::getline(file, line);
+  COMPARE(line, "DATASET UNSTRUCTURED_GRID");
+  std::getline(file, line);
+  COMPARE(line, "POINTS 5 double");
+  for (const auto &pd : particles) {
+    for (int k = 1; k < 4; k++) {
+      COMPARE(read_big_endian<double>(file), pd.position()[k]);
+    }
+  }
+  std::getline(file, line);
+  COMPARE(line, "");
+  std::getline(file, line);
+  COMPARE(line, "CELLS 5 10");
+  for (int i = 0; i < number_of_particles; i++) {
+    COMPARE(read_big_endian<std::int32_t>(file), 1);
+    COMPARE(read_big_endian<std::int32_t>(file), i);
+  }
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "CELL_TYPES 5");
+  for (int i = 0; i < number_of_particles; i++) {
+    COMPARE(read_big_endian<std::int32_t>(file), 1);
+  }
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "POINT_DATA 5");
+  std::getline(file, line);
+  COMPARE(line, "SCALARS pdg_codes int 1");
+  std::getline(file, line);
+  COMPARE(line, "LOOKUP_TABLE default");
+  for (int i = 0; i < number_of_particles; i++) {
+    COMPARE(read_big_endian<std::int32_t>(file), 661);
+  }
+
+  // The momenta are the last section
+  file.seekg(-(3 * 8 * number_of_particles + 1), std::ios::end);
+  for (const auto &pd : particles) {
+    for (int k = 1; k < 4; k++) {
+      COMPARE(read_big_endian<double>(file), pd.momentum()[k]);
+    }
+  }
+  std::getline(file, line);
+  COMPARE(line, "");
+  VERIFY(file.peek() == std::char_traits<char>::eof());
+}
+
+TEST(binary_density_lattice) {
+  RectangularLattice<DensityOnLattice> lattice(
+      {2., 3., 4.}, {2, 3, 4}, {-1., 0., 1.}, false, LatticeUpdate::AtOutput);
+  int i = 0;
+  for (auto &node : lattice) {
+    node.add_particle(Test::smashon_random(), i++);
+  }
+  VtkOutput vtkop(testoutputpath, "Thermodynamics", OutputParameters(), true);
+  vtkop.at_eventstart(Particles(), 2, Test::default_event_info());
+  vtkop.thermodynamics_output(ThermodynamicQuantity::EckartDensity,
+                              DensityType::Hadron, lattice);
+  const bf::path outputfilepath =
+      testoutputpath / "hadron_rho_eckart_00002_tstep00000.vtk";
+  VERIFY(bf::exists(outputfilepath));
+
+  bf::ifstream file{outputfilepath, std::ios::binary};
+  std::string line;
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "hadron_rho_eckart");
+  std::getline(file, line);
+  COMPARE(line, "BINARY");
+  std::getline(file, line);
+  COMPARE(line, "DATASET STRUCTURED_POINTS");
+  std::getline(file, line);
+  COMPARE(line, "DIMENSIONS 2 3 4");
+  std::getline(file, line);
+  std::getline(file, line);
+  std::getline(file, line);
+  COMPARE(line, "POINT_DATA 24");
+  std::getline(file, line);
+  COMPARE(line, "SCALARS hadron_rho_eckart double 1");
+  std::getline(file, line);
+  // The nodes are written with x running fastest
+  for (int iz = 0; iz < 4; iz++) {
+    for (int iy = 0; iy < 3; iy++) {
+      for (int ix = 0; ix < 2; ix++) {
+        COMPARE(read_big_endian<double>(file),
+                lattice[lattice.index1d(ix, iy, iz)].rho());
+      }
+    }
+  }
+  std::getline(file, line);
+  COMPARE(line, "");
+  VERIFY(file.peek() == std::char_traits<char>::eof());
+}
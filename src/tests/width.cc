@@ -137,3 +137,31 @@ TEST(photon_widths) {
   COMPARE_ABSOLUTE_ERROR(phi.get_partial_width(phi.mass(), {&pi0, &photon}),
                          5.4068538571729e-6, err);
 }
+
+TEST(total_width_vs_decay_branches) {
+  // The two-step evaluation has to reproduce the list of decay branches.
+  for (const ParticleType &t : ParticleType::list_all()) {
+    if (t.is_stable()) {
+      continue;
+    }
+    const FourVector p(t.mass() + 0.1, 0., 0., 0.);
+    for (const WhichDecaymodes wh :
+         {WhichDecaymodes::All, WhichDecaymodes::Hadronic,
+          WhichDecaymodes::Dileptons}) {
+      const DecayBranchList branches =
+          t.get_partial_widths(p, ThreeVector(), wh);
+      std::vector<double> widths(t.decay_modes().decay_mode_list().size());
+      const double width =
+          t.get_total_width(p, ThreeVector(), wh, widths.data());
+      COMPARE_RELATIVE_ERROR(width, total_weight<DecayBranch>(branches),
+                             1e-14)
+          << t.name();
+      const DecayBranchList rebuilt = t.get_decay_branches(widths.data());
+      COMPARE(rebuilt.size(), branches.size()) << t.name();
+      for (size_t i = 0; i < rebuilt.size(); i++) {
+        VERIFY(&rebuilt[i]->type() == &branches[i]->type()) << t.name();
+        COMPARE(rebuilt[i]->weight(), branches[i]->weight()) << t.name();
+      }
+    }
+  }
+}
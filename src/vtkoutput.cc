@@ -7,6 +7,9 @@
  *
  */
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <utility>
@@ -21,11 +24,12 @@
 namespace smash {
 
 VtkOutput::VtkOutput(const bf::path &path, const std::string &name,
-                     const OutputParameters &out_par)
+                     const OutputParameters &out_par, bool binary)
     : OutputInterface(name),
       base_path_(std::move(path)),
       is_thermodynamics_output_(name == "Thermodynamics"),
-      is_fields_output_(name == "Fields") {
+      is_fields_output_(name == "Fields"),
+      binary_(binary) {
   if (out_par.part_extended) {
     logg[LOutput].warn()
         << "Creating VTK output: There is no extended VTK format.";
@@ -56,8 +60,46 @@ VtkOutput::~VtkOutput() {}
  *
  * There is also a possibility to print a lattice with thermodynamical
  * quantities to vtk files, see \ref output_vtk_lattice_.
+ *
+ * With the format "VTK_Binary" instead of "VTK", the files have the same
+ * structure, but all numbers are written in binary form (legacy VTK
+ * "BINARY" files, big-endian, with 32 bit integers and 64 bit doubles).
+ * They are much smaller and faster to write, in particular for lattices, and
+ * are read by paraview in the same way. The PDG codes are then written in
+ * their decimal form.
  **/
 
+namespace {
+/**
+ * Append a value to a buffer in big-endian byte order, which binary legacy VTK
+ * files use.
+ *
+ * \param buffer Buffer to append to.
+ * \param value Value to append.
+ */
+template <typename T>
+void append_big_endian(std::vector<char> &buffer, T value) {
+  char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+#ifdef LITTLE_ENDIAN_ARCHITECTURE
+  std::reverse(bytes, bytes + sizeof(T));
+#endif
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+/**
+ * Append a vector to a buffer in big-endian byte order.
+ *
+ * \param buffer Buffer to append to.
+ * \param v Vector to append.
+ */
+void append_big_endian(std::vector<char> &buffer, const ThreeVector &v) {
+  append_big_endian(buffer, v.x1());
+  append_big_endian(buffer, v.x2());
+  append_big_endian(buffer, v.x3());
+}
+}  // unnamed namespace
+
 void VtkOutput::at_eventstart(const Particles &particles,
                               const int event_number, const EventInfo &) {
   vtk_output_counter_ = 0;
@@ -91,16 +133,85 @@ void VtkOutput::write(const Particles &particles) {
   char filename[32];
   snprintf(filename, sizeof(filename), "pos_ev%05i_tstep%05i.vtk",
            current_event_, vtk_output_counter_);
-  FilePtr file_{std::fopen((base_path_ / filename).native().c_str(), "w")};
+  FilePtr file_{std::fopen((base_path_ / filename).native().c_str(),
+                           binary_ ? "wb" : "w")};
 
   /* Legacy VTK file format */
   std::fprintf(file_.get(), "# vtk DataFile Version 2.0\n");
   std::fprintf(file_.get(), "Generated from molecular-offset data %s\n",
                VERSION_MAJOR);
-  std::fprintf(file_.get(), "ASCII\n");
+  std::fputs(binary_ ? "BINARY\n" : "ASCII\n", file_.get());
 
   /* Unstructured data sets are composed of points, lines, polygons, .. */
   std::fprintf(file_.get(), "DATASET UNSTRUCTURED_GRID\n");
+  if (binary_) {
+    const std::size_t n = particles.size();
+    // The filtered particle list of an output can be empty.
+    const double current_time = particles.is_empty() ? 0. : particles.time();
+    std::fprintf(file_.get(), "POINTS %zu double\n", n);
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian(buffer_, p.position().threevec());
+    });
+    std::fprintf(file_.get(), "CELLS %zu %zu\n", n, n * 2);
+    std::int32_t point_index = 0;
+    write_binary_section(file_.get(), particles, [&](const ParticleData &) {
+      append_big_endian<std::int32_t>(buffer_, 1);
+      append_big_endian(buffer_, point_index++);
+    });
+    std::fprintf(file_.get(), "CELL_TYPES %zu\n", n);
+    write_binary_section(file_.get(), particles, [&](const ParticleData &) {
+      append_big_endian<std::int32_t>(buffer_, 1);
+    });
+    std::fprintf(file_.get(), "POINT_DATA %zu\n", n);
+    std::fprintf(file_.get(), "SCALARS pdg_codes int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian<std::int32_t>(buffer_, p.pdgcode().get_decimal());
+    });
+    std::fprintf(file_.get(), "SCALARS is_formed int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      const bool is_formed = p.formation_time() <= current_time;
+      append_big_endian<std::int32_t>(buffer_, is_formed ? 1 : 0);
+    });
+    std::fprintf(file_.get(),
+                 "SCALARS cross_section_scaling_factor double 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian(buffer_, p.xsec_scaling_factor());
+    });
+    std::fprintf(file_.get(), "SCALARS mass double 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian(buffer_, p.effective_mass());
+    });
+    std::fprintf(file_.get(), "SCALARS N_coll int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian<std::int32_t>(
+          buffer_, p.get_history().collisions_per_particle);
+    });
+    std::fprintf(file_.get(), "SCALARS particle_ID int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian<std::int32_t>(buffer_, p.id());
+    });
+    std::fprintf(file_.get(), "SCALARS baryon_number int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian<std::int32_t>(buffer_, p.pdgcode().baryon_number());
+    });
+    std::fprintf(file_.get(), "SCALARS strangeness int 1\n");
+    std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian<std::int32_t>(buffer_, p.pdgcode().strangeness());
+    });
+    std::fprintf(file_.get(), "VECTORS momentum double\n");
+    write_binary_section(file_.get(), particles, [&](const ParticleData &p) {
+      append_big_endian(buffer_, p.momentum().threevec());
+    });
+    return;
+  }
   std::fprintf(file_.get(), "POINTS %zu double\n", particles.size());
   for (const auto &p : particles) {
     std::fprintf(file_.get(), "%g %g %g\n", p.position().x1(),
@@ -123,7 +234,7 @@ void VtkOutput::write(const Particles &particles) {
   }
   std::fprintf(file_.get(), "SCALARS is_formed int 1\n");
   std::fprintf(file_.get(), "LOOKUP_TABLE default\n");
-  double current_time = particles.time();
+  double current_time = particles.is_empty() ? 0. : particles.time();
   for (const auto &p : particles) {
     std::fprintf(file_.get(), "%s\n",
                  (p.formation_time() > current_time) ? "0" : "1");
@@ -165,6 +276,18 @@ void VtkOutput::write(const Particles &particles) {
   }
 }
 
+template <typename F>
+void VtkOutput::write_binary_section(std::FILE *file,
+                                     const Particles &particles,
+                                     F &&append_values) {
+  buffer_.clear();
+  for (const ParticleData &p : particles) {
+    append_values(p);
+  }
+  std::fwrite(buffer_.data(), 1, buffer_.size(), file);
+  std::fputc('\n', file);
+}
+
 /*!\Userguide
  * \page output_vtk_lattice_ Thermodynamics VTK Output
  * Density on the lattice can be printed out in the VTK format of
@@ -183,7 +306,7 @@ void VtkOutput::write_vtk_header(std::ofstream &file,
   const auto orig = lattice.origin();
   file << "# vtk DataFile Version 2.0\n"
        << description << "\n"
-       << "ASCII\n"
+       << (binary_ ? "BINARY\n" : "ASCII\n")
        << "DATASET STRUCTURED_POINTS\n"
        << "DIMENSIONS " << dim[0] << " " << dim[1] << " " << dim[2] << "\n"
        << "SPACING " << cs[0] << " " << cs[1] << " " << cs[2] << "\n"
@@ -197,6 +320,16 @@ void VtkOutput::write_vtk_scalar(std::ofstream &file,
                                  const std::string &varname, F &&get_quantity) {
   file << "SCALARS " << varname << " double 1\n"
        << "LOOKUP_TABLE default\n";
+  if (binary_) {
+    // The nodes are stored in the order of the VTK points.
+    buffer_.clear();
+    for (T &node : lattice) {
+      append_big_endian(buffer_, static_cast<double>(get_quantity(node)));
+    }
+    file.write(buffer_.data(), buffer_.size());
+    file << "\n";
+    return;
+  }
   file << std::setprecision(3);
   file << std::fixed;
   const auto dim = lattice.n_cells();
@@ -214,6 +347,16 @@ void VtkOutput::write_vtk_vector(std::ofstream &file,
                                  RectangularLattice<T> &lattice,
                                  const std::string &varname, F &&get_quantity) {
   file << "VECTORS " << varname << " double\n";
+  if (binary_) {
+    // The nodes are stored in the order of the VTK points.
+    buffer_.clear();
+    for (T &node : lattice) {
+      append_big_endian(buffer_, ThreeVector(get_quantity(node)));
+    }
+    file.write(buffer_.data(), buffer_.size());
+    file << "\n";
+    return;
+  }
   file << std::setprecision(3);
   file << std::fixed;
   const auto dim = lattice.n_cells();
@@ -244,7 +387,7 @@ void VtkOutput::thermodynamics_output(
   }
   std::ofstream file;
   const std::string varname = make_varname(tq, dens_type);
-  file.open(make_filename(varname, vtk_density_output_counter_), std::ios::out);
+  file.open(make_filename(varname, vtk_density_output_counter_), file_mode());
   write_vtk_header(file, lattice, varname);
   write_vtk_scalar(file, lattice, varname,
                    [&](DensityOnLattice &node) { return node.rho(); });
@@ -277,7 +420,7 @@ void VtkOutput::thermodynamics_output(
   const std::string varname = make_varname(tq, dens_type);
 
   if (tq == ThermodynamicQuantity::Tmn) {
-    file.open(make_filename(varname, vtk_tmn_output_counter_++), std::ios::out);
+    file.open(make_filename(varname, vtk_tmn_output_counter_++), file_mode());
     write_vtk_header(file, Tmn_lattice, varname);
     for (int i = 0; i < 4; i++) {
       for (int j = i; j < 4; j++) {
@@ -290,7 +433,7 @@ void VtkOutput::thermodynamics_output(
     }
   } else if (tq == ThermodynamicQuantity::TmnLandau) {
     file.open(make_filename(varname, vtk_tmn_landau_output_counter_++),
-              std::ios::out);
+              file_mode());
     write_vtk_header(file, Tmn_lattice, varname);
     for (int i = 0; i < 4; i++) {
       for (int j = i; j < 4; j++) {
@@ -305,7 +448,7 @@ void VtkOutput::thermodynamics_output(
     }
   } else {
     file.open(make_filename(varname, vtk_v_landau_output_counter_++),
-              std::ios::out);
+              file_mode());
     write_vtk_header(file, Tmn_lattice, varname);
     write_vtk_vector(file, Tmn_lattice, varname,
                      [&](EnergyMomentumTensor &node) {
@@ -322,13 +465,13 @@ void VtkOutput::fields_output(
     return;
   }
   std::ofstream file1;
-  file1.open(make_filename(name1, vtk_fields_output_counter_), std::ios::out);
+  file1.open(make_filename(name1, vtk_fields_output_counter_), file_mode());
   write_vtk_header(file1, lat, name1);
   write_vtk_vector(
       file1, lat, name1,
       [&](std::pair<ThreeVector, ThreeVector> &node) { return node.first; });
   std::ofstream file2;
-  file2.open(make_filename(name2, vtk_fields_output_counter_), std::ios::out);
+  file2.open(make_filename(name2, vtk_fields_output_counter_), file_mode());
   write_vtk_header(file2, lat, name2);
   write_vtk_vector(
       file2, lat, name2,
@@ -342,7 +485,7 @@ void VtkOutput::thermodynamics_output(const GrandCanThermalizer &gct) {
   }
   std::ofstream file;
   file.open(make_filename("fluidization_td", vtk_fluidization_counter_++),
-            std::ios::out);
+            file_mode());
   write_vtk_header(file, gct.lattice(), "fluidization_td");
   write_vtk_scalar(file, gct.lattice(), "e",
                    [&](ThermLatticeNode &node) { return node.e(); });